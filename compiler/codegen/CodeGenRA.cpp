@@ -476,6 +476,8 @@ OMR::CodeGenerator::allocateSpill(int32_t dataSize, bool containsCollectedRefere
    //
    bool try8ByteSpills = (dataSize < 16) && ((TR::Compiler->om.sizeofReferenceAddress() == 8) || !containsCollectedReference);
    bool try16ByteSpills = (dataSize == 16);
+   bool try32ByteSpills = (dataSize == 32);
+   bool try64ByteSpills = (dataSize == 64);
 
    if(reuse)
      {
@@ -494,6 +496,16 @@ OMR::CodeGenerator::allocateSpill(int32_t dataSize, bool containsCollectedRefere
        spill = self()->getSpill16FreeList().front();
        self()->getSpill16FreeList().pop_front();
      }
+     if (!spill && try32ByteSpills && !self()->getSpill32FreeList().empty())
+     {
+       spill = self()->getSpill32FreeList().front();
+       self()->getSpill32FreeList().pop_front();
+     }
+     if (!spill && try64ByteSpills && !self()->getSpill64FreeList().empty())
+     {
+       spill = self()->getSpill64FreeList().front();
+       self()->getSpill64FreeList().pop_front();
+     }
      if (
          (spill && self()->comp()->getOption(TR_TraceRA) && !performTransformation(self()->comp(), "O^O SPILL TEMPS: Reuse spill temp %s\n", self()->getDebug()->getName(spill->getSymbolReference()))))
        {
@@ -522,7 +534,7 @@ OMR::CodeGenerator::allocateSpill(int32_t dataSize, bool containsCollectedRefere
       //
       int spillSize = std::max(dataSize, static_cast<int32_t>(TR::Compiler->om.sizeofReferenceAddress()));
 
-      TR_ASSERT(4 <= spillSize && spillSize <= 16, "Spill temps should be between 4 and 16 bytes");
+      TR_ASSERT(4 <= spillSize && spillSize <= 64, "Spill temps should be between 4 and 64 bytes");
       spillSymbol = TR::AutomaticSymbol::create(self()->trHeapMemory(),TR::NoType,spillSize);
       spillSymbol->setSpillTempAuto();
       self()->comp()->getMethodSymbol()->addAutomatic(spillSymbol);
@@ -574,9 +586,9 @@ OMR::CodeGenerator::allocateSpill(int32_t dataSize, bool containsCollectedRefere
 void
 OMR::CodeGenerator::freeSpill(TR_BackingStore *spill, int32_t dataSize, int32_t offset)
    {
-   TR_ASSERT(1 <= dataSize && dataSize <= 16, "assertion failure");
+   TR_ASSERT(1 <= dataSize && dataSize <= 64, "assertion failure");
    TR_ASSERT(offset == 0 || offset == 4, "assertion failure");
-   TR_ASSERT(dataSize + offset <= 16, "assertion failure");
+   TR_ASSERT(dataSize + offset <= 64, "assertion failure");
 
    if (self()->comp()->getOption(TR_TraceRA))
       {
@@ -677,6 +689,18 @@ OMR::CodeGenerator::freeSpill(TR_BackingStore *spill, int32_t dataSize, int32_t
             if (self()->comp()->getOption(TR_TraceRA))
                traceMsg(self()->comp(), "\n -> added to spill16FreeList");
             }
+         else if (spill->getSymbolReference()->getSymbol()->getSize() == 32)
+            {
+            _spill32FreeList.push_front(spill);
+            if (self()->comp()->getOption(TR_TraceRA))
+               traceMsg(self()->comp(), "\n -> added to spill32FreeList");
+            }
+         else if (spill->getSymbolReference()->getSymbol()->getSize() == 64)
+            {
+            _spill64FreeList.push_front(spill);
+            if (self()->comp()->getOption(TR_TraceRA))
+               traceMsg(self()->comp(), "\n -> added to spill64FreeList");
+            }
          }
       }
    }
@@ -689,6 +713,8 @@ OMR::CodeGenerator::jettisonAllSpills()
    _spill4FreeList.clear();
    _spill8FreeList.clear();
    _spill16FreeList.clear();
+   _spill32FreeList.clear();
+   _spill64FreeList.clear();
    _internalPointerSpillFreeList.clear();
    }
 
@@ -217,6 +217,8 @@ OMR::CodeGenerator::CodeGenerator(TR::Compilation *comp) :
       _spill4FreeList(getTypedAllocator<TR_BackingStore*>(comp->allocator())),
       _spill8FreeList(getTypedAllocator<TR_BackingStore*>(comp->allocator())),
       _spill16FreeList(getTypedAllocator<TR_BackingStore*>(comp->allocator())),
+      _spill32FreeList(getTypedAllocator<TR_BackingStore*>(comp->allocator())),
+      _spill64FreeList(getTypedAllocator<TR_BackingStore*>(comp->allocator())),
       _internalPointerSpillFreeList(getTypedAllocator<TR_BackingStore*>(comp->allocator())),
       _spilledRegisterList(NULL),
       _referencedRegistersList(NULL),
@@ -3013,6 +3015,13 @@ OMR::CodeGenerator::addStaticRelocation(const TR::StaticRelocation &relocation)
    _staticRelocationList.push_back(relocation);
    }
 
+bool
+OMR::CodeGenerator::needsStaticRelocations()
+   {
+   return self()->comp()->getOption(TR_EmitRelocatableELFFile)
+      || self()->comp()->getOptions()->getPersistentCodeCacheDir() != NULL;
+   }
+
 intptr_t OMR::CodeGenerator::hiValue(intptr_t address)
    {
    if (self()->comp()->compileRelocatableCode()) // We don't want to store values using HI_VALUE at compile time, otherwise, we do this a 2nd time when we relocate (and new value is based on old one)
@@ -808,6 +808,21 @@ public:
    uint32_t getJitMethodEntryPaddingSize() {return _jitMethodEntryPaddingSize;}
    uint32_t setJitMethodEntryPaddingSize(uint32_t s) {return (_jitMethodEntryPaddingSize = s);}
 
+   /** \brief
+    *     Encodes how the frame of the method is set up and torn down as DWARF call frame instructions,
+    *     for profilers that unwind through compiled code.  The instructions start from an empty state
+    *     at \p codeStart and define the CFA and the location of the return address themselves.
+    *
+    *  \param[in]  codeStart : the address the instructions are relative to
+    *  \param[out] size : the size in bytes of the instructions
+    *  \param[out] returnAddressRegister : the DWARF register number of the return address column
+    *  \param[out] dataAlignmentFactor : the factor applied to DW_CFA_offset operands
+    *
+    *  \return the instructions, allocated from the heap memory of the compilation, or NULL if the
+    *          code generator does not describe its frames
+    */
+   uint8_t *encodeCallFrameInstructions(uint8_t *codeStart, uint32_t &size, uint8_t &returnAddressRegister, int8_t &dataAlignmentFactor) { return NULL; }
+
    // --------------------------------------------------------------------------
    // Code cache
    //
@@ -1087,6 +1102,8 @@ public:
    TR::list<TR_BackingStore*>& getSpill4FreeList() {return _spill4FreeList;}
    TR::list<TR_BackingStore*>& getSpill8FreeList() {return _spill8FreeList;}
    TR::list<TR_BackingStore*>& getSpill16FreeList() {return _spill16FreeList;}
+   TR::list<TR_BackingStore*>& getSpill32FreeList() {return _spill32FreeList;}
+   TR::list<TR_BackingStore*>& getSpill64FreeList() {return _spill64FreeList;}
    TR::list<TR_BackingStore*>& getInternalPointerSpillFreeList() {return _internalPointerSpillFreeList;}
    TR::list<TR_BackingStore*>& getCollectedSpillList() {return _collectedSpillList;}
    TR::list<TR_BackingStore*>& getAllSpillList() {return _allSpillList;}
@@ -1140,6 +1157,13 @@ public:
    void addExternalRelocation(TR::Relocation *r, TR::RelocationDebugInfo *info, TR::ExternalRelocationPositionRequest where = TR::ExternalRelocationAtBack);
    void addStaticRelocation(const TR::StaticRelocation &relocation);
 
+   /**
+    * @brief Answers whether references from the body to external symbols must be
+    *        recorded as static relocations, either for a relocatable ELF file or
+    *        for the persistent code cache
+    */
+   bool needsStaticRelocations();
+
    void addProjectSpecializedRelocation(uint8_t *location,
                                           uint8_t *target,
                                           uint8_t *target2,
@@ -1946,6 +1970,8 @@ public:
    TR::list<TR_BackingStore*> _spill4FreeList;
    TR::list<TR_BackingStore*> _spill8FreeList;
    TR::list<TR_BackingStore*> _spill16FreeList;
+   TR::list<TR_BackingStore*> _spill32FreeList;
+   TR::list<TR_BackingStore*> _spill64FreeList;
    TR::list<TR_BackingStore*> _internalPointerSpillFreeList;
    TR::list<TR_BackingStore*> _collectedSpillList;
    TR::list<TR_BackingStore*> _allSpillList;
@@ -93,6 +93,7 @@ class Relocation
    uint8_t *setUpdateLocation(uint8_t *p) {return (_updateLocation = p);}
 
    virtual bool isExternalRelocation() { return false; }
+   virtual bool isLabelAbsoluteRelocation() { return false; }
 
    TR::RelocationDebugInfo* getDebugInfo();
 
@@ -263,6 +264,7 @@ class LabelAbsoluteRelocation : public TR::LabelRelocation
    LabelAbsoluteRelocation() : TR::LabelRelocation() {}
    LabelAbsoluteRelocation(uint8_t *p, TR::LabelSymbol *l)
       : TR::LabelRelocation(p, l) {}
+   virtual bool isLabelAbsoluteRelocation() { return true; }
    virtual void apply(TR::CodeGenerator *codeGen);
    };
 
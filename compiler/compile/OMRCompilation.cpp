@@ -105,6 +105,8 @@
 #include "ras/IlVerifier.hpp"
 #include "control/Recompilation.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "runtime/PersistentCodeCache.hpp"
 #include "ilgen/IlGen.hpp"
 #include "env/RegionProfiler.hpp"
 #include "omrformatconsts.h"
@@ -1064,6 +1066,19 @@ int32_t OMR::Compilation::compile()
          }
 #endif
 
+      // A body stored by an earlier run for the same IL replaces optimization
+      // and code generation
+      //
+      bool loadedFromPersistentCodeCache = false;
+#if (HOST_OS == OMR_LINUX)
+      TR::PersistentCodeCache *persistentCodeCache = TR::CodeCacheManager::instance()->persistentCodeCache();
+      TR::vector<uint8_t> persistentCodeKey(getTypedAllocator<uint8_t>(self()->allocator()));
+      if (persistentCodeCache && !persistentCodeCache->computeKey(self(), persistentCodeKey))
+         persistentCodeCache = NULL;
+      if (persistentCodeCache)
+         loadedFromPersistentCodeCache = persistentCodeCache->load(self(), persistentCodeKey);
+#endif // HOST_OS == OMR_LINUX
+
       if (_recompilationInfo)
          {
          _recompilationInfo->beforeOptimization();
@@ -1079,6 +1094,7 @@ int32_t OMR::Compilation::compile()
       TR_DebuggingCounters::initializeCompilation();
       if (printCodegenTime) optTime.startTiming(self());
 
+      if (!loadedFromPersistentCodeCache)
          {
          TR::RegionProfiler rpOpt(self()->trMemory()->heapMemoryRegion(), *self(), "comp/opt");
          self()->performOptimizations();
@@ -1128,12 +1144,18 @@ int32_t OMR::Compilation::compile()
         if (printCodegenTime)
            codegenTime.startTiming(self());
 
-        self()->cg()->generateCode();
+        if (!loadedFromPersistentCodeCache)
+           self()->cg()->generateCode();
 
         if (printCodegenTime)
            codegenTime.stopTiming(self());
         }
 
+#if (HOST_OS == OMR_LINUX)
+      if (persistentCodeCache && !loadedFromPersistentCodeCache)
+         persistentCodeCache->store(self(), persistentCodeKey);
+#endif // HOST_OS == OMR_LINUX
+
       if (_recompilationInfo)
          _recompilationInfo->endOfCompilation();
 
@@ -59,6 +59,7 @@
 #include "env/DebugSegmentProvider.hpp"
 #include "omrformatconsts.h"
 #include "runtime/CodeCacheManager.hpp"
+#include "runtime/PerfJitDump.hpp"
 
 #if defined (_MSC_VER) && _MSC_VER < 1900
 #define snprintf _snprintf
@@ -115,21 +116,100 @@ writePerfToolEntry(void *start, uint32_t size, const char *name)
 
 
 
+static const char *
+perfToolEntryName(char (&buffer)[1024], const char *sig, const char *hotness)
+   {
+   if (strlen(sig) + 1 + strlen(hotness) + 1 < 1024)
+      {
+      sprintf(buffer, "%s_%s (compiled code)", sig, hotness);
+      return buffer;
+      }
+   return "(compiled code)";
+   }
+
 static void
 generatePerfToolEntry(uint8_t *startPC, uint8_t *endPC, const char *sig, const char *hotness)
    {
    char buffer[1024];
-   char *name;
-   if (strlen(sig) + 1 + strlen(hotness) + 1 < 1024)
+   writePerfToolEntry(startPC, endPC - startPC, perfToolEntryName(buffer, sig, hotness));
+   }
+
+#if (HOST_OS == OMR_LINUX)
+/**
+ * Record the body of a successful compilation in the jitdump file, with a line
+ * table mapping its instructions to byte code indices and the unwind rules of
+ * its frame.  The file name of a line is the signature of the method the byte
+ * code belongs to and, for inlined code, the call site it was inlined at.
+ */
+static void
+generatePerfJitDumpEntry(TR::PerfJitDump *jitDump, TR::Compilation *comp, uint8_t *startPC)
+   {
+   TR::CodeGenerator *cg = comp->cg();
+   TR_Memory *trMemory = comp->trMemory();
+
+   const uint32_t numInlinedCallSites = comp->getNumInlinedCallSites();
+   const char **fileNames = (const char **)trMemory->allocateHeapMemory((numInlinedCallSites + 1) * sizeof(char *));
+   fileNames[0] = comp->signature();
+   for (uint32_t i = 0; i < numInlinedCallSites; i++)
       {
-      sprintf(buffer, "%s_%s (compiled code)", sig, hotness);
-      name = buffer;
+      TR_ByteCodeInfo &callSite = comp->getInlinedCallSite(i)._byteCodeInfo;
+      const char *callee = comp->getInlinedResolvedMethod(i)->signature(trMemory);
+      const char *caller = callSite.getCallerIndex() < 0 ? comp->signature() : comp->getInlinedResolvedMethod(callSite.getCallerIndex())->signature(trMemory);
+      size_t length = strlen(callee) + strlen(caller) + 32;
+      char *fileName = (char *)trMemory->allocateHeapMemory(length);
+      snprintf(fileName, length, "%s inlined at %s:%d", callee, caller, callSite.getByteCodeIndex());
+      fileNames[i + 1] = fileName;
       }
-   else
-      name = "(compiled code)";
 
-   writePerfToolEntry(startPC, endPC - startPC, name);
+   uint32_t numInstructions = 0;
+   for (TR::Instruction *instr = cg->getFirstInstruction(); instr; instr = instr->getNext())
+      numInstructions++;
+
+   // One line per run of instructions generated for the same byte code
+   //
+   TR::PerfJitDump::LineEntry *lines = (TR::PerfJitDump::LineEntry *)trMemory->allocateHeapMemory(numInstructions * sizeof(TR::PerfJitDump::LineEntry));
+   uint32_t numLines = 0;
+   int32_t lastCallerIndex = -2;
+   int32_t lastByteCodeIndex = -1;
+   for (TR::Instruction *instr = cg->getFirstInstruction(); instr; instr = instr->getNext())
+      {
+      TR::Node *node = instr->getNode();
+      uint8_t *address = instr->getBinaryEncoding();
+      if (!node || !address || address < startPC || instr->getBinaryLength() == 0)
+         continue;
+
+      TR_ByteCodeInfo &bcInfo = node->getByteCodeInfo();
+      int32_t callerIndex = bcInfo.getCallerIndex();
+      if (callerIndex < -1 || callerIndex >= (int32_t)numInlinedCallSites)
+         callerIndex = -1;
+      if (callerIndex == lastCallerIndex && bcInfo.getByteCodeIndex() == lastByteCodeIndex)
+         continue;
+
+      lines[numLines].address = address;
+      lines[numLines].line = bcInfo.getByteCodeIndex() < 0 ? 0 : bcInfo.getByteCodeIndex();
+      lines[numLines].discriminator = 0;
+      lines[numLines].fileName = fileNames[callerIndex + 1];
+      numLines++;
+      lastCallerIndex = callerIndex;
+      lastByteCodeIndex = bcInfo.getByteCodeIndex();
+      }
+
+   TR::PerfJitDump::CallFrameInfo frameInfo;
+   frameInfo.instructions = cg->encodeCallFrameInstructions(startPC, frameInfo.size, frameInfo.returnAddressRegister, frameInfo.dataAlignmentFactor);
+
+   // OMR code generators emit the whole body, snippets included, into the warm
+   // area, so the body is a single code region
+   //
+   char buffer[1024];
+   jitDump->writeCodeLoad(
+      perfToolEntryName(buffer, comp->signature(), comp->getHotnessName(comp->getMethodHotness())),
+      startPC,
+      cg->getCodeEnd() - startPC,
+      lines,
+      numLines,
+      frameInfo.instructions ? &frameInfo : NULL);
    }
+#endif // HOST_OS == OMR_LINUX
 
 #if defined(TR_TARGET_POWER)
 #include "p/codegen/PPCTableOfConstants.hpp"
@@ -231,6 +311,12 @@ registerTrampoline(uint8_t *start, uint32_t size, const char *name)
    {
    if (TR::Options::getCmdLineOptions()->getOption(TR_PerfTool))
       writePerfToolEntry(start, size, name);
+
+#if (HOST_OS == OMR_LINUX)
+   TR::PerfJitDump *jitDump = TR::CodeCacheManager::instance()->perfJitDump();
+   if (jitDump)
+      jitDump->writeCodeLoad(name, start, size, NULL, 0, NULL);
+#endif // HOST_OS == OMR_LINUX
    }
 
 static void
@@ -423,6 +509,12 @@ compileMethodFromDetails(
                }
             }
 
+#if (HOST_OS == OMR_LINUX)
+         TR::PerfJitDump *jitDump = fe.codeCacheManager().perfJitDump();
+         if (jitDump)
+            generatePerfJitDumpEntry(jitDump, &compiler, startPC);
+#endif // HOST_OS == OMR_LINUX
+
          if (compiler.getOutFile() != NULL && compiler.getOption(TR_TraceAll))
             traceMsg((&compiler), "<result success=\"true\" startPC=\"%#p\" time=\"%lld.%lldms\"/>\n",
                                   startPC,
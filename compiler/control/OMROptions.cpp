@@ -424,6 +424,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"disableLoopReplicatorColdSideEntryCheck","I\tdisable cold side-entry check for replicating loops containing hot inner loops", SET_OPTION_BIT(TR_DisableLoopReplicatorColdSideEntryCheck), "P"},
    {"disableLoopStrider",                 "O\tdisable loop strider",                           TR::Options::disableOptimization, loopStrider, 0, "P"},
    {"disableLoopTransfer",                "O\tdisable the loop transfer part of loop versioner", SET_OPTION_BIT(TR_DisableLoopTransfer), "F"},
+   {"disableLoopVectorization",           "O\tdisable loop vectorization",                     TR::Options::disableOptimization, loopVectorization, 0, "P"},
    {"disableLoopVersioner",               "O\tdisable loop versioner",                         TR::Options::disableOptimization, loopVersioner, 0, "P"},
    {"disableMarkingOfHotFields",          "O\tdisable marking of Hot Fields",                  SET_OPTION_BIT(TR_DisableMarkingOfHotFields), "F"},
    {"disableMarshallingIntrinsics",       "O\tDisable packed decimal to binary marshalling and un-marshalling optimization. They will not be inlined.", SET_OPTION_BIT(TR_DisableMarshallingIntrinsics), "F"},
@@ -931,6 +932,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
         TR::Options::set32BitSignedNumeric, offsetof(OMR::Options,_maxStaticPICSlots), 0, "F%d"},
    {"maxUnloadedAddressRanges=", " <nnn>\tmaximum number of entries in arrays of unloaded class/method address ranges",
         TR::Options::set32BitSignedNumeric, offsetof(OMR::Options,_maxUnloadedAddressRanges), 0, "F%d"},
+   {"maxVectorLength=", "C<nnn>\tlength in bytes of the vector types and registers used by the code generator (default 16), 0 for the widest supported by the processor",
+        TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_maxVectorLength, 0, "F%d", NOT_IN_SUBSET},
    {"mbc=", "C<nnn>\tThe max number of candidates to consider for limited GRA", TR::Options::set32BitNumeric, offsetof(OMR::Options,_maxLimitedGRACandidates), TR_MAX_LIMITED_GRA_CANDIDATES , "F%d"},
    {"mbr=", "C<nnn>\tThe max number of registers to assign for limited GRA", TR::Options::set32BitNumeric, offsetof(OMR::Options,_maxLimitedGRARegs), TR_MAX_LIMITED_GRA_REGS , "F%d"},
    {"mccSanityCheck",       "M\tEnable multi-code-cache sanity checking. High overhead", SET_OPTION_BIT(TR_CodeCacheSanityCheck), "F", NOT_IN_SUBSET},
@@ -1003,6 +1006,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"paranoidOptCheck",   "O\tcheck the trees and cfgs after every optimization phase", SET_OPTION_BIT(TR_EnableParanoidOptCheck), "F"},
    {"performLookaheadAtWarmCold", "O\tallow lookahead to be performed at cold and warm", SET_OPTION_BIT(TR_PerformLookaheadAtWarmCold), "F"},
    {"perfTool", "M\tenable PerfTool", SET_OPTION_BIT(TR_PerfTool), "F", NOT_IN_SUBSET },
+   {"perfToolJitDump", "M\trecord compiled code with line tables and unwind info in /tmp/jit-<pid>.dump for perf inject --jit", SET_OPTION_BIT(TR_PerfToolJitDump), "F", NOT_IN_SUBSET },
+   {"persistentCodeCacheDir=", "M<dir>\treuse compiled bodies stored in dir by earlier runs and store new ones there", TR::Options::setString, offsetof(OMR::Options,_persistentCodeCacheDir), 0, "P%s", NOT_IN_SUBSET},
+   {"persistentCodeCacheSize=", "M<nnn>\tlimit on the size of the bodies stored in persistentCodeCacheDir, in KB, least recently used bodies are removed beyond it",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _persistentCodeCacheSizeKB), 0, " %d (KB)", NOT_IN_SUBSET},
    {"poisonDeadSlots",    "O\tpaints all dead slots with deadf00d", SET_OPTION_BIT(TR_PoisonDeadSlots), "F"},
    {"prepareForOSREvenIfThatDoesNothing",   "O\temit the call to prepareForOSR even if there is no slot sharing", SET_OPTION_BIT(TR_EnablePrepareForOSREvenIfThatDoesNothing), "F"},
    {"printAbsoluteTimestampInVerboseLog", "O\tPrint Absolute Timestamp in vlog", SET_OPTION_BIT(TR_PrintAbsoluteTimestampInVerboseLog), "F", NOT_IN_SUBSET},
@@ -1167,6 +1174,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"traceLoopReduction",               "L\ttrace loop reduction",                         TR::Options::traceOptimization, loopReduction, 0, "P"},
    {"traceLoopReplicator",              "L\ttrace loop replicator",                        TR::Options::traceOptimization, loopReplicator, 0, "P"},
    {"traceLoopStrider",                 "L\ttrace loop strider",                           TR::Options::traceOptimization, loopStrider,   0, "P"},
+   {"traceLoopVectorization",           "L\ttrace loop vectorization",                     TR::Options::traceOptimization, loopVectorization, 0, "P"},
    {"traceLoopVersioner",               "L\ttrace loop versioner",                          TR::Options::traceOptimization, loopVersioner, 0, "P"},
    {"traceMarkingOfHotFields",          "M\ttrace marking of Hot Fields",                 SET_OPTION_BIT(TR_TraceMarkingOfHotFields), "F"},
    {"traceMethodIndex",                 "L\treport every method symbol that gets created and consumes a methodIndex", SET_OPTION_BIT(TR_TraceMethodIndex), "F"},
@@ -1592,6 +1600,7 @@ int32_t       OMR::Options::_interpreterSamplingDivisorInStartupMode = -1; // un
 int32_t       OMR::Options::_numJitEntries = 0;
 int32_t       OMR::Options::_numVmEntries = 0;
 int32_t       OMR::Options::_numVecRegsToLock=0;
+int32_t       OMR::Options::_maxVectorLength = 16; // 0 means the widest the target supports
 int32_t       OMR::Options::_hotFieldThreshold = 200;
 int32_t       OMR::Options::_maxNumPrexAssumptions = 209;
 int32_t       OMR::Options::_maxNumVisitedSubclasses = 500;
@@ -1988,9 +1997,9 @@ OMR::Options::jitLatePostProcess(TR::OptionSet *optionSet, void * jitConfig)
 #endif
 
    static const bool disableCCREnv = feGetEnv("TR_DisableCCR") != NULL;
-   if (self()->getOption(TR_PerfTool) || disableCCREnv)
+   if (self()->getOption(TR_PerfTool) || self()->getOption(TR_PerfToolJitDump) || disableCCREnv)
       {
-      fprintf(stderr, "WARNING: Disabling code cache reclamation due to due to -Xjit:perfTool or TR_DisableCCR environment variable\n");
+      fprintf(stderr, "WARNING: Disabling code cache reclamation due to due to -Xjit:perfTool, -Xjit:perfToolJitDump or TR_DisableCCR environment variable\n");
       self()->setOption(TR_DisableCodeCacheReclamation);
       }
 
@@ -2582,6 +2591,8 @@ OMR::Options::jitPreProcess()
    // catch loops that run thousands of times.
    _loopyAsyncCheckInsertionMaxEntryFreq = 100;
 
+   _persistentCodeCacheSizeKB = 64 * 1024;
+
 #if defined(TR_TARGET_64BIT)
    self()->setOption(TR_EnableCodeCacheConsolidation);
 #endif
@@ -3073,6 +3084,19 @@ OMR::Options::setTarget()
       TR::DataType::setSize(TR::Address, 8);
    else
       TR::DataType::setSize(TR::Address, 4);
+
+   // Vector types stay 16 bytes wide, which JitBuilder clients and existing IL
+   // assume, unless maxVectorLength= asks for wider registers. 0 selects the
+   // widest the target supports.
+   int32_t vectorLength = TR::Compiler->target.cpu.getMaxVectorLength();
+   if (_maxVectorLength > 0 && _maxVectorLength < vectorLength)
+      vectorLength = _maxVectorLength >= 32 ? 32 : 16;
+   TR::DataType::setSize(TR::VectorInt8, vectorLength);
+   TR::DataType::setSize(TR::VectorInt16, vectorLength);
+   TR::DataType::setSize(TR::VectorInt32, vectorLength);
+   TR::DataType::setSize(TR::VectorInt64, vectorLength);
+   TR::DataType::setSize(TR::VectorFloat, vectorLength);
+   TR::DataType::setSize(TR::VectorDouble, vectorLength);
    }
 
 
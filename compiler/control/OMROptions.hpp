@@ -826,7 +826,7 @@ enum TR_CompilationOptions
    TR_TracePREForOptimalSubNodeReplacement            = 0x00002000 + 25,
    // Available                                       = 0x00008000 + 25,
    TR_PerfTool                                        = 0x00010000 + 25,
-   // Available                                       = 0x00020000 + 25,
+   TR_PerfToolJitDump                                 = 0x00020000 + 25,
    TR_DisableBranchOnCount                            = 0x00040000 + 25,
    // Available                                       = 0x00080000 + 25,
    TR_DisableLoopEntryAlignment                       = 0x00100000 + 25,
@@ -1697,6 +1697,8 @@ public:
 
    static int32_t getNumUsableCompilationThreads() { return _numUsableCompilationThreads; }
 
+   static int32_t getMaxVectorLength() { return _maxVectorLength; }
+
    static int32_t getTrampolineSpacePercentage() { return _trampolineSpacePercentage; }
    static size_t getScratchSpaceLimit() { return _scratchSpaceLimit; }
    static void setScratchSpaceLimit(size_t newScratchSpaceLimit) { _scratchSpaceLimit = newScratchSpaceLimit; }
@@ -1726,6 +1728,7 @@ public:
    static int32_t _interpreterSamplingDivisorInStartupMode;
 
    static int32_t _numVecRegsToLock;
+   static int32_t _maxVectorLength;
    static int32_t _hotFieldThreshold; // a number between 0 and 100
 
    static int32_t _iprofilerDialDownThreshold;
@@ -1866,6 +1869,11 @@ public:
    void disableCHOpts(); // disable CHOpts, but also IPA and prex which depend on the chtable
 
    const char *getObjectFileName() { return _objectFileName; }
+   const char *getPersistentCodeCacheDir() { return _persistentCodeCacheDir; }
+   int32_t getPersistentCodeCacheSizeKB() { return _persistentCodeCacheSizeKB; }
+
+   const char *getStartOptions() { return _startOptions; }
+   const char *getEnvOptions() { return _envOptions; }
 
 protected:
    void  jitPreProcess();
@@ -2347,6 +2355,8 @@ protected:
    int32_t                     _loopyAsyncCheckInsertionMaxEntryFreq;
 
    char *                      _objectFileName; //Name of the relocatable ELF file *.o if one is to be generated
+   char *                      _persistentCodeCacheDir; //Directory compiled bodies are stored in and reused from across runs
+   int32_t                     _persistentCodeCacheSizeKB; //Limit on the size of the entries in _persistentCodeCacheDir
 
    }; // TR::Options
 
@@ -174,6 +174,12 @@ public:
     */
    bool supportsTransactionalMemoryInstructions() { return false; }
 
+   /**
+    * @brief Determines the widest vector register, in bytes, the code generator can use on the current processor.
+    * @return 16; this is the default answer unless overridden by an extending class.
+    */
+   int32_t getMaxVectorLength() { return 16; }
+
    /** 
     * @brief Determines whether current processor is the same as the input processor type
     * @param[in] p : the input processor type
@@ -721,12 +721,18 @@ OMR::MethodBuilder::GetNextBytecodeFromWorklist()
 
 int32_t
 OMR::MethodBuilder::Compile(void **entry)
+   {
+   return Compile(entry, warm);
+   }
+
+int32_t
+OMR::MethodBuilder::Compile(void **entry, TR_Hotness hotness)
    {
    TR::ResolvedMethod resolvedMethod(static_cast<TR::MethodBuilder *>(this));
    TR::IlGeneratorMethodDetails details(&resolvedMethod);
 
    int32_t rc=0;
-   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
+   *entry = (void *) compileMethodFromDetails(NULL, details, hotness, rc);
 
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
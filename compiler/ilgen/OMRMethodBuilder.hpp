@@ -25,6 +25,7 @@
 #include <map>
 #include <set>
 #include <fstream>
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 #include "ilgen/IlBuilder.hpp"
 #include "env/TypedAllocator.hpp"
@@ -146,6 +147,13 @@ class MethodBuilder : public TR::IlBuilder
 
    int32_t Compile(void **entry);
 
+   /**
+    * @brief compile this MethodBuilder with the optimization strategy of the given hotness
+    * @param entry set to the entry point of the compiled code on success
+    * @returns the compilation return code, COMPILATION_SUCCEEDED on success
+    */
+   int32_t Compile(void **entry, TR_Hotness hotness);
+
    /**
     * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
     *        mechanism for MethodBuilder subclasses to provide method lookup on demand rather than all up
@@ -0,0 +1,866 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "optimizer/LoopVectorizer.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "env/TRMemory.hpp"
+#include "il/AutomaticSymbol.hpp"
+#include "il/Block.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/BitVector.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/Checklist.hpp"
+#include "infra/List.hpp"
+#include "optimizer/InductionVariable.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/OptimizationManager.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+
+#define OPT_DETAILS "O^O LOOP VECTORIZATION: "
+
+TR_LoopVectorizer::TR_LoopVectorizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager)
+   {}
+
+int32_t TR_LoopVectorizer::perform()
+   {
+   if (comp()->getOption(TR_DisableAutoSIMD) || !cg()->getSupportsAutoSIMD() || !comp()->target().is64Bit())
+      {
+      if (trace())
+         traceMsg(comp(), "Vector IL not supported -- returning from loop vectorization.\n");
+      return 0;
+      }
+
+   if (!comp()->mayHaveLoops())
+      {
+      if (trace())
+         traceMsg(comp(), "Method does not have loops -- returning from loop vectorization.\n");
+      return 0;
+      }
+
+   TR::CFG *cfg = comp()->getFlowGraph();
+   if (cfg->getStructure() == NULL)
+      return 0;
+
+   // From here, down, stack memory allocations will die when the function returns
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   if (trace())
+      comp()->dumpMethodTrees("Before loop vectorization");
+
+   List<TR_RegionStructure> loops(stackMemoryRegion);
+   collectLoops(cfg->getStructure(), loops);
+
+   // Every loop is analyzed before any is changed since the structure does
+   // not survive the changes
+   //
+   List<VectorizableLoop> vectorizableLoops(stackMemoryRegion);
+   ListIterator<TR_RegionStructure> loopIt(&loops);
+   for (TR_RegionStructure *loop = loopIt.getFirst(); loop; loop = loopIt.getNext())
+      {
+      VectorizableLoop *info = analyzeLoop(loop);
+      if (info &&
+          performTransformation(comp(), "%sVectorizing loop %d, %d elements per vector\n", OPT_DETAILS,
+                                loop->getNumber(), getVectorLength(info->_elementType)))
+         vectorizableLoops.add(info);
+      }
+
+   if (vectorizableLoops.isEmpty())
+      {
+      dumpOptDetails(comp(), "Loop vectorization completed: no qualifying loops found\n");
+      return 0;
+      }
+
+   cfg->invalidateStructure();
+
+   ListIterator<VectorizableLoop> infoIt(&vectorizableLoops);
+   for (VectorizableLoop *info = infoIt.getFirst(); info; info = infoIt.getNext())
+      vectorizeLoop(info);
+
+   optimizer()->setUseDefInfo(NULL);
+   optimizer()->setValueNumberInfo(NULL);
+   requestOpt(OMR::inductionVariableAnalysis);
+
+   if (trace())
+      comp()->dumpMethodTrees("After loop vectorization");
+
+   return 1;
+   }
+
+
+const char *
+TR_LoopVectorizer::optDetailString() const throw()
+   {
+   return "O^O LOOP VECTORIZATION: ";
+   }
+
+
+void TR_LoopVectorizer::collectLoops(TR_Structure *str, List<TR_RegionStructure> &loops)
+   {
+   TR_RegionStructure *region = str->asRegion();
+
+   if (region == NULL)
+      return;
+
+   if (region->isNaturalLoop())
+      loops.add(region);
+
+   TR_RegionStructure::Cursor it(*region);
+   for (TR_StructureSubGraphNode *node = it.getCurrent(); node; node = it.getNext())
+      collectLoops(node->getStructure(), loops);
+   }
+
+
+static bool isLoadOf(TR::Node *node, TR::SymbolReference *symRef)
+   {
+   return node->getOpCode().isLoadVarDirect() && node->getSymbolReference() == symRef;
+   }
+
+
+static int32_t countReferences(TR::Node *node, TR::SymbolReference *symRef, TR::NodeChecklist &visited)
+   {
+   if (visited.contains(node))
+      return 0;
+   visited.add(node);
+
+   int32_t count = (node->getOpCode().hasSymbolReference() && node->getSymbolReference() == symRef) ? 1 : 0;
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      count += countReferences(node->getChild(i), symRef, visited);
+   return count;
+   }
+
+
+/**
+ * The loops vectorized are single block natural loops counting up by one to a
+ * loop invariant limit:
+ *
+ *    preHeader:  ...                     (falls through to body)
+ *    body:       <element wise trees>
+ *                istore i (iadd (iload i) (iconst 1))
+ *                ificmplt/ificmple --> body
+ *                   ==>iadd or iload i
+ *                   <limit>
+ *    exit:       ...
+ */
+TR_LoopVectorizer::VectorizableLoop *
+TR_LoopVectorizer::analyzeLoop(TR_RegionStructure *loop)
+   {
+   if (trace())
+      traceMsg(comp(), "<Analyzing loop=%d>\n", loop->getNumber());
+
+   TR_PrimaryInductionVariable *piv = loop->getPrimaryInductionVariable();
+   if (piv == NULL ||
+       piv->getSymRef()->getSymbol()->getDataType() != TR::Int32 ||
+       piv->getDeltaOnBackEdge() != 1 ||
+       piv->isUnsigned())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> no signed int primary induction variable incremented by 1\n", loop->getNumber());
+      return NULL;
+      }
+
+   TR::SymbolReference *ivSymRef = piv->getSymRef();
+   TR::Block *body = loop->getEntryBlock();
+   TR_ScratchList<TR::Block> blocksInLoop(trMemory());
+   loop->getBlocks(&blocksInLoop);
+   if (blocksInLoop.getSize() != 1 || piv->getBranchBlock() != body)
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> more than one block\n", loop->getNumber());
+      return NULL;
+      }
+
+   if (body->isCold() || body->hasExceptionSuccessors() || body->hasExceptionPredecessors())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> cold loop or exception edges\n", loop->getNumber());
+      return NULL;
+      }
+
+   TR::TreeTop *branchTree = body->getLastRealTreeTop();
+   TR::Node *branch = branchTree->getNode();
+   TR::TreeTop *incrementTree = branchTree->getPrevTreeTop();
+   TR::Node *increment = incrementTree->getNode();
+   TR::Node *next = increment->getOpCode().isStoreDirect() ? increment->getFirstChild() : NULL;
+   if ((branch->getOpCodeValue() != TR::ificmplt && branch->getOpCodeValue() != TR::ificmple) ||
+       branch->getBranchDestination() != body->getEntry() ||
+       next == NULL ||
+       increment->getSymbolReference() != ivSymRef ||
+       next->getNumChildren() != 2 ||
+       !isLoadOf(next->getFirstChild(), ivSymRef) ||
+       !next->getSecondChild()->getOpCode().isLoadConst() ||
+       !((next->getOpCodeValue() == TR::iadd && next->getSecondChild()->getInt() == 1) ||
+         (next->getOpCodeValue() == TR::isub && next->getSecondChild()->getInt() == -1)) ||
+       (branch->getFirstChild() != next && !isLoadOf(branch->getFirstChild(), ivSymRef)))
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> loop test is not i < limit right after i++\n", loop->getNumber());
+      return NULL;
+      }
+
+   TR::Block *exit = body->getNextBlock();
+   TR::Block *preHeader = NULL;
+   bool hasOtherEdges = (exit == NULL);
+   for (auto edge = body->getSuccessors().begin(); edge != body->getSuccessors().end(); ++edge)
+      {
+      TR::Block *to = toBlock((*edge)->getTo());
+      if (to != body && to != exit)
+         hasOtherEdges = true;
+      }
+   for (auto edge = body->getPredecessors().begin(); edge != body->getPredecessors().end(); ++edge)
+      {
+      TR::Block *from = toBlock((*edge)->getFrom());
+      if (from == body)
+         continue;
+      if (preHeader != NULL)
+         hasOtherEdges = true;
+      preHeader = from;
+      }
+   if (hasOtherEdges ||
+       preHeader == NULL ||
+       preHeader->getEntry() == NULL ||
+       preHeader->getNextBlock() != body ||
+       preHeader->getSuccessors().size() != 1 ||
+       preHeader->getLastRealTreeTop()->getNode()->getOpCode().isBranch() ||
+       preHeader->getLastRealTreeTop()->getNode()->getOpCode().isJumpWithMultipleTargets() ||
+       preHeader->getLastRealTreeTop()->getNode()->getOpCode().isReturn())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> no pre-header falling through to the loop\n", loop->getNumber());
+      return NULL;
+      }
+
+   TR::Region &region = trMemory()->currentStackRegion();
+   VectorizableLoop *info = new (region) VectorizableLoop(region);
+   info->_preHeader = preHeader;
+   info->_body = body;
+   info->_exit = exit;
+   info->_incrementTree = incrementTree;
+   info->_ivSymRef = ivSymRef;
+   info->_limit = branch->getSecondChild();
+   info->_inclusive = branch->getOpCodeValue() == TR::ificmple;
+   info->_elementType = TR::NoType;
+   info->_storedSymRefs = new (region) TR_BitVector(comp()->getSymRefCount(), region);
+
+   if (!analyzeTrees(info))
+      return NULL;
+
+   if (!isInvariant(info, info->_limit))
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> limit n%dn is not loop invariant\n", loop->getNumber(), info->_limit->getGlobalIndex());
+      return NULL;
+      }
+
+   if (!analyzeDependences(info))
+      return NULL;
+
+   return info;
+   }
+
+
+bool TR_LoopVectorizer::analyzeTrees(VectorizableLoop *info)
+   {
+   TR::TreeTop *firstTree = info->_body->getEntry()->getNextTreeTop();
+
+   for (TR::TreeTop *tt = firstTree; tt != info->_body->getExit(); tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCode().isStoreDirect())
+         info->_storedSymRefs->set(node->getSymbolReference()->getReferenceNumber());
+      }
+
+   TR::NodeChecklist visited(comp());
+   for (TR::TreeTop *tt = firstTree; tt != info->_incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      bool vectorizable;
+
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         TR::Node *child = node->getFirstChild();
+         vectorizable = isInvariant(info, child) ||
+                        isLoadOf(child, info->_ivSymRef) ||
+                        analyzeExpression(info, child, visited);
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         vectorizable = !node->getOpCode().isWrtBar() &&
+                        node->getSymbol()->isArrayShadowSymbol() &&
+                        setElementType(info, node->getDataType()) &&
+                        isVectorOpSupported(TR::vstorei, info->_elementType) &&
+                        analyzeAccess(info, node, true) &&
+                        analyzeExpression(info, node->getSecondChild(), visited);
+         }
+      else if (node->getOpCode().isStoreDirect())
+         {
+         vectorizable = analyzeReduction(info, node, visited);
+         }
+      else
+         {
+         vectorizable = false;
+         }
+
+      if (!vectorizable)
+         {
+         if (trace())
+            traceMsg(comp(), "\tReject loop ==> tree n%dn cannot be vectorized\n", node->getGlobalIndex());
+         return false;
+         }
+      }
+
+   return info->_elementType != TR::NoType;
+   }
+
+
+bool TR_LoopVectorizer::analyzeExpression(VectorizableLoop *info, TR::Node *node, TR::NodeChecklist &visited)
+   {
+   if (visited.contains(node))
+      return true;
+   visited.add(node);
+
+   if (!setElementType(info, node->getDataType()))
+      return false;
+
+   if (isInvariant(info, node))
+      return isVectorOpSupported(TR::vsplats, info->_elementType);
+
+   if (node->getOpCode().isLoadIndirect())
+      {
+      return node->getSymbol()->isArrayShadowSymbol() &&
+             isVectorOpSupported(TR::vloadi, info->_elementType) &&
+             analyzeAccess(info, node, false);
+      }
+
+   if (node->getOpCode().isArithmetic() && node->getNumChildren() == 2)
+      {
+      TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue());
+      return vectorOp != TR::BadILOp &&
+             isVectorOpSupported(vectorOp, info->_elementType) &&
+             analyzeExpression(info, node->getFirstChild(), visited) &&
+             analyzeExpression(info, node->getSecondChild(), visited);
+      }
+
+   return false;
+   }
+
+
+bool TR_LoopVectorizer::analyzeAccess(VectorizableLoop *info, TR::Node *node, bool isStore)
+   {
+   TR::Node *address = node->getFirstChild();
+   if (address->getOpCodeValue() != TR::aladd)
+      return false;
+
+   TR::Node *base = address->getFirstChild();
+   int64_t scale, offset;
+   if (base->getOpCodeValue() != TR::aload ||
+       !isInvariant(info, base) ||
+       !isLinearInIV(address->getSecondChild(), info->_ivSymRef, scale, offset) ||
+       scale != TR::DataType::getSize(info->_elementType))
+      {
+      if (trace())
+         traceMsg(comp(), "\tArray access n%dn is not to consecutive elements\n", node->getGlobalIndex());
+      return false;
+      }
+
+   ArrayAccess *access = new (trMemory()->currentStackRegion()) ArrayAccess;
+   access->_node = node;
+   access->_base = base;
+   access->_offset = offset;
+   access->_isStore = isStore;
+   info->_accesses.add(access);
+   return true;
+   }
+
+
+bool TR_LoopVectorizer::analyzeReduction(VectorizableLoop *info, TR::Node *store, TR::NodeChecklist &visited)
+   {
+   TR::SymbolReference *symRef = store->getSymbolReference();
+   TR::DataType dt = store->getDataType();
+   TR::Node *sum = store->getFirstChild();
+
+   // Only integer sums are vectorized, adding floating point values in a
+   // different order would change the result
+   //
+   if (symRef == info->_ivSymRef ||
+       !symRef->getSymbol()->isAutoOrParm() ||
+       (dt != TR::Int32 && dt != TR::Int64) ||
+       !setElementType(info, dt) ||
+       !isVectorOpSupported(TR::vadd, dt) ||
+       sum->getOpCodeValue() != (dt == TR::Int32 ? TR::iadd : TR::ladd) ||
+       sum->getReferenceCount() != 1)
+      return false;
+
+   TR::Node *accumulator = sum->getFirstChild();
+   TR::Node *addend = sum->getSecondChild();
+   if (!isLoadOf(accumulator, symRef))
+      {
+      accumulator = sum->getSecondChild();
+      addend = sum->getFirstChild();
+      }
+   if (!isLoadOf(accumulator, symRef) || accumulator->getReferenceCount() != 1)
+      return false;
+
+   // The store and its load must be the only references to the variable
+   TR::NodeChecklist referenced(comp());
+   int32_t numReferences = 0;
+   for (TR::TreeTop *tt = info->_body->getEntry(); tt != info->_body->getExit(); tt = tt->getNextTreeTop())
+      numReferences += countReferences(tt->getNode(), symRef, referenced);
+   if (numReferences != 2)
+      return false;
+
+   if (!analyzeExpression(info, addend, visited))
+      return false;
+
+   Reduction *reduction = new (trMemory()->currentStackRegion()) Reduction;
+   reduction->_store = store;
+   reduction->_addend = addend;
+   reduction->_accumulator = NULL;
+   info->_reductions.add(reduction);
+   return true;
+   }
+
+
+/**
+ * A vector iteration performs the loads and stores of VL scalar iterations in
+ * tree order rather than iteration order, which is only correct if no element
+ * stored is loaded or stored by another of the VL iterations.  Accesses off
+ * the same base are at a constant distance from each other, accesses off
+ * different bases are checked when the loop is entered.
+ */
+bool TR_LoopVectorizer::analyzeDependences(VectorizableLoop *info)
+   {
+   int64_t vectorSize = getVectorLength(info->_elementType) * TR::DataType::getSize(info->_elementType);
+
+   ListIterator<ArrayAccess> storeIt(&info->_accesses);
+   for (ArrayAccess *store = storeIt.getFirst(); store; store = storeIt.getNext())
+      {
+      if (!store->_isStore)
+         continue;
+
+      ListIterator<ArrayAccess> accessIt(&info->_accesses);
+      for (ArrayAccess *access = accessIt.getFirst(); access; access = accessIt.getNext())
+         {
+         if (access == store ||
+             access->_base->getSymbolReference() != store->_base->getSymbolReference())
+            continue;
+
+         int64_t distance = store->_offset - access->_offset;
+         if (distance != 0 && distance > -vectorSize && distance < vectorSize)
+            {
+            if (trace())
+               traceMsg(comp(), "\tReject loop ==> n%dn and n%dn are %lld bytes apart\n",
+                        store->_node->getGlobalIndex(), access->_node->getGlobalIndex(), (long long)distance);
+            return false;
+            }
+         }
+      }
+
+   return true;
+   }
+
+
+bool TR_LoopVectorizer::setElementType(VectorizableLoop *info, TR::DataType dt)
+   {
+   if (info->_elementType == TR::NoType &&
+       (dt == TR::Int32 || dt == TR::Int64 || dt == TR::Float || dt == TR::Double))
+      info->_elementType = dt;
+
+   return dt == info->_elementType;
+   }
+
+
+bool TR_LoopVectorizer::isInvariant(VectorizableLoop *info, TR::Node *node)
+   {
+   if (node->getOpCode().isLoadConst())
+      return true;
+
+   return node->getOpCode().isLoadVarDirect() &&
+          node->getSymbol()->isAutoOrParm() &&
+          !info->_storedSymRefs->isSet(node->getSymbolReference()->getReferenceNumber());
+   }
+
+
+/**
+ * Decompose an array offset into scale * i + offset
+ */
+bool TR_LoopVectorizer::isLinearInIV(TR::Node *node, TR::SymbolReference *ivSymRef, int64_t &scale, int64_t &offset)
+   {
+   switch (node->getOpCodeValue())
+      {
+      case TR::iload:
+         scale = 1;
+         offset = 0;
+         return node->getSymbolReference() == ivSymRef;
+      case TR::iconst:
+      case TR::lconst:
+         scale = 0;
+         offset = node->getConstValue();
+         return true;
+      case TR::i2l:
+         return isLinearInIV(node->getFirstChild(), ivSymRef, scale, offset);
+      case TR::iadd:
+      case TR::ladd:
+      case TR::isub:
+      case TR::lsub:
+         {
+         int64_t scale2, offset2;
+         if (!isLinearInIV(node->getFirstChild(), ivSymRef, scale, offset) ||
+             !isLinearInIV(node->getSecondChild(), ivSymRef, scale2, offset2))
+            return false;
+         if (node->getOpCode().isSub())
+            {
+            scale -= scale2;
+            offset -= offset2;
+            }
+         else
+            {
+            scale += scale2;
+            offset += offset2;
+            }
+         return true;
+         }
+      case TR::imul:
+      case TR::lmul:
+      case TR::ishl:
+      case TR::lshl:
+         {
+         TR::Node *factor = node->getSecondChild();
+         if (!factor->getOpCode().isLoadConst() ||
+             !isLinearInIV(node->getFirstChild(), ivSymRef, scale, offset))
+            return false;
+         int64_t multiplier = factor->getConstValue();
+         if (node->getOpCode().isLeftShift())
+            {
+            if (multiplier < 0 || multiplier > 31)
+               return false;
+            multiplier = (int64_t)1 << multiplier;
+            }
+         scale *= multiplier;
+         offset *= multiplier;
+         return true;
+         }
+      default:
+         return false;
+      }
+   }
+
+
+bool TR_LoopVectorizer::isVectorOpSupported(TR::ILOpCodes vectorOp, TR::DataType dt)
+   {
+   return cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(vectorOp), dt);
+   }
+
+
+int32_t TR_LoopVectorizer::getVectorLength(TR::DataType dt)
+   {
+   return TR::DataType::getSize(dt.scalarToVector()) / TR::DataType::getSize(dt);
+   }
+
+
+/**
+ * The loop becomes
+ *
+ *    preHeader:  ...
+ *    guard:      <vector accumulators = 0>
+ *                ificmpeq --> body                  if fewer than VL iterations are left
+ *                   iand                            or two accesses may overlap
+ *                      lcmple (ladd (i2l i) VL) (i2l limit)
+ *                      <alias checks>
+ *                   iconst 0
+ *    vector:     <vector trees>
+ *                istore i (iadd (iload i) (iconst VL))
+ *                iflcmple --> vector
+ *                   ladd (i2l i) VL
+ *                   i2l limit
+ *    reduce:     s = s + <accumulator lanes>        if there are reductions
+ *    remainder:  ificmpge --> exit
+ *                   iload i
+ *                   limit
+ *    body:       <the original loop>
+ *    exit:       ...
+ *
+ * The loop test is at the bottom of the body, so the original loop always
+ * runs its body once before testing i against the limit.  A guard failure
+ * therefore goes straight to the body, which keeps that first iteration for
+ * do-while loops entered with i >= limit.  The remainder test is only
+ * reached after at least one vector iteration, all of which the original
+ * loop would have run too.
+ */
+void TR_LoopVectorizer::vectorizeLoop(VectorizableLoop *info)
+   {
+   TR::CFG *cfg = comp()->getFlowGraph();
+   TR::Block *preHeader = info->_preHeader;
+   TR::Block *body = info->_body;
+   TR::Block *exit = info->_exit;
+   TR::DataType elementType = info->_elementType;
+   int32_t elementSize = TR::DataType::getSize(elementType);
+   int32_t vectorLength = getVectorLength(elementType);
+   TR::Node *bbNode = body->getEntry()->getNode();
+   TR::SymbolReference *vectorShadow = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(elementType.scalarToVector(), NULL);
+   TR::SymbolReference *elementShadow = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(elementType, NULL);
+
+   TR::Block *guardBlock = TR::Block::createEmptyBlock(bbNode, comp(), preHeader->getFrequency(), preHeader);
+   TR::Block *vectorBlock = TR::Block::createEmptyBlock(bbNode, comp(), body->getFrequency(), body);
+   TR::Block *reductionBlock = info->_reductions.isEmpty() ? NULL : TR::Block::createEmptyBlock(bbNode, comp(), preHeader->getFrequency(), preHeader);
+   TR::Block *remainderBlock = TR::Block::createEmptyBlock(bbNode, comp(), preHeader->getFrequency(), preHeader);
+
+   // Each reduction adds up VL partial sums in a stack allocated vector
+   //
+   ListIterator<Reduction> reductionIt(&info->_reductions);
+   for (Reduction *reduction = reductionIt.getFirst(); reduction; reduction = reductionIt.getNext())
+      {
+      reduction->_accumulator = comp()->getSymRefTab()->createLocalPrimArray(vectorLength * elementSize, comp()->getMethodSymbol(), 8);
+      reduction->_accumulator->setStackAllocatedArrayAccess();
+
+      TR::Node *zero = (elementType == TR::Int32) ? TR::Node::iconst(bbNode, 0) : TR::Node::lconst(bbNode, 0);
+      TR::Node *init = TR::Node::createWithSymRef(TR::vstorei, 2, 2,
+                                                 TR::Node::createWithSymRef(bbNode, TR::loadaddr, 0, reduction->_accumulator),
+                                                 TR::Node::create(TR::vsplats, 1, zero),
+                                                 vectorShadow);
+      guardBlock->append(TR::TreeTop::create(comp(), init));
+      }
+
+   // Enter the vector loop if at least VL iterations are left and no two
+   // accesses overlap within a vector
+   //
+   TR::Node *condition = TR::Node::create(TR::lcmple, 2,
+                                          TR::Node::create(TR::ladd, 2,
+                                                           TR::Node::create(TR::i2l, 1, TR::Node::createLoad(bbNode, info->_ivSymRef)),
+                                                           TR::Node::lconst(bbNode, vectorLength)),
+                                          createLimitNode(info));
+   ListIterator<ArrayAccess> storeIt(&info->_accesses);
+   int32_t storeIndex = 0;
+   for (ArrayAccess *store = storeIt.getFirst(); store; store = storeIt.getNext(), storeIndex++)
+      {
+      if (!store->_isStore)
+         continue;
+
+      ListIterator<ArrayAccess> accessIt(&info->_accesses);
+      int32_t accessIndex = 0;
+      for (ArrayAccess *access = accessIt.getFirst(); access; access = accessIt.getNext(), accessIndex++)
+         {
+         if (access == store ||
+             (access->_isStore && accessIndex < storeIndex) ||
+             access->_base->getSymbolReference() == store->_base->getSymbolReference())
+            continue;
+
+         condition = TR::Node::create(TR::iand, 2, condition, createAliasCheck(info, store, access));
+         }
+      }
+   guardBlock->append(TR::TreeTop::create(comp(),
+                         TR::Node::createif(TR::ificmpeq, condition, TR::Node::iconst(bbNode, 0), body->getEntry())));
+
+   // The vector loop
+   //
+   NodeMap vectorNodes((NodeMapAllocator(trMemory()->currentStackRegion())));
+   for (TR::TreeTop *tt = body->getEntry()->getNextTreeTop(); tt != info->_incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      TR::Node *vectorTree = NULL;
+
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         TR::Node *child = node->getFirstChild();
+         if (isInvariant(info, child) || isLoadOf(child, info->_ivSymRef))
+            continue;
+         vectorTree = TR::Node::create(TR::treetop, 1, createVectorNode(info, child, vectorShadow, vectorNodes));
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         vectorTree = TR::Node::createWithSymRef(TR::vstorei, 2, 2,
+                                                 node->getFirstChild()->duplicateTree(),
+                                                 createVectorNode(info, node->getSecondChild(), vectorShadow, vectorNodes),
+                                                 vectorShadow);
+         }
+      else
+         {
+         Reduction *reduction;
+         for (reduction = reductionIt.getFirst(); reduction->_store != node; reduction = reductionIt.getNext())
+            ;
+         TR::Node *partialSums = TR::Node::createWithSymRef(TR::vloadi, 1, 1,
+                                                            TR::Node::createWithSymRef(node, TR::loadaddr, 0, reduction->_accumulator),
+                                                            vectorShadow);
+         TR::Node *sum = TR::Node::create(TR::vadd, 2, partialSums,
+                                          createVectorNode(info, reduction->_addend, vectorShadow, vectorNodes));
+         vectorTree = TR::Node::createWithSymRef(TR::vstorei, 2, 2,
+                                                 TR::Node::createWithSymRef(node, TR::loadaddr, 0, reduction->_accumulator),
+                                                 sum,
+                                                 vectorShadow);
+         }
+
+      vectorBlock->append(TR::TreeTop::create(comp(), vectorTree));
+      }
+
+   TR::Node *ivIncrement = TR::Node::create(TR::iadd, 2, TR::Node::createLoad(bbNode, info->_ivSymRef), TR::Node::iconst(bbNode, vectorLength));
+   vectorBlock->append(TR::TreeTop::create(comp(), TR::Node::createStore(info->_ivSymRef, ivIncrement)));
+   TR::Node *nextEnd = TR::Node::create(TR::ladd, 2,
+                                        TR::Node::create(TR::i2l, 1, TR::Node::createLoad(bbNode, info->_ivSymRef)),
+                                        TR::Node::lconst(bbNode, vectorLength));
+   vectorBlock->append(TR::TreeTop::create(comp(),
+                          TR::Node::createif(TR::iflcmple, nextEnd, createLimitNode(info), vectorBlock->getEntry())));
+
+   // Add the partial sums into the reduction variables
+   //
+   for (Reduction *reduction = reductionIt.getFirst(); reduction; reduction = reductionIt.getNext())
+      {
+      TR::SymbolReference *symRef = reduction->_store->getSymbolReference();
+      TR::Node *total = TR::Node::createLoad(bbNode, symRef);
+      for (int32_t lane = 0; lane < vectorLength; lane++)
+         {
+         TR::Node *laneAddress = TR::Node::create(TR::aladd, 2,
+                                                  TR::Node::createWithSymRef(bbNode, TR::loadaddr, 0, reduction->_accumulator),
+                                                  TR::Node::lconst(bbNode, lane * elementSize));
+         TR::Node *laneValue = TR::Node::createWithSymRef(comp()->il.opCodeForIndirectArrayLoad(elementType), 1, 1, laneAddress, elementShadow);
+         total = TR::Node::create(elementType == TR::Int32 ? TR::iadd : TR::ladd, 2, total, laneValue);
+         }
+      reductionBlock->append(TR::TreeTop::create(comp(), TR::Node::createStore(symRef, total)));
+      }
+
+   // Leave if the vector loop did all the iterations, else finish them in the original loop
+   //
+   remainderBlock->append(TR::TreeTop::create(comp(),
+                             TR::Node::createif(info->_inclusive ? TR::ificmpgt : TR::ificmpge,
+                                                TR::Node::createLoad(bbNode, info->_ivSymRef),
+                                                info->_limit->duplicateTree(),
+                                                exit->getEntry())));
+
+   preHeader->getExit()->join(guardBlock->getEntry());
+   guardBlock->getExit()->join(vectorBlock->getEntry());
+   if (reductionBlock)
+      {
+      vectorBlock->getExit()->join(reductionBlock->getEntry());
+      reductionBlock->getExit()->join(remainderBlock->getEntry());
+      }
+   else
+      {
+      vectorBlock->getExit()->join(remainderBlock->getEntry());
+      }
+   remainderBlock->getExit()->join(body->getEntry());
+
+   cfg->addNode(guardBlock);
+   cfg->addNode(vectorBlock);
+   if (reductionBlock)
+      cfg->addNode(reductionBlock);
+   cfg->addNode(remainderBlock);
+
+   cfg->addEdge(preHeader, guardBlock);
+   cfg->addEdge(guardBlock, vectorBlock);
+   cfg->addEdge(guardBlock, body);
+   cfg->addEdge(vectorBlock, vectorBlock);
+   if (reductionBlock)
+      {
+      cfg->addEdge(vectorBlock, reductionBlock);
+      cfg->addEdge(reductionBlock, remainderBlock);
+      }
+   else
+      {
+      cfg->addEdge(vectorBlock, remainderBlock);
+      }
+   cfg->addEdge(remainderBlock, body);
+   cfg->addEdge(remainderBlock, exit);
+   cfg->removeEdge(preHeader, body);
+
+   if (trace())
+      traceMsg(comp(), "\tVector loop block_%d inserted before loop block_%d\n", vectorBlock->getNumber(), body->getNumber());
+   }
+
+
+TR::Node *
+TR_LoopVectorizer::createVectorNode(VectorizableLoop *info, TR::Node *node, TR::SymbolReference *vectorShadow, NodeMap &vectorNodes)
+   {
+   NodeMap::iterator found = vectorNodes.find(node);
+   if (found != vectorNodes.end())
+      return found->second;
+
+   TR::Node *vectorNode;
+   if (isInvariant(info, node))
+      {
+      vectorNode = TR::Node::create(TR::vsplats, 1, node->duplicateTree());
+      }
+   else if (node->getOpCode().isLoadIndirect())
+      {
+      vectorNode = TR::Node::createWithSymRef(TR::vloadi, 1, 1, node->getFirstChild()->duplicateTree(), vectorShadow);
+      }
+   else
+      {
+      vectorNode = TR::Node::create(TR::ILOpCode::convertScalarToVector(node->getOpCodeValue()), 2,
+                                    createVectorNode(info, node->getFirstChild(), vectorShadow, vectorNodes),
+                                    createVectorNode(info, node->getSecondChild(), vectorShadow, vectorNodes));
+      }
+
+   vectorNodes[node] = vectorNode;
+   return vectorNode;
+   }
+
+
+/**
+ * The long value the end of the next VL iterations must not exceed
+ */
+TR::Node *
+TR_LoopVectorizer::createLimitNode(VectorizableLoop *info)
+   {
+   TR::Node *limit = TR::Node::create(TR::i2l, 1, info->_limit->duplicateTree());
+   if (info->_inclusive)
+      limit = TR::Node::create(TR::ladd, 2, limit, TR::Node::lconst(limit, 1));
+   return limit;
+   }
+
+
+/**
+ * Both accesses move by the same element size on every iteration so the
+ * distance between them is the distance between their first elements.  The
+ * vector loop is safe if that distance is 0 or at least the size of a vector.
+ */
+TR::Node *
+TR_LoopVectorizer::createAliasCheck(VectorizableLoop *info, ArrayAccess *store, ArrayAccess *access)
+   {
+   int64_t vectorSize = getVectorLength(info->_elementType) * TR::DataType::getSize(info->_elementType);
+   TR::Node *distance = TR::Node::create(TR::lsub, 2,
+                                         TR::Node::create(TR::a2l, 1, store->_base->duplicateTree()),
+                                         TR::Node::create(TR::a2l, 1, access->_base->duplicateTree()));
+   distance = TR::Node::create(TR::ladd, 2, distance, TR::Node::lconst(distance, store->_offset - access->_offset));
+
+   TR::Node *sameElement = TR::Node::create(TR::lcmpeq, 2, distance, TR::Node::lconst(distance, 0));
+   TR::Node *noOverlap = TR::Node::create(TR::lcmpge, 2,
+                                          TR::Node::create(TR::labs, 1, distance),
+                                          TR::Node::lconst(distance, vectorSize));
+   return TR::Node::create(TR::ior, 2, sameElement, noOverlap);
+   }
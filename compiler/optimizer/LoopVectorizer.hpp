@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <stdint.h>
+#include <map>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "infra/List.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_BitVector;
+class TR_RegionStructure;
+class TR_Structure;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class NodeChecklist; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+/**
+ * Vectorizes innermost counted loops whose body is a single block of element
+ * wise array computations, e.g.
+ *
+ *    for (i = 0; i < n; i++)
+ *       r[i] = a[i] * b[i] + c;
+ *
+ * Between the pre-header and the loop a vector loop is inserted that performs
+ * VL iterations at a time with the vector IL (vloadi, vadd, vstorei, ...), VL
+ * being the number of elements of the loop's type that fit a vector register.
+ * The original loop is kept to run the remaining iterations, and is also run
+ * alone when a runtime check finds that arrays accessed through different
+ * base addresses overlap within a vector.
+ *
+ * Integer sums into a local, s = s + expr, are vectorized as well: each lane
+ * accumulates into a stack allocated vector that is added into s when the
+ * vector loop ends.
+ *
+ * Only the opcodes reported by TR::CodeGenerator::getSupportsOpCodeForAutoSIMD
+ * are generated.  The loops must have been canonicalized and have a primary
+ * induction variable found by induction variable analysis.
+ */
+class TR_LoopVectorizer : public TR::Optimization
+   {
+   public:
+   TR_LoopVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_LoopVectorizer(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+   typedef TR::typed_allocator<std::pair<TR::Node * const, TR::Node *>, TR::Region&> NodeMapAllocator;
+   typedef std::map<TR::Node *, TR::Node *, std::less<TR::Node *>, NodeMapAllocator> NodeMap;
+
+   // An array element accessed in the loop, at base + i * elementSize + offset
+   struct ArrayAccess
+      {
+      TR::Node *_node;
+      TR::Node *_base;
+      int64_t _offset;
+      bool _isStore;
+      };
+
+   // s = s + addend, with s not otherwise used in the loop
+   struct Reduction
+      {
+      TR::Node *_store;
+      TR::Node *_addend;
+      TR::SymbolReference *_accumulator;   // the stack allocated vector of partial sums
+      };
+
+   struct VectorizableLoop
+      {
+      VectorizableLoop(TR::Region &region) : _accesses(region), _reductions(region) {}
+
+      TR::Block *_preHeader;
+      TR::Block *_body;
+      TR::Block *_exit;
+      TR::TreeTop *_incrementTree;     // the body trees before it are vectorized
+      TR::SymbolReference *_ivSymRef;
+      TR::Node *_limit;
+      bool _inclusive;                 // the loop runs while i <= limit rather than i < limit
+      TR::DataType _elementType;
+      TR_BitVector *_storedSymRefs;    // symbols stored to in the loop
+      List<ArrayAccess> _accesses;
+      List<Reduction> _reductions;
+      };
+
+   void collectLoops(TR_Structure *str, List<TR_RegionStructure> &loops);
+   VectorizableLoop *analyzeLoop(TR_RegionStructure *loop);
+   bool analyzeTrees(VectorizableLoop *info);
+   bool analyzeExpression(VectorizableLoop *info, TR::Node *node, TR::NodeChecklist &visited);
+   bool analyzeAccess(VectorizableLoop *info, TR::Node *node, bool isStore);
+   bool analyzeReduction(VectorizableLoop *info, TR::Node *store, TR::NodeChecklist &visited);
+   bool analyzeDependences(VectorizableLoop *info);
+   bool setElementType(VectorizableLoop *info, TR::DataType dt);
+   bool isInvariant(VectorizableLoop *info, TR::Node *node);
+   bool isLinearInIV(TR::Node *node, TR::SymbolReference *ivSymRef, int64_t &scale, int64_t &offset);
+   bool isVectorOpSupported(TR::ILOpCodes vectorOp, TR::DataType dt);
+   int32_t getVectorLength(TR::DataType dt);
+
+   void vectorizeLoop(VectorizableLoop *info);
+   TR::Node *createVectorNode(VectorizableLoop *info, TR::Node *node, TR::SymbolReference *vectorShadow, NodeMap &vectorNodes);
+   TR::Node *createLimitNode(VectorizableLoop *info);
+   TR::Node *createAliasCheck(VectorizableLoop *info, ArrayAccess *store, ArrayAccess *access);
+   };
+
+#endif
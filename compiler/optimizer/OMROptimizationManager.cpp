@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corp. and others
+ * Copyright (c) 2000, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -192,6 +192,9 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
       case OMR::prefetchInsertion:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
+      case OMR::loopVectorization:
+         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         break;
       case OMR::osrDefAnalysis:
          if (self()->comp()->getOption(TR_DisableOSRSharedSlots))
             _flags.set(doesNotRequireAliasSets | doesNotRequireTreeDumps | supportsIlGenOptLevel);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corp. and others
+ * Copyright (c) 2000, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -106,7 +106,9 @@ class OMR_EXTENSIBLE CodeCacheConfig
          _doSanityChecks(false),
          _codeCacheFreeBlockRecylingEnabled(false),
          _emitExecutableELF(false),
-         _emitRelocatableELF(false)
+         _emitRelocatableELF(false),
+         _emitPerfJitDump(false),
+         _persistentCodeCacheDir(NULL)
       {
       #if defined(J9ZOS390)     // EBCDIC
       _warmEyeCatcher[0] = '\xD1';
@@ -176,6 +178,8 @@ class OMR_EXTENSIBLE CodeCacheConfig
 
    bool emitExecutableELF() const { return _emitExecutableELF; }
    bool emitRelocatableELF() const { return _emitRelocatableELF; }
+   bool emitPerfJitDump() const { return _emitPerfJitDump; }
+   const char *persistentCodeCacheDir() const { return _persistentCodeCacheDir; }
 
    int32_t _trampolineCodeSize;          /*!< size of the trampoline code in bytes */
    int32_t _CCPreLoadedCodeSize;         /*!< size of the pre-Loaded CodeCache Helpers code in bytes */
@@ -206,6 +210,8 @@ class OMR_EXTENSIBLE CodeCacheConfig
 
    bool _emitExecutableELF;                  /*!< emit code cache as ELF object on shutdown */
    bool _emitRelocatableELF;
+   bool _emitPerfJitDump;                    /*!< record compiled code in a jitdump file for perf inject */
+   const char *_persistentCodeCacheDir;      /*!< directory compiled bodies are reused from across runs, NULL if none */
 
    char * const warmEyeCatcher() { return _warmEyeCatcher; }
 
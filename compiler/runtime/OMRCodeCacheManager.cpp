@@ -49,6 +49,8 @@
 #include <elf.h>
 #include <unistd.h>
 #include "codegen/ELFGenerator.hpp"
+#include "runtime/PerfJitDump.hpp"
+#include "runtime/PersistentCodeCache.hpp"
 
 TR::CodeCacheSymbolContainer * OMR::CodeCacheManager::_symbolContainer = NULL;
 
@@ -96,6 +98,8 @@ OMR::CodeCacheManager::initialize(
 #if (HOST_OS == OMR_LINUX)
    _elfRelocatableGenerator = NULL;
    _elfExecutableGenerator = NULL;
+   _perfJitDump = NULL;
+   _persistentCodeCache = NULL;
 
    if (_symbolContainer == NULL){
          TR::CodeCacheSymbolContainer * symbolContainer = static_cast<TR::CodeCacheSymbolContainer *>(self()->getMemory(sizeof(TR::CodeCacheSymbolContainer)));
@@ -171,6 +175,13 @@ OMR::CodeCacheManager::initialize(
 
    _lowCodeCacheSpaceThresholdReached = false;
 
+#if (HOST_OS == OMR_LINUX)
+   if (config.emitPerfJitDump())
+      _perfJitDump = TR::PerfJitDump::create(_rawAllocator);
+   if (config.persistentCodeCacheDir())
+      _persistentCodeCache = TR::PersistentCodeCache::create(_rawAllocator, config.persistentCodeCacheDir());
+#endif // HOST_OS == OMR_LINUX
+
    _initialized = true;
 
    int32_t cachesCreatedOnInit = std::min<int32_t>(config.maxNumberOfCodeCaches(), numberOfCodeCachesToCreateAtStartup);
@@ -223,6 +234,18 @@ OMR::CodeCacheManager::destroy()
                               "Failed to write code cache symbols to relocatable ELF file.");
       }
    }
+
+   if (_perfJitDump)
+      {
+      _perfJitDump->destroy();
+      _perfJitDump = NULL;
+      }
+
+   if (_persistentCodeCache)
+      {
+      _persistentCodeCache->destroy();
+      _persistentCodeCache = NULL;
+      }
 #endif // HOST_OS == OMR_LINUX
 
    TR::CodeCache *codeCache = self()->getFirstCodeCache();
@@ -54,6 +54,8 @@ namespace OMR { typedef CodeCacheManager CodeCacheManagerConnector; }
 
 namespace TR { class ELFRelocatableGenerator; }
 namespace TR { class ELFExecutableGenerator; }
+namespace TR { class PerfJitDump; }
+namespace TR { class PersistentCodeCache; }
 
 namespace TR {
 
@@ -361,10 +363,24 @@ protected:
    */
    void initializeExecutableELFGenerator(void);
 
+   /**
+    * @return the jitdump writer compiled code is recorded with, NULL unless
+    *         the option is enabled and the file could be created
+    */
+   TR::PerfJitDump *perfJitDump() { return _perfJitDump; }
+
+   /**
+    * @return the directory of bodies compiled by earlier runs, NULL unless the
+    *         option is enabled and the directory could be opened
+    */
+   TR::PersistentCodeCache *persistentCodeCache() { return _persistentCodeCache; }
+
    protected:
 
    TR::ELFExecutableGenerator      *_elfExecutableGenerator; /**< Executable ELF generator */
    TR::ELFRelocatableGenerator     *_elfRelocatableGenerator; /**< Relocatable ELF generator */
+   TR::PerfJitDump                 *_perfJitDump; /**< jitdump writer for perf inject */
+   TR::PersistentCodeCache         *_persistentCodeCache; /**< bodies reused across runs */
 
    // collect information on code cache symbols here, will be post processed into the elf trailer structure
    static TR::CodeCacheSymbolContainer   *_symbolContainer; /**< Symbol container used for tracking CodeCacheSymbols.
@@ -0,0 +1,510 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if defined(LINUX)
+
+#include "runtime/PerfJitDump.hpp"
+
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <new>
+#include "env/CompilerEnv.hpp"
+#include "infra/Assert.hpp"
+
+namespace
+{
+
+// Record layouts, see tools/perf/Documentation/jitdump-specification.txt
+//
+const uint32_t JitDumpMagic = 0x4A695444;
+const uint32_t JitDumpVersion = 1;
+const uint32_t JitDumpHeaderSize = 40;
+
+const uint32_t JitCodeLoad = 0;
+const uint32_t JitCodeClose = 3;
+const uint32_t JitCodeDebugInfo = 2;
+const uint32_t JitCodeUnwindingInfo = 4;
+
+const uint32_t RecordHeaderSize = 16;
+const uint32_t CodeLoadFixedSize = RecordHeaderSize + 4 + 4 + 8 + 8 + 8 + 8;
+const uint32_t DebugInfoFixedSize = RecordHeaderSize + 8 + 8;
+const uint32_t DebugEntryFixedSize = 8 + 4 + 4;
+const uint32_t UnwindingInfoFixedSize = RecordHeaderSize + 8 + 8 + 8;
+
+// .eh_frame pieces: a CIE with augmentation "zR" and no initial instructions,
+// one FDE, a zero terminator, then the 20 byte .eh_frame_hdr with a single
+// entry search table
+//
+const uint32_t CIESize = 24;
+const uint32_t FDEFixedSize = 4 + 4 + 4 + 4 + 1;
+const uint32_t EhFrameTerminatorSize = 4;
+const uint32_t EhFrameHdrSize = 20;
+
+const uint8_t DW_EH_PE_udata4 = 0x03;
+const uint8_t DW_EH_PE_sdata4 = 0x0b;
+const uint8_t DW_EH_PE_pcrel = 0x10;
+const uint8_t DW_EH_PE_datarel = 0x30;
+
+inline uint32_t align8(uint32_t size) { return (size + 7) & ~7u; }
+
+inline void put8(uint8_t *&cursor, uint8_t value) { *cursor++ = value; }
+inline void put32(uint8_t *&cursor, uint32_t value) { memcpy(cursor, &value, sizeof(value)); cursor += sizeof(value); }
+inline void put64(uint8_t *&cursor, uint64_t value) { memcpy(cursor, &value, sizeof(value)); cursor += sizeof(value); }
+
+inline void
+padTo(uint8_t *&cursor, uint8_t *start, uint32_t size)
+   {
+   memset(cursor, 0, size - (cursor - start));
+   cursor = start + size;
+   }
+
+void
+writeFully(int fd, const uint8_t *data, size_t size)
+   {
+   while (size > 0)
+      {
+      ssize_t written = write(fd, data, size);
+      if (written < 0)
+         {
+         if (errno == EINTR)
+            continue;
+         return;
+         }
+      data += written;
+      size -= written;
+      }
+   }
+
+uint32_t
+elfMachine()
+   {
+   TR::CPU &cpu = TR::Compiler->target.cpu;
+   if (cpu.isX86())
+      return TR::Compiler->target.is64Bit() ? EM_X86_64 : EM_386;
+   if (cpu.isPower())
+      return TR::Compiler->target.is64Bit() ? EM_PPC64 : EM_PPC;
+   if (cpu.isZ())
+      return EM_S390;
+   if (cpu.isARM64())
+      return EM_AARCH64;
+   if (cpu.isARM())
+      return EM_ARM;
+   return EM_NONE;
+   }
+
+}
+
+TR::PerfJitDump *
+TR::PerfJitDump::create(TR::RawAllocator rawAllocator)
+   {
+   char fileName[64];
+   pid_t pid = getpid();
+   snprintf(fileName, sizeof(fileName), "/tmp/jit-%d.dump", pid);
+
+   int fd = open(fileName, O_CREAT | O_TRUNC | O_RDWR, 0666);
+   if (fd < 0)
+      return NULL;
+
+   uint8_t header[JitDumpHeaderSize];
+   uint8_t *cursor = header;
+   put32(cursor, JitDumpMagic);
+   put32(cursor, JitDumpVersion);
+   put32(cursor, JitDumpHeaderSize);
+   put32(cursor, elfMachine());
+   put32(cursor, 0);
+   put32(cursor, pid);
+   put64(cursor, timestamp());
+   put64(cursor, 0);
+   writeFully(fd, header, sizeof(header));
+
+   // perf record only notices the file through an executable mapping of it
+   //
+   size_t markerSize = sysconf(_SC_PAGESIZE);
+   void *marker = mmap(NULL, markerSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+   if (marker == MAP_FAILED)
+      {
+      close(fd);
+      return NULL;
+      }
+
+   PerfJitDump *dump = new (rawAllocator, std::nothrow) PerfJitDump(rawAllocator, fd, marker, markerSize);
+   if (dump == NULL)
+      {
+      munmap(marker, markerSize);
+      close(fd);
+      return NULL;
+      }
+
+   if (!dump->startWriter())
+      {
+      munmap(marker, markerSize);
+      close(fd);
+      dump->~PerfJitDump();
+      rawAllocator.deallocate(dump);
+      return NULL;
+      }
+
+   return dump;
+   }
+
+TR::PerfJitDump::PerfJitDump(TR::RawAllocator rawAllocator, int fd, void *marker, size_t markerSize) :
+   _rawAllocator(rawAllocator),
+   _fd(fd),
+   _marker(marker),
+   _markerSize(markerSize),
+   _codeIndex(0),
+   _shuttingDown(false),
+   _current(NULL),
+   _fullHead(NULL),
+   _fullTail(NULL)
+   {
+   }
+
+bool
+TR::PerfJitDump::startWriter()
+   {
+   if (pthread_mutex_init(&_mutex, NULL) != 0)
+      return false;
+
+   pthread_condattr_t condAttr;
+   pthread_condattr_init(&condAttr);
+   pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+   int rc = pthread_cond_init(&_writerWork, &condAttr);
+   pthread_condattr_destroy(&condAttr);
+   if (rc != 0)
+      {
+      pthread_mutex_destroy(&_mutex);
+      return false;
+      }
+
+   if (pthread_create(&_writer, NULL, writerThread, this) != 0)
+      {
+      pthread_cond_destroy(&_writerWork);
+      pthread_mutex_destroy(&_mutex);
+      return false;
+      }
+
+   return true;
+   }
+
+void
+TR::PerfJitDump::destroy()
+   {
+   pthread_mutex_lock(&_mutex);
+   uint8_t *cursor = reserve(RecordHeaderSize);
+   if (cursor)
+      appendRecordHeader(cursor, JitCodeClose, RecordHeaderSize, timestamp());
+   _shuttingDown = true;
+   pthread_cond_signal(&_writerWork);
+   pthread_mutex_unlock(&_mutex);
+
+   pthread_join(_writer, NULL);
+   pthread_cond_destroy(&_writerWork);
+   pthread_mutex_destroy(&_mutex);
+
+   munmap(_marker, _markerSize);
+   close(_fd);
+
+   TR::RawAllocator rawAllocator(_rawAllocator);
+   this->~PerfJitDump();
+   rawAllocator.deallocate(this);
+   }
+
+void *
+TR::PerfJitDump::writerThread(void *dump)
+   {
+   static_cast<TR::PerfJitDump *>(dump)->writeBuffers();
+   return NULL;
+   }
+
+void
+TR::PerfJitDump::writeBuffers()
+   {
+   pthread_mutex_lock(&_mutex);
+   while (true)
+      {
+      if (_fullHead == NULL)
+         {
+         if (!_shuttingDown)
+            {
+            struct timespec deadline;
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += FlushIntervalMillis / 1000;
+            deadline.tv_nsec += (FlushIntervalMillis % 1000) * 1000000;
+            if (deadline.tv_nsec >= 1000000000)
+               {
+               deadline.tv_sec += 1;
+               deadline.tv_nsec -= 1000000000;
+               }
+            pthread_cond_timedwait(&_writerWork, &_mutex, &deadline);
+            }
+
+         // Nothing filled up for a while, or the dump is closing: write out
+         // what has been collected so far
+         //
+         if (_fullHead == NULL && _current != NULL && _current->_used != 0)
+            {
+            _fullHead = _fullTail = _current;
+            _current = NULL;
+            }
+         }
+
+      Buffer *buffers = _fullHead;
+      _fullHead = _fullTail = NULL;
+      if (buffers == NULL && _shuttingDown)
+         break;
+
+      pthread_mutex_unlock(&_mutex);
+      while (buffers)
+         {
+         Buffer *next = buffers->_next;
+         writeFully(_fd, buffers->data(), buffers->_used);
+         _rawAllocator.deallocate(buffers);
+         buffers = next;
+         }
+      pthread_mutex_lock(&_mutex);
+      }
+
+   if (_current)
+      {
+      _rawAllocator.deallocate(_current);
+      _current = NULL;
+      }
+   pthread_mutex_unlock(&_mutex);
+   }
+
+/**
+ * Make room for size bytes of records in the current buffer, handing the buffer
+ * to the writer thread and starting a new one if it is too full.  Must be
+ * called with the mutex held.
+ * @return the space, or NULL if no buffer could be allocated
+ */
+uint8_t *
+TR::PerfJitDump::reserve(uint32_t size)
+   {
+   if (_current && _current->_size - _current->_used >= size)
+      {
+      uint8_t *space = _current->data() + _current->_used;
+      _current->_used += size;
+      return space;
+      }
+
+   if (_current)
+      {
+      if (_fullTail)
+         _fullTail->_next = _current;
+      else
+         _fullHead = _current;
+      _fullTail = _current;
+      _current = NULL;
+      pthread_cond_signal(&_writerWork);
+      }
+
+   uint32_t bufferSize = size > BufferSize ? size : BufferSize;
+   _current = static_cast<Buffer *>(_rawAllocator.allocate(sizeof(Buffer) + bufferSize, std::nothrow));
+   if (_current == NULL)
+      return NULL;
+   _current->_next = NULL;
+   _current->_size = bufferSize;
+   _current->_used = size;
+   return _current->data();
+   }
+
+void
+TR::PerfJitDump::appendRecordHeader(uint8_t *&cursor, uint32_t id, uint32_t totalSize, uint64_t timestamp)
+   {
+   put32(cursor, id);
+   put32(cursor, totalSize);
+   put64(cursor, timestamp);
+   }
+
+void
+TR::PerfJitDump::writeCodeLoad(
+      const char *name,
+      uint8_t *code,
+      uint32_t codeSize,
+      const LineEntry *lines,
+      uint32_t numLines,
+      const CallFrameInfo *frameInfo)
+   {
+   // The padding bytes are copied from the code cache along with the code
+   //
+   codeSize = align8(codeSize);
+   uint32_t nameLength = strlen(name) + 1;
+   uint32_t loadSize = align8(CodeLoadFixedSize + nameLength + codeSize);
+
+   uint32_t debugInfoSize = 0;
+   if (lines && numLines != 0)
+      {
+      debugInfoSize = DebugInfoFixedSize;
+      for (uint32_t i = 0; i < numLines; i++)
+         debugInfoSize += DebugEntryFixedSize + strlen(lines[i].fileName) + 1;
+      debugInfoSize = align8(debugInfoSize);
+      }
+
+   uint32_t unwindingInfoSize = 0;
+   if (frameInfo && frameInfo->size != 0)
+      {
+      uint32_t ehFrameSize = CIESize + align8(FDEFixedSize + frameInfo->size) + EhFrameTerminatorSize;
+      unwindingInfoSize = align8(UnwindingInfoFixedSize + ehFrameSize + EhFrameHdrSize);
+      }
+
+   uint64_t now = timestamp();
+   uint32_t tid = syscall(SYS_gettid);
+
+   // perf attaches debug and unwinding records to the code load that follows
+   // them, so the three are appended in one go to keep other compilation
+   // threads from interleaving their records
+   //
+   pthread_mutex_lock(&_mutex);
+   uint8_t *cursor = reserve(debugInfoSize + unwindingInfoSize + loadSize);
+   if (cursor)
+      {
+      if (debugInfoSize != 0)
+         {
+         appendDebugInfo(cursor, code, lines, numLines, debugInfoSize, now);
+         cursor += debugInfoSize;
+         }
+
+      if (unwindingInfoSize != 0)
+         {
+         appendUnwindingInfo(cursor, codeSize, frameInfo, unwindingInfoSize, now);
+         cursor += unwindingInfoSize;
+         }
+
+      uint8_t *record = cursor;
+      appendRecordHeader(cursor, JitCodeLoad, loadSize, now);
+      put32(cursor, getpid());
+      put32(cursor, tid);
+      put64(cursor, reinterpret_cast<uintptr_t>(code));
+      put64(cursor, reinterpret_cast<uintptr_t>(code));
+      put64(cursor, codeSize);
+      put64(cursor, _codeIndex++);
+      memcpy(cursor, name, nameLength);
+      cursor += nameLength;
+      memcpy(cursor, code, codeSize);
+      cursor += codeSize;
+      padTo(cursor, record, loadSize);
+      }
+   pthread_mutex_unlock(&_mutex);
+   }
+
+void
+TR::PerfJitDump::appendDebugInfo(uint8_t *cursor, uint8_t *code, const LineEntry *lines, uint32_t numLines, uint32_t recordSize, uint64_t timestamp)
+   {
+   uint8_t *record = cursor;
+   appendRecordHeader(cursor, JitCodeDebugInfo, recordSize, timestamp);
+   put64(cursor, reinterpret_cast<uintptr_t>(code));
+   put64(cursor, numLines);
+   for (uint32_t i = 0; i < numLines; i++)
+      {
+      put64(cursor, reinterpret_cast<uintptr_t>(lines[i].address));
+      put32(cursor, lines[i].line);
+      put32(cursor, lines[i].discriminator);
+      uint32_t fileNameLength = strlen(lines[i].fileName) + 1;
+      memcpy(cursor, lines[i].fileName, fileNameLength);
+      cursor += fileNameLength;
+      }
+   padTo(cursor, record, recordSize);
+   }
+
+/**
+ * The unwinding data is an .eh_frame section followed by its .eh_frame_hdr.
+ * perf inject lays the sections out right after the code, 8 byte aligned, and
+ * every pointer below is encoded relative to that layout.
+ */
+void
+TR::PerfJitDump::appendUnwindingInfo(uint8_t *cursor, uint32_t codeSize, const CallFrameInfo *frameInfo, uint32_t recordSize, uint64_t timestamp)
+   {
+   TR_ASSERT(frameInfo->dataAlignmentFactor >= -64 && frameInfo->dataAlignmentFactor < 64, "data alignment factor must fit a single byte SLEB128");
+   TR_ASSERT(frameInfo->returnAddressRegister < 128, "return address register must fit a single byte ULEB128");
+
+   const uint32_t fdeSize = align8(FDEFixedSize + frameInfo->size);
+   const uint32_t ehFrameSize = CIESize + fdeSize + EhFrameTerminatorSize;
+   const uint32_t unwindingSize = ehFrameSize + EhFrameHdrSize;
+
+   uint8_t *record = cursor;
+   appendRecordHeader(cursor, JitCodeUnwindingInfo, recordSize, timestamp);
+   put64(cursor, unwindingSize);
+   put64(cursor, EhFrameHdrSize);
+   put64(cursor, unwindingSize);
+
+   // CIE
+   //
+   uint8_t *cie = cursor;
+   put32(cursor, CIESize - 4);
+   put32(cursor, 0);
+   put8(cursor, 1);
+   put8(cursor, 'z');
+   put8(cursor, 'R');
+   put8(cursor, 0);
+   put8(cursor, 1);
+   put8(cursor, frameInfo->dataAlignmentFactor & 0x7f);
+   put8(cursor, frameInfo->returnAddressRegister);
+   put8(cursor, 1);
+   put8(cursor, DW_EH_PE_pcrel | DW_EH_PE_sdata4);
+   padTo(cursor, cie, CIESize);
+
+   // FDE covering the whole region
+   //
+   uint8_t *fde = cursor;
+   put32(cursor, fdeSize - 4);
+   put32(cursor, CIESize + 4);
+   put32(cursor, -(int32_t)(codeSize + CIESize + 8));
+   put32(cursor, codeSize);
+   put8(cursor, 0);
+   memcpy(cursor, frameInfo->instructions, frameInfo->size);
+   cursor += frameInfo->size;
+   padTo(cursor, fde, fdeSize);
+
+   put32(cursor, 0);
+
+   // .eh_frame_hdr
+   //
+   put8(cursor, 1);
+   put8(cursor, DW_EH_PE_pcrel | DW_EH_PE_sdata4);
+   put8(cursor, DW_EH_PE_udata4);
+   put8(cursor, DW_EH_PE_datarel | DW_EH_PE_sdata4);
+   put32(cursor, -(int32_t)(ehFrameSize + 4));
+   put32(cursor, 1);
+   put32(cursor, -(int32_t)(codeSize + ehFrameSize));
+   put32(cursor, -(int32_t)(ehFrameSize - CIESize));
+
+   padTo(cursor, record, recordSize);
+   }
+
+uint64_t
+TR::PerfJitDump::timestamp()
+   {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+   }
+
+#endif // defined(LINUX)
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef PERFJITDUMP_HPP
+#define PERFJITDUMP_HPP
+
+#if defined(LINUX)
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "env/RawAllocator.hpp"
+
+namespace TR
+{
+
+/**
+ * Writes the jitdump file read by `perf inject --jit`, which turns the records
+ * into one ELF image per compiled body so that samples in JIT code resolve to
+ * symbols, source lines and unwind tables.  The file is /tmp/jit-<pid>.dump and
+ * programs must be recorded with `perf record -k mono` for the timestamps of
+ * the records to match the samples.
+ *
+ * Records are appended to in-memory buffers by the compilation threads and
+ * written to the file by a background thread, so emitting a record costs a
+ * copy under a lock and never a system call.  Buffers that are only partially
+ * filled are written out after at most FlushIntervalMillis.
+ */
+class PerfJitDump
+   {
+public:
+
+   /**
+    * A row of the line table of a code region: the code from address up to the
+    * address of the next entry was generated for the given line of fileName.
+    */
+   struct LineEntry
+      {
+      uint8_t *address;
+      uint32_t line;
+      uint32_t discriminator;
+      const char *fileName;
+      };
+
+   /**
+    * DWARF call frame information of a code region.  The instructions start
+    * from an empty state at the first byte of the region, so they must define
+    * the CFA and the location of the return address themselves.
+    */
+   struct CallFrameInfo
+      {
+      uint8_t returnAddressRegister;  ///< DWARF number of the return address column
+      int8_t dataAlignmentFactor;     ///< factor applied to DW_CFA_offset operands
+      const uint8_t *instructions;
+      uint32_t size;
+      };
+
+   /**
+    * @brief Opens the jitdump file, writes its header and starts the writer thread
+    * @return the writer, or NULL if the file could not be set up
+    */
+   static PerfJitDump *create(TR::RawAllocator rawAllocator);
+
+   /**
+    * @brief Writes the close record, waits for every buffered record to reach
+    *        the file and frees the writer
+    */
+   void destroy();
+
+   /**
+    * @brief Records the code region [code, code + codeSize) under the given name
+    *
+    * A copy of the code is taken, so the region may be patched or reused
+    * afterwards.  The size is rounded up to a multiple of 8 since perf places the
+    * unwind tables of the region right after it, 8 byte aligned.
+    *
+    * @param[in] lines the line table of the region sorted by address, may be NULL
+    * @param[in] frameInfo how to unwind the frame of the region, may be NULL
+    */
+   void writeCodeLoad(
+      const char *name,
+      uint8_t *code,
+      uint32_t codeSize,
+      const LineEntry *lines,
+      uint32_t numLines,
+      const CallFrameInfo *frameInfo);
+
+private:
+
+   static const uint32_t BufferSize = 256 * 1024;
+   static const uint32_t FlushIntervalMillis = 1000;
+
+   struct Buffer
+      {
+      Buffer *_next;
+      uint32_t _size;
+      uint32_t _used;
+      uint8_t *data() { return reinterpret_cast<uint8_t *>(this + 1); }
+      };
+
+   PerfJitDump(TR::RawAllocator rawAllocator, int fd, void *marker, size_t markerSize);
+
+   bool startWriter();
+   static void *writerThread(void *dump);
+   void writeBuffers();
+
+   uint8_t *reserve(uint32_t size);
+   static void appendRecordHeader(uint8_t *&cursor, uint32_t id, uint32_t totalSize, uint64_t timestamp);
+   static void appendDebugInfo(uint8_t *cursor, uint8_t *code, const LineEntry *lines, uint32_t numLines, uint32_t recordSize, uint64_t timestamp);
+   static void appendUnwindingInfo(uint8_t *cursor, uint32_t codeSize, const CallFrameInfo *frameInfo, uint32_t recordSize, uint64_t timestamp);
+
+   static uint64_t timestamp();
+
+   TR::RawAllocator _rawAllocator;
+   int _fd;
+   void *_marker;                 ///< executable mapping of the file header perf record looks for
+   size_t _markerSize;
+   uint64_t _codeIndex;
+
+   pthread_mutex_t _mutex;        ///< protects the buffer lists and the code index
+   pthread_cond_t _writerWork;
+   pthread_t _writer;
+   bool _shuttingDown;
+   Buffer *_current;              ///< buffer records are appended to
+   Buffer *_fullHead;             ///< buffers waiting for the writer thread, oldest first
+   Buffer *_fullTail;
+   };
+
+}
+
+#endif // defined(LINUX)
+
+#endif // PERFJITDUMP_HPP
@@ -0,0 +1,797 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if defined(LINUX)
+
+#include "runtime/PersistentCodeCache.hpp"
+
+#include <dirent.h>
+#include <errno.h>
+#include <link.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <algorithm>
+#include <new>
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Relocation.hpp"
+#include "codegen/StaticRelocation.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "il/Block.hpp"
+#include "il/MethodSymbol.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/ILWalk.hpp"
+#include "infra/List.hpp"
+#include "omrformatconsts.h"
+#include "runtime/Runtime.hpp"
+
+namespace
+{
+
+inline void put8(TR::vector<uint8_t> &key, uint8_t value) { key.push_back(value); }
+
+inline void
+putBytes(TR::vector<uint8_t> &key, const void *data, size_t size)
+   {
+   const uint8_t *bytes = static_cast<const uint8_t *>(data);
+   key.insert(key.end(), bytes, bytes + size);
+   }
+
+inline void put32(TR::vector<uint8_t> &key, uint32_t value) { putBytes(key, &value, sizeof(value)); }
+inline void put64(TR::vector<uint8_t> &key, uint64_t value) { putBytes(key, &value, sizeof(value)); }
+
+inline void
+putString(TR::vector<uint8_t> &key, const char *string)
+   {
+   uint32_t length = string ? strlen(string) : 0;
+   put32(key, length);
+   putBytes(key, string, length);
+   }
+
+inline void
+appendBytes(uint8_t *&cursor, const void *data, size_t size)
+   {
+   memcpy(cursor, data, size);
+   cursor += size;
+   }
+
+inline void
+appendString(uint8_t *&cursor, const char *string)
+   {
+   uint32_t length = string ? strlen(string) : 0;
+   appendBytes(cursor, &length, sizeof(length));
+   appendBytes(cursor, string, length);
+   }
+
+/**
+ * FNV-1a, only used to name entries since the whole key is compared on load
+ */
+uint64_t
+hashKey(const TR::vector<uint8_t> &key, size_t size)
+   {
+   uint64_t hash = 0xcbf29ce484222325ULL;
+   for (size_t i = 0; i < size; i++)
+      {
+      hash ^= key[i];
+      hash *= 0x100000001b3ULL;
+      }
+   return hash;
+   }
+
+struct ObjectSearch
+   {
+   uintptr_t address;           ///< an address in the object looked for
+   const char *fileName;        ///< file of the object, NULL until found
+   const uint8_t *buildId;      ///< GNU build ID of the object, NULL if it has none
+   size_t buildIdSize;
+   };
+
+int
+findObject(struct dl_phdr_info *info, size_t size, void *data)
+   {
+   ObjectSearch *search = static_cast<ObjectSearch *>(data);
+   bool contains = false;
+   for (ElfW(Half) i = 0; i < info->dlpi_phnum && !contains; i++)
+      {
+      const ElfW(Phdr) &header = info->dlpi_phdr[i];
+      uintptr_t start = info->dlpi_addr + header.p_vaddr;
+      contains = header.p_type == PT_LOAD && search->address >= start && search->address - start < header.p_memsz;
+      }
+   if (!contains)
+      return 0;
+
+   // The main program has no name
+   //
+   search->fileName = info->dlpi_name[0] != '\0' ? info->dlpi_name : "/proc/self/exe";
+
+   for (ElfW(Half) i = 0; i < info->dlpi_phnum; i++)
+      {
+      const ElfW(Phdr) &header = info->dlpi_phdr[i];
+      if (header.p_type != PT_NOTE)
+         continue;
+
+      const uint8_t *note = reinterpret_cast<const uint8_t *>(info->dlpi_addr + header.p_vaddr);
+      const uint8_t *notesEnd = note + header.p_memsz;
+      while (note + sizeof(ElfW(Nhdr)) <= notesEnd)
+         {
+         const ElfW(Nhdr) *noteHeader = reinterpret_cast<const ElfW(Nhdr) *>(note);
+         const uint8_t *name = note + sizeof(ElfW(Nhdr));
+         const uint8_t *desc = name + ((noteHeader->n_namesz + 3) & ~3);
+         note = desc + ((noteHeader->n_descsz + 3) & ~3);
+         if (note > notesEnd)
+            break;
+         if (noteHeader->n_type == NT_GNU_BUILD_ID && noteHeader->n_namesz == 4 && memcmp(name, "GNU", 4) == 0)
+            {
+            search->buildId = desc;
+            search->buildIdSize = noteHeader->n_descsz;
+            return 1;
+            }
+         }
+      }
+   return 1;
+   }
+
+/**
+ * Identifies the build of the JIT by the GNU build ID of the object it is
+ * linked into, or by the file of that object if it was linked without one
+ *
+ * @return the size of the identity written to buffer, 0 if the object cannot
+ *         be identified
+ */
+size_t
+buildIdentity(uint8_t *buffer, size_t bufferSize)
+   {
+   ObjectSearch search = { reinterpret_cast<uintptr_t>(&buildIdentity), NULL, NULL, 0 };
+   dl_iterate_phdr(findObject, &search);
+   if (search.fileName == NULL)
+      return 0;
+
+   // Build IDs are hashes, so a prefix of a longer one still tells builds apart
+   //
+   if (search.buildId != NULL && search.buildIdSize > 0)
+      {
+      size_t size = std::min(search.buildIdSize, bufferSize);
+      memcpy(buffer, search.buildId, size);
+      return size;
+      }
+
+   struct stat status;
+   if (stat(search.fileName, &status) != 0)
+      return 0;
+   uint64_t identity[] =
+      {
+      (uint64_t)status.st_dev,
+      (uint64_t)status.st_ino,
+      (uint64_t)status.st_size,
+      (uint64_t)status.st_mtim.tv_sec,
+      (uint64_t)status.st_mtim.tv_nsec,
+      };
+   size_t size = std::min(sizeof(identity), bufferSize);
+   memcpy(buffer, identity, size);
+   return size;
+   }
+
+bool
+writeFully(int fd, const void *data, size_t size)
+   {
+   const uint8_t *bytes = static_cast<const uint8_t *>(data);
+   while (size > 0)
+      {
+      ssize_t written = write(fd, bytes, size);
+      if (written < 0)
+         {
+         if (errno == EINTR)
+            continue;
+         return false;
+         }
+      bytes += written;
+      size -= written;
+      }
+   return true;
+   }
+
+/**
+ * Only the relocations of the AMD64 code generator are known to be covered by
+ * the relocation lists, the static relocations and the helper check the cache
+ * relies on.
+ */
+bool
+isSupportedTarget(TR::Compilation *comp)
+   {
+   return comp->target().cpu.isX86() && comp->target().is64Bit();
+   }
+
+const char *
+calleeName(TR::Compilation *comp, TR::Symbol *symbol)
+   {
+   return symbol->castToResolvedMethodSymbol()->getResolvedMethod()->externalName(comp->trMemory());
+   }
+
+bool
+serializeSymbolReference(TR::vector<uint8_t> &key, TR::Compilation *comp, TR::SymbolReference *symRef)
+   {
+   TR::Symbol *symbol = symRef->getSymbol();
+   put32(key, symRef->getReferenceNumber());
+   put64(key, symRef->getOffset());
+   put32(key, symbol->getFlags());
+   put32(key, symbol->getFlags2());
+   put64(key, symbol->getSize());
+
+   // The address of a static differs from run to run, and the body would
+   // embed it without a relocation
+   //
+   if (symbol->isStatic())
+      {
+      return false;
+      }
+   else if (symbol->isMethod())
+      {
+      TR::MethodSymbol *methodSymbol = symbol->castToMethodSymbol();
+      put32(key, methodSymbol->getMethodKind());
+      put32(key, methodSymbol->getLinkageConvention());
+
+      // Helpers are identified by their reference number.  Native functions
+      // are identified by name, their address is relocated on load.
+      //
+      if (!methodSymbol->isHelper())
+         {
+         if (!symbol->isResolvedMethod())
+            return false;
+         put8(key, methodSymbol->getMethodAddress() != NULL);
+         putString(key, calleeName(comp, symbol));
+         }
+      }
+   else if (symbol->isLabel())
+      {
+      return false;
+      }
+
+   return true;
+   }
+
+bool
+serializeNode(TR::vector<uint8_t> &key, TR::Compilation *comp, TR::Node *node, vcount_t visitCount)
+   {
+   // Commoned nodes are written once and referred to by their global index,
+   // which IL generation assigns in creation order
+   //
+   put32(key, node->getGlobalIndex());
+   if (node->getVisitCount() == visitCount)
+      {
+      put8(key, 0);
+      return true;
+      }
+   node->setVisitCount(visitCount);
+   put8(key, 1);
+
+   put32(key, node->getOpCodeValue());
+   put32(key, node->getDataType());
+   put32(key, node->getFlags().getValue());
+   put32(key, node->getNumChildren());
+
+   if (node->getOpCode().isLoadConst())
+      {
+      switch (node->getDataType())
+         {
+         case TR::Int8:
+         case TR::Int16:
+         case TR::Int32:
+         case TR::Int64:
+            put64(key, node->get64bitIntegralValue());
+            break;
+         case TR::Float:
+            put32(key, node->getFloatBits());
+            break;
+         case TR::Double:
+            put64(key, node->getDoubleBits());
+            break;
+         case TR::Address:
+            // Only NULL is the same in every run
+            if (node->getAddress() != 0)
+               return false;
+            put64(key, 0);
+            break;
+         default:
+            return false;
+         }
+      }
+
+   if (node->getOpCode().isCase())
+      put64(key, node->getCaseConstant());
+
+   if (node->getOpCodeValue() == TR::BBStart || node->getOpCodeValue() == TR::BBEnd)
+      {
+      TR::Block *block = node->getBlock();
+      put32(key, block->getNumber());
+      put32(key, block->getFrequency());
+      put8(key, block->isCold());
+      }
+
+   if (node->getOpCode().isBranch() || node->getOpCode().isCase())
+      put32(key, node->getBranchDestination()->getNode()->getBlock()->getNumber());
+
+   if (node->getOpCode().hasSymbolReference() && !serializeSymbolReference(key, comp, node->getSymbolReference()))
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!serializeNode(key, comp, node->getChild(i), visitCount))
+         return false;
+      }
+
+   return true;
+   }
+
+bool
+isEntryFileName(const char *name)
+   {
+   size_t length = strlen(name);
+   return length == 16 + strlen(".jit") && strcmp(name + 16, ".jit") == 0 && strspn(name, "0123456789abcdef") == 16;
+   }
+
+/**
+ * @return the address of the native function the IL of comp calls by name, NULL
+ *         if it calls no such function or several functions of that name
+ */
+void *
+findCallTarget(TR::Compilation *comp, const char *name)
+   {
+   void *target = NULL;
+   for (TR::PreorderNodeIterator it(comp->getStartTree(), comp); it.currentTree() != NULL; ++it)
+      {
+      TR::Node *node = it.currentNode();
+      if (!node->getOpCode().isCall() || !node->getSymbol()->isResolvedMethod())
+         continue;
+
+      void *address = node->getSymbol()->castToMethodSymbol()->getMethodAddress();
+      if (address == NULL || strcmp(calleeName(comp, node->getSymbol()), name) != 0)
+         continue;
+      if (target != NULL && target != address)
+         return NULL;
+      target = address;
+      }
+   return target;
+   }
+
+}
+
+TR::PersistentCodeCache::PersistentCodeCache(TR::RawAllocator rawAllocator, char *directory, uint8_t *environment, size_t environmentSize, size_t sizeLimit) :
+   _rawAllocator(rawAllocator),
+   _directory(directory),
+   _sizeLimit(sizeLimit),
+   _environment(environment),
+   _environmentSize(environmentSize)
+   {
+   }
+
+TR::PersistentCodeCache *
+TR::PersistentCodeCache::create(TR::RawAllocator rawAllocator, const char *directory)
+   {
+   // Bodies in a directory other users can write to could have been planted
+   // by them, and would run with the rights of this process
+   //
+   struct stat status;
+   if (stat(directory, &status) != 0
+       || !S_ISDIR(status.st_mode)
+       || status.st_uid != geteuid()
+       || (status.st_mode & (S_IWGRP | S_IWOTH)) != 0
+       || access(directory, W_OK | X_OK) != 0)
+      return NULL;
+
+   // Entries are only valid for the build of the JIT that stored them
+   //
+   uint8_t identity[64];
+   uint32_t identitySize = buildIdentity(identity, sizeof(identity));
+   if (identitySize == 0)
+      return NULL;
+
+   // Everything but the IL a body depends on is the same for the whole run
+   //
+   TR::Options *options = TR::Options::getCmdLineOptions();
+   TR::CPU &cpu = TR::Compiler->target.cpu;
+   OMRProcessorDesc processor = cpu.getProcessorDescription();
+   const char *startOptions = options->getStartOptions();
+   const char *envOptions = options->getEnvOptions();
+#if defined(TR_TARGET_X86)
+   const char *vendor = cpu.getX86ProcessorVendorId();
+   uint32_t features[] =
+      {
+      cpu.getX86ProcessorSignature(),
+      cpu.getX86ProcessorFeatureFlags(),
+      cpu.getX86ProcessorFeatureFlags2(),
+      cpu.getX86ProcessorFeatureFlags8(),
+      };
+#endif
+
+   size_t environmentSize = sizeof(EntryVersion) + sizeof(identitySize) + identitySize + 1 + sizeof(processor);
+   environmentSize += sizeof(uint32_t) + (startOptions ? strlen(startOptions) : 0);
+   environmentSize += sizeof(uint32_t) + (envOptions ? strlen(envOptions) : 0);
+#if defined(TR_TARGET_X86)
+   environmentSize += sizeof(uint32_t) + strlen(vendor) + sizeof(features);
+#endif
+
+   size_t directoryLength = strlen(directory);
+   char *buffer = static_cast<char *>(rawAllocator.allocate(directoryLength + 1 + environmentSize, std::nothrow));
+   if (buffer == NULL)
+      return NULL;
+   memcpy(buffer, directory, directoryLength + 1);
+
+   uint8_t *environment = reinterpret_cast<uint8_t *>(buffer + directoryLength + 1);
+   uint8_t *cursor = environment;
+   const uint32_t version = EntryVersion;
+   const uint8_t is64Bit = TR::Compiler->target.is64Bit();
+   appendBytes(cursor, &version, sizeof(version));
+   appendBytes(cursor, &identitySize, sizeof(identitySize));
+   appendBytes(cursor, identity, identitySize);
+   appendBytes(cursor, &is64Bit, sizeof(is64Bit));
+   appendBytes(cursor, &processor, sizeof(processor));
+   appendString(cursor, startOptions);
+   appendString(cursor, envOptions);
+#if defined(TR_TARGET_X86)
+   appendString(cursor, vendor);
+   appendBytes(cursor, features, sizeof(features));
+#endif
+
+   size_t sizeLimit = static_cast<size_t>(std::max(options->getPersistentCodeCacheSizeKB(), 0)) * 1024;
+   PersistentCodeCache *cache = new (rawAllocator, std::nothrow) PersistentCodeCache(rawAllocator, buffer, environment, environmentSize, sizeLimit);
+   if (cache == NULL)
+      rawAllocator.deallocate(buffer);
+   return cache;
+   }
+
+void
+TR::PersistentCodeCache::destroy()
+   {
+   TR::RawAllocator rawAllocator = _rawAllocator;
+   rawAllocator.deallocate(_directory);
+   this->~PersistentCodeCache();
+   rawAllocator.deallocate(this);
+   }
+
+void
+TR::PersistentCodeCache::entryFileName(char *buffer, size_t bufferSize, TR::Compilation *comp, const TR::vector<uint8_t> &key)
+   {
+   // The environment, signature, opt level and hotness at the start of the key
+   //
+   size_t nameKeySize = _environmentSize + sizeof(uint32_t) + strlen(comp->signature()) + 2 * sizeof(uint32_t);
+   snprintf(buffer, bufferSize, "%s/%016" OMR_PRIx64 ".jit", _directory, hashKey(key, nameKeySize));
+   }
+
+bool
+TR::PersistentCodeCache::computeKey(TR::Compilation *comp, TR::vector<uint8_t> &key)
+   {
+   if (!isSupportedTarget(comp))
+      return false;
+
+   key.clear();
+   putBytes(key, _environment, _environmentSize);
+   putString(key, comp->signature());
+   put32(key, comp->getOptLevel());
+   put32(key, comp->getMethodHotness());
+
+   TR::ResolvedMethodSymbol *methodSymbol = comp->getMethodSymbol();
+   put32(key, methodSymbol->getResolvedMethod()->returnType());
+   ListIterator<TR::ParameterSymbol> parameters(&methodSymbol->getParameterList());
+   for (TR::ParameterSymbol *parameter = parameters.getFirst(); parameter; parameter = parameters.getNext())
+      {
+      put32(key, parameter->getDataType());
+      put64(key, parameter->getSize());
+      }
+
+   vcount_t visitCount = comp->incOrResetVisitCount();
+   for (TR::TreeTop *tt = comp->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      if (!serializeNode(key, comp, tt->getNode(), visitCount))
+         return false;
+      }
+
+   return true;
+   }
+
+bool
+TR::PersistentCodeCache::load(TR::Compilation *comp, const TR::vector<uint8_t> &key)
+   {
+   char fileName[PATH_MAX];
+   entryFileName(fileName, sizeof(fileName), comp, key);
+
+   FILE *file = fopen(fileName, "rb");
+   if (file == NULL)
+      return false;
+
+   EntryHeader header;
+   uint8_t *payload = NULL;
+   size_t payloadSize = 0;
+   if (fread(&header, sizeof(header), 1, file) == 1
+       && header.magic == EntryMagic
+       && header.version == EntryVersion
+       && header.keySize == key.size()
+       && header.entryOffset < header.codeSize
+       && (header.numRelocations == 0 || header.codeSize >= sizeof(uint64_t)))
+      {
+      payloadSize = (size_t)header.keySize + header.codeSize + (size_t)header.numRelocations * sizeof(EntryRelocation) + header.symbolsSize;
+      payload = static_cast<uint8_t *>(comp->trMemory()->allocateHeapMemory(payloadSize));
+      if (fread(payload, 1, payloadSize, file) != payloadSize || fgetc(file) != EOF)
+         payload = NULL;
+      }
+   fclose(file);
+
+   if (payload == NULL || memcmp(payload, &key[0], key.size()) != 0)
+      return false;
+
+   const uint8_t *code = payload + header.keySize;
+   const uint8_t *relocationData = code + header.codeSize;
+   const char *symbols = reinterpret_cast<const char *>(relocationData + header.numRelocations * sizeof(EntryRelocation));
+   if (header.symbolsSize > 0 && symbols[header.symbolsSize - 1] != '\0')
+      return false;
+
+   // Resolve everything before taking code cache memory
+   //
+   EntryRelocation *relocations = static_cast<EntryRelocation *>(comp->trMemory()->allocateHeapMemory(header.numRelocations * sizeof(EntryRelocation) + 1));
+   void **symbolAddresses = static_cast<void **>(comp->trMemory()->allocateHeapMemory(header.numRelocations * sizeof(void *) + 1));
+   memcpy(relocations, relocationData, header.numRelocations * sizeof(EntryRelocation));
+   for (uint32_t i = 0; i < header.numRelocations; i++)
+      {
+      if (relocations[i].offset > header.codeSize - sizeof(uint64_t))
+         return false;
+      if (relocations[i].kind == SymbolAddress)
+         {
+         if (relocations[i].symbolOffset >= header.symbolsSize)
+            return false;
+         symbolAddresses[i] = findCallTarget(comp, symbols + relocations[i].symbolOffset);
+         if (symbolAddresses[i] == NULL)
+            return false;
+         }
+      else if (relocations[i].kind != BodyAddress)
+         {
+         return false;
+         }
+      }
+
+   TR::CodeGenerator *cg = comp->cg();
+   cg->reserveCodeCache();
+   uint8_t *coldCode = NULL;
+   uint8_t *body = cg->allocateCodeMemory(header.codeSize, 0, &coldCode);
+   cg->commitToCodeCache();
+
+   memcpy(body, code, header.codeSize);
+   for (uint32_t i = 0; i < header.numRelocations; i++)
+      {
+      uint64_t value;
+      memcpy(&value, body + relocations[i].offset, sizeof(value));
+      if (relocations[i].kind == BodyAddress)
+         value += reinterpret_cast<uintptr_t>(body);
+      else
+         value = reinterpret_cast<uintptr_t>(symbolAddresses[i]);
+      memcpy(body + relocations[i].offset, &value, sizeof(value));
+      }
+
+   cg->setBinaryBufferStart(body);
+   cg->setBinaryBufferCursor(body + header.codeSize);
+   cg->setPrePrologueSize(header.entryOffset);
+   cg->syncCode(body, header.codeSize);
+   comp->getMethodSymbol()->setMethodAddress(cg->getCodeStart());
+
+   // The modification time orders entries for eviction
+   //
+   utimes(fileName, NULL);
+
+   if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Loaded %s from %s at %p", comp->signature(), fileName, cg->getCodeStart());
+
+   return true;
+   }
+
+void
+TR::PersistentCodeCache::store(TR::Compilation *comp, const TR::vector<uint8_t> &key)
+   {
+   TR::CodeGenerator *cg = comp->cg();
+   TR_Memory *trMemory = comp->trMemory();
+
+   // Calls to runtime helpers are relative branches the cache does not relocate
+   //
+   TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+   for (int32_t i = 0; i < symRefTab->getNumHelperSymbols(); i++)
+      {
+      if (symRefTab->getSymRef(i) != NULL)
+         return;
+      }
+
+   // Switch tables are the only external relocations of JIT code, and their
+   // entries are also label relocations
+   //
+   auto &externalRelocations = cg->getExternalRelocationList();
+   for (auto it = externalRelocations.begin(); it != externalRelocations.end(); ++it)
+      {
+      if (static_cast<TR::ExternalRelocation *>(*it)->getTargetKind() != TR_AbsoluteMethodAddress)
+         return;
+      }
+
+   uint8_t *body = cg->getBinaryBufferStart();
+   const uint32_t codeSize = cg->getCodeEnd() - body;
+   auto &labelRelocations = cg->getRelocationList();
+   auto &staticRelocations = cg->getStaticRelocations();
+
+   uint32_t numRelocations = 0;
+   uint32_t symbolsSize = 0;
+   for (auto it = labelRelocations.begin(); it != labelRelocations.end(); ++it)
+      {
+      if ((*it)->isLabelAbsoluteRelocation())
+         numRelocations++;
+      }
+   for (auto it = staticRelocations.begin(); it != staticRelocations.end(); ++it)
+      {
+      if (it->type() != TR::StaticRelocationType::Absolute || it->size() != TR::StaticRelocationSize::word64 || it->symbol() == NULL)
+         return;
+      numRelocations++;
+      symbolsSize += strlen(it->symbol()) + 1;
+      }
+
+   uint8_t *code = static_cast<uint8_t *>(trMemory->allocateHeapMemory(codeSize));
+   EntryRelocation *relocations = static_cast<EntryRelocation *>(trMemory->allocateHeapMemory(numRelocations * sizeof(EntryRelocation) + 1));
+   char *symbols = static_cast<char *>(trMemory->allocateHeapMemory(symbolsSize + 1));
+   memcpy(code, body, codeSize);
+
+   uint32_t numWritten = 0;
+   for (auto it = labelRelocations.begin(); it != labelRelocations.end(); ++it)
+      {
+      if (!(*it)->isLabelAbsoluteRelocation())
+         continue;
+
+      uint8_t *location = (*it)->getUpdateLocation();
+      if (location < body || location + sizeof(uint64_t) > body + codeSize)
+         return;
+
+      uint64_t value;
+      memcpy(&value, location, sizeof(value));
+      value -= reinterpret_cast<uintptr_t>(body);
+      if (value >= codeSize)
+         return;
+      memcpy(code + (location - body), &value, sizeof(value));
+
+      EntryRelocation relocation = { static_cast<uint32_t>(location - body), BodyAddress, 0, 0 };
+      relocations[numWritten++] = relocation;
+      }
+
+   uint32_t symbolOffset = 0;
+   for (auto it = staticRelocations.begin(); it != staticRelocations.end(); ++it)
+      {
+      uint8_t *location = it->location();
+      if (location < body || location + sizeof(uint64_t) > body + codeSize)
+         return;
+
+      memset(code + (location - body), 0, sizeof(uint64_t));
+      strcpy(symbols + symbolOffset, it->symbol());
+
+      EntryRelocation relocation = { static_cast<uint32_t>(location - body), SymbolAddress, symbolOffset, 0 };
+      relocations[numWritten++] = relocation;
+      symbolOffset += strlen(it->symbol()) + 1;
+      }
+
+   // Any address of the body left in the copy was written by something the
+   // relocation lists do not describe
+   //
+   for (uint32_t offset = 0; offset + sizeof(uint64_t) <= codeSize; offset++)
+      {
+      uint64_t value;
+      memcpy(&value, code + offset, sizeof(value));
+      if (value >= reinterpret_cast<uintptr_t>(body) && value < reinterpret_cast<uintptr_t>(body) + codeSize)
+         return;
+      }
+
+   EntryHeader header;
+   header.magic = EntryMagic;
+   header.version = EntryVersion;
+   header.keySize = key.size();
+   header.codeSize = codeSize;
+   header.entryOffset = cg->getCodeStart() - body;
+   header.numRelocations = numRelocations;
+   header.symbolsSize = symbolsSize;
+   header.reserved = 0;
+
+   char fileName[PATH_MAX];
+   char tempFileName[PATH_MAX];
+   entryFileName(fileName, sizeof(fileName), comp, key);
+   if (snprintf(tempFileName, sizeof(tempFileName), "%s.XXXXXX", fileName) >= (int)sizeof(tempFileName))
+      return;
+
+   int fd = mkstemp(tempFileName);
+   if (fd < 0)
+      return;
+
+   bool written = writeFully(fd, &header, sizeof(header))
+      && writeFully(fd, &key[0], key.size())
+      && writeFully(fd, code, codeSize)
+      && writeFully(fd, relocations, numRelocations * sizeof(EntryRelocation))
+      && writeFully(fd, symbols, symbolsSize);
+   written = (close(fd) == 0) && written;
+
+   if (!written || rename(tempFileName, fileName) != 0)
+      {
+      unlink(tempFileName);
+      return;
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Stored %s in %s", comp->signature(), fileName);
+
+   evict(comp);
+   }
+
+void
+TR::PersistentCodeCache::evict(TR::Compilation *comp)
+   {
+   DIR *directory = opendir(_directory);
+   if (directory == NULL)
+      return;
+
+   TR::vector<EntryFile> entries(getTypedAllocator<EntryFile>(comp->allocator()));
+   size_t totalSize = 0;
+   for (struct dirent *dirEntry = readdir(directory); dirEntry != NULL; dirEntry = readdir(directory))
+      {
+      struct stat status;
+      if (!isEntryFileName(dirEntry->d_name) || fstatat(dirfd(directory), dirEntry->d_name, &status, 0) != 0)
+         continue;
+
+      EntryFile entry;
+      entry.lastUsed = (uint64_t)status.st_mtim.tv_sec * 1000000000 + status.st_mtim.tv_nsec;
+      entry.size = status.st_size;
+      strcpy(entry.name, dirEntry->d_name);
+      entries.push_back(entry);
+      totalSize += entry.size;
+      }
+
+   if (totalSize > _sizeLimit)
+      {
+      std::sort(entries.begin(), entries.end(), usedBefore);
+      for (auto it = entries.begin(); it != entries.end() && totalSize > _sizeLimit; ++it)
+         {
+         // Another process may have removed the entry already
+         //
+         if (unlinkat(dirfd(directory), it->name, 0) == 0 || errno == ENOENT)
+            totalSize -= it->size;
+
+         if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Evicted %s/%s", _directory, it->name);
+         }
+      }
+
+   closedir(directory);
+   }
+
+#endif // defined(LINUX)
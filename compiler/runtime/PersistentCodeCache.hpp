@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef PERSISTENTCODECACHE_HPP
+#define PERSISTENTCODECACHE_HPP
+
+#if defined(LINUX)
+
+#include <stddef.h>
+#include <stdint.h>
+#include "env/RawAllocator.hpp"
+#include "infra/vector.hpp"
+
+namespace TR { class Compilation; }
+
+namespace TR
+{
+
+/**
+ * A directory of bodies compiled by earlier runs.  A compilation whose IL,
+ * options and target processor match a stored body installs that body in the
+ * code cache right after IL generation, skipping optimization and code
+ * generation.
+ *
+ * Entries are keyed by a serialization of the trees produced by IL generation
+ * together with the JIT options, the opt level and the processor the code was
+ * generated for.  The file name of an entry is a hash of the method signature,
+ * the opt level and the environment, so a method has a single entry in a given
+ * environment and an entry whose IL no longer matches is replaced rather than
+ * kept next to the new one.  The whole key is kept in the entry and compared on
+ * load, so a stale entry or a hash collision costs a compilation and never runs
+ * the wrong code.
+ *
+ * Bodies are stored position independent.  Absolute addresses of locations in
+ * the body, such as switch tables, are stored as offsets, and the addresses of
+ * native functions the body calls as static relocations against the name of the
+ * function.  The key holds those names rather than the addresses, and a loaded
+ * body is relocated against the call targets of the IL being compiled, so
+ * entries stay valid when libraries are loaded at different addresses.  Bodies
+ * that call runtime helpers or need any other kind of relocation are not stored,
+ * nor are compilations whose IL refers to statics or to address constants other
+ * than NULL, since those addresses change from run to run.
+ *
+ * The entries of the directory are limited to -Xjit:persistentCodeCacheSize=
+ * KB.  Loading an entry marks it as recently used, and storing one removes the
+ * least recently used entries beyond the limit.
+ *
+ * An entry is written to a temporary file that is renamed into place, so
+ * compilation threads and processes sharing the directory never read a partial
+ * entry.  The environment includes the GNU build ID of the object the JIT is
+ * linked into, or the identity and modification time of its file when it has
+ * none, so entries stored by another build of the JIT are never loaded.
+ *
+ * Only directories owned by the user and not writable by anybody else are
+ * used, since any entry in the directory may end up running in this process.
+ */
+class PersistentCodeCache
+   {
+public:
+
+   /**
+    * @brief Opens the cache stored in directory, which must exist
+    * @return the cache, or NULL if the directory cannot be written to, is not
+    *         owned by the user or is writable by other users, or if the build
+    *         of the JIT cannot be identified
+    */
+   static PersistentCodeCache *create(TR::RawAllocator rawAllocator, const char *directory);
+
+   void destroy();
+
+   /**
+    * @brief Serializes what the body of a compilation depends on
+    *
+    * Must be called before the trees of the compilation are optimized.
+    *
+    * @param[out] key the key of the compilation
+    * @return false if the compilation cannot be cached, because of the target
+    *         or because its IL holds something the key cannot describe
+    */
+   bool computeKey(TR::Compilation *comp, TR::vector<uint8_t> &key);
+
+   /**
+    * @brief Installs the body stored under key as the body of the compilation
+    *
+    * On success the code generator describes the installed body the way it
+    * would after generating it and the method symbol holds its entry point.
+    *
+    * @return true if the body was installed, false if there is no usable entry
+    */
+   bool load(TR::Compilation *comp, const TR::vector<uint8_t> &key);
+
+   /**
+    * @brief Stores the body just generated for the compilation under key, unless
+    *        it cannot be relocated
+    */
+   void store(TR::Compilation *comp, const TR::vector<uint8_t> &key);
+
+private:
+
+   static const uint32_t EntryMagic = 0x4F4D5243;  // "OMRC"
+   static const uint32_t EntryVersion = 1;
+
+   struct EntryHeader
+      {
+      uint32_t magic;
+      uint32_t version;
+      uint32_t keySize;
+      uint32_t codeSize;        ///< bytes from the start of the body to the end of its code
+      uint32_t entryOffset;     ///< offset of the entry point in the body
+      uint32_t numRelocations;
+      uint32_t symbolsSize;     ///< bytes of NUL terminated symbol names following the relocations
+      uint32_t reserved;
+      };
+
+   enum RelocationKind
+      {
+      BodyAddress,              ///< 64 bit offset in the body, the start of the body is added on load
+      SymbolAddress,            ///< 64 bit address of the symbol, stored as 0
+      };
+
+   struct EntryRelocation
+      {
+      uint32_t offset;
+      uint32_t kind;
+      uint32_t symbolOffset;    ///< for SymbolAddress, offset of the name in the symbols
+      uint32_t reserved;
+      };
+
+   struct EntryFile
+      {
+      uint64_t lastUsed;        ///< modification time in nanoseconds
+      size_t size;
+      char name[32];
+      };
+
+   PersistentCodeCache(TR::RawAllocator rawAllocator, char *directory, uint8_t *environment, size_t environmentSize, size_t sizeLimit);
+
+   void entryFileName(char *buffer, size_t bufferSize, TR::Compilation *comp, const TR::vector<uint8_t> &key);
+
+   /**
+    * @brief Removes the least recently used entries until the directory is
+    *        within its size limit
+    */
+   void evict(TR::Compilation *comp);
+
+   static bool usedBefore(const EntryFile &a, const EntryFile &b) { return a.lastUsed < b.lastUsed; }
+
+   TR::RawAllocator _rawAllocator;
+   char *_directory;
+   size_t _sizeLimit;            ///< bytes the entries of the directory may take
+   uint8_t *_environment;        ///< options and processor, the common prefix of every key
+   size_t _environmentSize;
+   };
+
+}
+
+#endif // defined(LINUX)
+
+#endif // PERSISTENTCODECACHE_HPP
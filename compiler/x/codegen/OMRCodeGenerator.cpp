@@ -526,6 +526,7 @@ OMR::X86::CodeGenerator::CodeGenerator(TR::Compilation *comp) :
    _dependentDiscardableRegisters(getTypedAllocator<TR::Register*>(comp->allocator())),
    _clobberingInstructions(getTypedAllocator<TR::ClobberingInstruction*>(comp->allocator())),
    _outlinedInstructionsList(getTypedAllocator<TR_OutlinedInstructions*>(comp->allocator())),
+   _callFrameChanges(getTypedAllocator<CallFrameChange>(comp->allocator())),
    _numReservedIPICTrampolines(0),
    _flags(0)
    {
@@ -1707,6 +1708,23 @@ void OMR::X86::CodeGenerator::doBinaryEncoding()
    //
    std::sort(_dataSnippetList.begin(), _dataSnippetList.end(), DescendingSortX86DataSnippetByDataSize());
 
+   // Leaving dirty upper halves in the ymm/zmm registers makes legacy SSE code
+   // in callers and callees pay a state transition penalty, so a body that
+   // uses 256 or 512-bit vectors clears them before every call and return.
+   //
+   bool usesUpperVectorBits = false;
+   for (TR::Instruction *cursor = self()->getFirstInstruction(); cursor && !usesUpperVectorBits; cursor = cursor->getNext())
+      usesUpperVectorBits = cursor->getOpCode().usesUpperVectorBits();
+
+   if (usesUpperVectorBits)
+      {
+      for (TR::Instruction *cursor = self()->getFirstInstruction(); cursor; cursor = cursor->getNext())
+         {
+         if (cursor->getOpCode().isCallOp() || self()->isReturnInstruction(cursor))
+            generateInstruction(cursor->getPrev(), VZEROUPPER, self());
+         }
+      }
+
    /////////////////////////////////////////////////////////////////
    //
    // Pass 1: Binary length estimation and prologue creation
@@ -2182,6 +2200,133 @@ TR::X86ConstantDataSnippet * OMR::X86::CodeGenerator::findOrCreateConstantDataSn
    return snippet;
    }
 
+void OMR::X86::CodeGenerator::addCallFrameChange(TR::Instruction *instruction, TR::RealRegister::RegNum cfaRegister, int32_t cfaOffset, TR::RealRegister::RegNum savedRegister)
+   {
+   CallFrameChange change = { instruction, cfaRegister, cfaOffset, savedRegister };
+   _callFrameChanges.push_back(change);
+   }
+
+void OMR::X86::CodeGenerator::addCallFrameSavedRegister(TR::Instruction *instruction, TR::RealRegister::RegNum savedRegister, int32_t cfaOffset)
+   {
+   CallFrameChange change = { instruction, TR::RealRegister::NoReg, cfaOffset, savedRegister };
+   _callFrameChanges.push_back(change);
+   }
+
+#if defined(TR_TARGET_64BIT)
+static uint8_t
+dwarfRegisterNumber(TR::RealRegister::RegNum reg)
+   {
+   // DWARF numbering of the AMD64 SysV ABI, indexed from eax
+   //
+   static const uint8_t gprNumbers[] = { 0, 3, 2, 1, 5, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+   TR_ASSERT(reg >= TR::RealRegister::FirstGPR && reg <= TR::RealRegister::LastGPR, "only GPRs are described in call frame instructions");
+   return gprNumbers[reg - TR::RealRegister::FirstGPR];
+   }
+
+static void
+encodeULEB128(uint8_t *&cursor, uint32_t value)
+   {
+   do
+      {
+      uint8_t byte = value & 0x7f;
+      value >>= 7;
+      *cursor++ = value ? (byte | 0x80) : byte;
+      }
+   while (value);
+   }
+#endif
+
+uint8_t *OMR::X86::CodeGenerator::encodeCallFrameInstructions(uint8_t *codeStart, uint32_t &size, uint8_t &returnAddressRegister, int8_t &dataAlignmentFactor)
+   {
+#if defined(TR_TARGET_64BIT)
+   // Only the system linkage records its frame changes
+   //
+   if (_callFrameChanges.empty())
+      return NULL;
+
+   const uint8_t DW_CFA_advance_loc = 0x40;
+   const uint8_t DW_CFA_offset = 0x80;
+   const uint8_t DW_CFA_advance_loc1 = 0x02;
+   const uint8_t DW_CFA_advance_loc2 = 0x03;
+   const uint8_t DW_CFA_advance_loc4 = 0x04;
+   const uint8_t DW_CFA_def_cfa = 0x0c;
+   const int32_t slotSize = 8;
+
+   // Each change needs at most an advance_loc4, a def_cfa and an offset
+   //
+   const uint32_t maxChangeSize = 5 + 1 + 5 + 5 + 1 + 5;
+   uint8_t *instructions = (uint8_t *)self()->trMemory()->allocateHeapMemory(maxChangeSize * (_callFrameChanges.size() + 1));
+   uint8_t *cursor = instructions;
+
+   returnAddressRegister = 16;
+   dataAlignmentFactor = -slotSize;
+
+   // On entry the return address is on top of the stack
+   //
+   *cursor++ = DW_CFA_def_cfa;
+   encodeULEB128(cursor, dwarfRegisterNumber(TR::RealRegister::esp));
+   encodeULEB128(cursor, slotSize);
+   *cursor++ = DW_CFA_offset | returnAddressRegister;
+   encodeULEB128(cursor, 1);
+
+   uint32_t location = 0;
+   for (auto change = _callFrameChanges.begin(); change != _callFrameChanges.end(); ++change)
+      {
+      TR::Instruction *instruction = change->_instruction;
+      uint8_t *end = instruction->getBinaryEncoding() + instruction->getBinaryLength();
+      if (end < codeStart + location)
+         return NULL;
+
+      uint32_t delta = end - (codeStart + location);
+      location += delta;
+      if (delta < 0x40)
+         {
+         *cursor++ = DW_CFA_advance_loc | delta;
+         }
+      else if (delta <= 0xff)
+         {
+         *cursor++ = DW_CFA_advance_loc1;
+         *cursor++ = delta;
+         }
+      else if (delta <= 0xffff)
+         {
+         *cursor++ = DW_CFA_advance_loc2;
+         *(uint16_t *)cursor = delta;
+         cursor += 2;
+         }
+      else
+         {
+         *cursor++ = DW_CFA_advance_loc4;
+         *(uint32_t *)cursor = delta;
+         cursor += 4;
+         }
+
+      if (change->_cfaRegister != TR::RealRegister::NoReg)
+         {
+         *cursor++ = DW_CFA_def_cfa;
+         encodeULEB128(cursor, dwarfRegisterNumber(change->_cfaRegister));
+         encodeULEB128(cursor, change->_cfaOffset);
+         }
+
+      // A pushed register is on top of the stack and a stored one in its
+      // save slot, either way _cfaOffset bytes below the CFA
+      //
+      if (change->_savedRegister != TR::RealRegister::NoReg)
+         {
+         *cursor++ = DW_CFA_offset | dwarfRegisterNumber(change->_savedRegister);
+         encodeULEB128(cursor, change->_cfaOffset / slotSize);
+         }
+      }
+
+   size = cursor - instructions;
+   return instructions;
+#else
+   // IA32 pushes its preserved registers one by one, which the recorded changes do not cover
+   //
+   return NULL;
+#endif
+   }
+
 int32_t OMR::X86::CodeGenerator::setEstimatedLocationsForDataSnippetLabels(int32_t estimatedSnippetStart)
    {
    // Assume constants should be aligned according to their size.
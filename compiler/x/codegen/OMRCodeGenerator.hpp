@@ -161,6 +161,8 @@ struct TR_X86ProcessorInfo
    bool supportsSSE4_2()                   {return testFeatureFlags2(TR_SSE4_2);}
    bool supportsAVX()                      {return testFeatureFlags2(TR_AVX) && enabledXSAVE();}
    bool supportsAVX2()                     {return testFeatureFlags8(TR_AVX2) && enabledXSAVE();}
+   bool supportsAVX512F()                  {return testFeatureFlags8(TR_AVX512F) && enabledXSAVE();}
+   bool supportsAVX512BW()                 {return testFeatureFlags8(TR_AVX512BW) && enabledXSAVE();}
    bool supportsBMI1()                     {return testFeatureFlags8(TR_BMI1) && enabledXSAVE();}
    bool supportsBMI2()                     {return testFeatureFlags8(TR_BMI2) && enabledXSAVE();}
    bool supportsFMA()                      {return testFeatureFlags2(TR_FMA) && enabledXSAVE();}
@@ -467,6 +469,32 @@ class OMR_EXTENSIBLE CodeGenerator : public OMR::CodeGenerator
 
    TR::list<TR_OutlinedInstructions*> &getOutlinedInstructionsList() {return _outlinedInstructionsList;}
 
+   /**
+    * \brief A point of the prologue or of an epilogue after which the canonical frame
+    *        address (CFA) of the method is computed differently
+    */
+   struct CallFrameChange
+      {
+      TR::Instruction *_instruction;             ///< the change takes effect once this instruction has executed
+      TR::RealRegister::RegNum _cfaRegister;     ///< NoReg if the CFA is unchanged
+      int32_t _cfaOffset;                        ///< CFA offset, or how far below the CFA the register is saved if the CFA is unchanged
+      TR::RealRegister::RegNum _savedRegister;   ///< register pushed or stored by the instruction, NoReg if none
+      };
+
+   /**
+    * \brief Records that the CFA is \p cfaRegister + \p cfaOffset once \p instruction has
+    *        executed.  Changes must be recorded in instruction order.
+    */
+   void addCallFrameChange(TR::Instruction *instruction, TR::RealRegister::RegNum cfaRegister, int32_t cfaOffset, TR::RealRegister::RegNum savedRegister = TR::RealRegister::NoReg);
+
+   /**
+    * \brief Records that \p instruction stores \p savedRegister \p cfaOffset bytes below
+    *        the CFA, which it leaves unchanged.  Changes must be recorded in instruction order.
+    */
+   void addCallFrameSavedRegister(TR::Instruction *instruction, TR::RealRegister::RegNum savedRegister, int32_t cfaOffset);
+
+   uint8_t *encodeCallFrameInstructions(uint8_t *codeStart, uint32_t &size, uint8_t &returnAddressRegister, int8_t &dataAlignmentFactor);
+
    TR_X86ScratchRegisterManager *generateScratchRegisterManager(int32_t capacity=7);
 
    bool supportsConstantRematerialization();
@@ -721,6 +749,7 @@ protected:
    TR::list<TR::ClobberingInstruction*>  _clobberingInstructions;
    std::list<TR::ClobberingInstruction*, TR::typed_allocator<TR::ClobberingInstruction*, TR::Allocator> >::iterator _clobIterator;
    TR::list<TR_OutlinedInstructions*>    _outlinedInstructionsList;
+   TR::vector<CallFrameChange>           _callFrameChanges;
 
    RegisterAssignmentDirection     _assignmentDirection;
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corp. and others
+ * Copyright (c) 2000, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -103,6 +103,8 @@ bool OMR::X86::Instruction::isRegRegMove()
       case MOV4RegReg:
       case MOV8RegReg:
       case MOVDQURegReg:
+      case VMOVDQURegReg:
+      case VMOVDQU512RegReg:
          return true;
       default:
          return false;
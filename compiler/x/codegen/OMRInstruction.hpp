@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corp. and others
+ * Copyright (c) 2000, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -284,6 +284,7 @@ class OMR_EXTENSIBLE Instruction : public OMR::Instruction
       {
       VEX() {TR_ASSERT(false, "INVALID VEX PREFIX");}
       };
+   struct EVEX;
    };
 
    template<>
@@ -363,6 +364,61 @@ class OMR_EXTENSIBLE Instruction : public OMR::Instruction
          return modrm.RM();
          }
       };
+   // EVEX prefix of AVX-512 instructions, only the subset without masking,
+   // broadcast, rounding control or registers above 15 is supported
+   struct Instruction::EVEX
+      {
+      // Byte 0: 62
+      uint8_t escape;
+      // Byte 1: P0
+      uint8_t m : 2;
+      uint8_t _zero : 2;
+      uint8_t R2 : 1;
+      uint8_t B : 1;
+      uint8_t X : 1;
+      uint8_t R : 1;
+      // Byte 2: P1
+      uint8_t p : 2;
+      uint8_t _one : 1;
+      uint8_t v : 4;
+      uint8_t W : 1;
+      // Byte 3: P2
+      uint8_t aaa : 3;
+      uint8_t V2 : 1;
+      uint8_t b : 1;
+      uint8_t L : 2;
+      uint8_t z : 1;
+      // Byte 4: opcode
+      uint8_t opcode;
+      // Byte 5: ModRM
+      ModRM   modrm;
+
+      inline EVEX() {}
+      inline EVEX(const REX& rex, uint8_t ModRMOpCode) : modrm(ModRMOpCode)
+         {
+         escape = '\x62';
+         _zero = 0;
+         R2 = 1;
+         R = ~rex.R;
+         X = ~rex.X;
+         B = ~rex.B;
+         _one = 1;
+         W = rex.W;
+         v = 0xf; //0b1111
+         aaa = 0;
+         V2 = 1;
+         b = 0;
+         z = 0;
+         }
+      inline uint8_t Reg() const
+         {
+         return modrm.Reg(~R);
+         }
+      inline uint8_t RM() const
+         {
+         return modrm.RM(~B);
+         }
+      };
 }
 
 }
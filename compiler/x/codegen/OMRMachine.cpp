@@ -860,7 +860,7 @@ TR::RealRegister *OMR::X86::Machine::freeBestGPRegister(TR::Instruction
             }
          else
             {
-            location = self()->cg()->allocateSpill(16, false, &offset);
+            location = self()->cg()->allocateSpill(TR::DataType::getSize(TR::VectorInt8), false, &offset);
             }
          }
       else
@@ -929,7 +929,7 @@ TR::RealRegister *OMR::X86::Machine::freeBestGPRegister(TR::Instruction
          }
       else if (bestRegister->getKind() == TR_VRF)
          {
-         op = MOVDQURegMem;
+         op = VectorMOVDQURegMem(TR::DataType::getSize(TR::VectorInt8));
          }
       else
          {
@@ -1044,7 +1044,7 @@ TR::RealRegister *OMR::X86::Machine::reverseGPRSpillState(TR::Instruction     *c
       instr = new (self()->cg()->trHeapMemory())
          TR::X86MemRegInstruction(
             currentInstruction,
-            MOVDQUMemReg,
+            VectorMOVDQUMemReg(TR::DataType::getSize(TR::VectorInt8)),
             tempMR,
             targetRegister, self()->cg());
 
@@ -1052,7 +1052,7 @@ TR::RealRegister *OMR::X86::Machine::reverseGPRSpillState(TR::Instruction     *c
       // This is to enforce re-use of the same spill slot for a virtual register
       // while assigning non-linear control flow regions.
       //
-      self()->cg()->freeSpill(location, 16, 0);
+      self()->cg()->freeSpill(location, TR::DataType::getSize(TR::VectorInt8), 0);
       if (!self()->cg()->isFreeSpillListLocked())
          {
          spilledRegister->setBackingStorage(NULL);
@@ -1217,7 +1217,7 @@ void OMR::X86::Machine::coerceXMMRegisterAssignment(TR::Instruction          *cu
          if (virtualRegister->getKind() == TR_VRF)
             {
             instr = new (self()->cg()->trHeapMemory()) TR::X86RegRegInstruction(currentInstruction,
-                                                MOVDQURegReg,
+                                                VectorMOVDQURegReg(TR::DataType::getSize(TR::VectorInt8)),
                                                 currentAssignedRegister,
                                                 targetRegister, self()->cg());
             }
@@ -1295,7 +1295,7 @@ void OMR::X86::Machine::coerceXMMRegisterAssignment(TR::Instruction          *cu
             {
             if (virtualRegister->getKind() == TR_VRF)
                {
-               instr = new (self()->cg()->trHeapMemory()) TR::X86RegRegInstruction(currentInstruction, MOVDQURegReg, targetRegister, candidate, self()->cg());
+               instr = new (self()->cg()->trHeapMemory()) TR::X86RegRegInstruction(currentInstruction, VectorMOVDQURegReg(TR::DataType::getSize(TR::VectorInt8)), targetRegister, candidate, self()->cg());
                }
             else if (currentTargetVirtual->isSinglePrecision())
                {
@@ -1372,7 +1372,7 @@ void OMR::X86::Machine::coerceXMMRegisterAssignment(TR::Instruction          *cu
             {
             if (virtualRegister->getKind() == TR_VRF)
                {
-               instr = new (self()->cg()->trHeapMemory()) TR::X86RegRegInstruction(currentInstruction, MOVDQURegReg, targetRegister, candidate, self()->cg());
+               instr = new (self()->cg()->trHeapMemory()) TR::X86RegRegInstruction(currentInstruction, VectorMOVDQURegReg(TR::DataType::getSize(TR::VectorInt8)), targetRegister, candidate, self()->cg());
                }
             else if (currentTargetVirtual->isSinglePrecision())
                {
@@ -2220,7 +2220,7 @@ void OMR::X86::Machine::disassociateUnspilledBackingStorage()
                }
             else if (virtReg->getKind() == TR_VRF)
                {
-               size = 16;
+               size = TR::DataType::getSize(TR::VectorInt8);
                }
             else
                {
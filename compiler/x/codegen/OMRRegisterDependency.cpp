@@ -227,7 +227,7 @@ OMR::X86::RegisterDependencyConditions::RegisterDependencyConditions(
             {
             generateRegcopyDebugCounter(cg, "vrf");
             copyReg = cg->allocateRegister(TR_VRF);
-            generateRegRegInstruction(MOVDQURegReg, node, copyReg, child->getRegister(), cg);
+            generateRegRegInstruction(VectorMOVDQURegReg(TR::DataType::getSize(TR::VectorInt8)), node, copyReg, child->getRegister(), cg);
             }
 
          globalReg = copyReg;
@@ -639,7 +639,7 @@ void TR_X86RegisterDependencyGroup::assignRegisters(TR::Instruction   *currentIn
                   }
                else if (assignedReg->getKind() == TR_VRF)
                   {
-                  op = MOVDQURegMem;
+                  op = VectorMOVDQURegMem(TR::DataType::getSize(TR::VectorInt8));
                   }
                else
                   {
@@ -4177,6 +4177,66 @@ static const TR_X86OpCodes BinaryArithmeticOpCodesForMem[TR::NumOMRTypes][NumBin
    { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Aggregate
    };
 
+static const int32_t NumVectorTypes = TR::VectorDouble - TR::VectorInt8 + 1;
+
+// Opcodes of vectors wider than 128 bits, indexed by 256-bit (0) or 512-bit (1) length first
+//
+static const TR_X86OpCodes WideVectorBinaryArithmeticOpCodesForReg[2][NumVectorTypes][NumBinaryArithmeticOps] =
+   {
+      {
+      //  Invalid,       Add,          Sub,          Mul,           Div,           And,          Or,          Xor
+      { BADIA32Op, VPADDBRegReg, VPSUBBRegReg, BADIA32Op,     BADIA32Op,     BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorInt8
+      { BADIA32Op, VPADDWRegReg, VPSUBWRegReg, VPMULLWRegReg, BADIA32Op,     BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorInt16
+      { BADIA32Op, VPADDDRegReg, VPSUBDRegReg, VPMULLDRegReg, BADIA32Op,     VPANDRegReg,  VPORRegReg,  VPXORRegReg  }, // VectorInt32
+      { BADIA32Op, VPADDQRegReg, VPSUBQRegReg, BADIA32Op,     BADIA32Op,     VPANDRegReg,  VPORRegReg,  VPXORRegReg  }, // VectorInt64
+      { BADIA32Op, VADDPSRegReg, VSUBPSRegReg, VMULPSRegReg,  VDIVPSRegReg,  BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorFloat
+      { BADIA32Op, VADDPDRegReg, VSUBPDRegReg, VMULPDRegReg,  VDIVPDRegReg,  BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorDouble
+      },
+      {
+      //  Invalid,          Add,             Sub,             Mul,              Div,              And,              Or,              Xor
+      { BADIA32Op, VPADDB512RegReg, VPSUBB512RegReg, BADIA32Op,        BADIA32Op,        BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorInt8
+      { BADIA32Op, VPADDW512RegReg, VPSUBW512RegReg, VPMULLW512RegReg, BADIA32Op,        BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorInt16
+      { BADIA32Op, VPADDD512RegReg, VPSUBD512RegReg, VPMULLD512RegReg, BADIA32Op,        VPANDD512RegReg,  VPORD512RegReg,  VPXORD512RegReg  }, // VectorInt32
+      { BADIA32Op, VPADDQ512RegReg, VPSUBQ512RegReg, BADIA32Op,        BADIA32Op,        VPANDD512RegReg,  VPORD512RegReg,  VPXORD512RegReg  }, // VectorInt64
+      { BADIA32Op, VADDPS512RegReg, VSUBPS512RegReg, VMULPS512RegReg,  VDIVPS512RegReg,  BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorFloat
+      { BADIA32Op, VADDPD512RegReg, VSUBPD512RegReg, VMULPD512RegReg,  VDIVPD512RegReg,  BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorDouble
+      },
+   };
+
+static const TR_X86OpCodes WideVectorBinaryArithmeticOpCodesForMem[2][NumVectorTypes][NumBinaryArithmeticOps] =
+   {
+      {
+      //  Invalid,       Add,          Sub,          Mul,           Div,           And,          Or,          Xor
+      { BADIA32Op, VPADDBRegMem, VPSUBBRegMem, BADIA32Op,     BADIA32Op,     BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorInt8
+      { BADIA32Op, VPADDWRegMem, VPSUBWRegMem, VPMULLWRegMem, BADIA32Op,     BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorInt16
+      { BADIA32Op, VPADDDRegMem, VPSUBDRegMem, VPMULLDRegMem, BADIA32Op,     VPANDRegMem,  VPORRegMem,  VPXORRegMem  }, // VectorInt32
+      { BADIA32Op, VPADDQRegMem, VPSUBQRegMem, BADIA32Op,     BADIA32Op,     VPANDRegMem,  VPORRegMem,  VPXORRegMem  }, // VectorInt64
+      { BADIA32Op, VADDPSRegMem, VSUBPSRegMem, VMULPSRegMem,  VDIVPSRegMem,  BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorFloat
+      { BADIA32Op, VADDPDRegMem, VSUBPDRegMem, VMULPDRegMem,  VDIVPDRegMem,  BADIA32Op,    BADIA32Op,   BADIA32Op    }, // VectorDouble
+      },
+      {
+      //  Invalid,          Add,             Sub,             Mul,              Div,              And,              Or,              Xor
+      { BADIA32Op, VPADDB512RegMem, VPSUBB512RegMem, BADIA32Op,        BADIA32Op,        BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorInt8
+      { BADIA32Op, VPADDW512RegMem, VPSUBW512RegMem, VPMULLW512RegMem, BADIA32Op,        BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorInt16
+      { BADIA32Op, VPADDD512RegMem, VPSUBD512RegMem, VPMULLD512RegMem, BADIA32Op,        VPANDD512RegMem,  VPORD512RegMem,  VPXORD512RegMem  }, // VectorInt32
+      { BADIA32Op, VPADDQ512RegMem, VPSUBQ512RegMem, BADIA32Op,        BADIA32Op,        VPANDD512RegMem,  VPORD512RegMem,  VPXORD512RegMem  }, // VectorInt64
+      { BADIA32Op, VADDPS512RegMem, VSUBPS512RegMem, VMULPS512RegMem,  VDIVPS512RegMem,  BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorFloat
+      { BADIA32Op, VADDPD512RegMem, VSUBPD512RegMem, VMULPD512RegMem,  VDIVPD512RegMem,  BADIA32Op,        BADIA32Op,       BADIA32Op        }, // VectorDouble
+      },
+   };
+
+static TR_X86OpCodes BinaryArithmeticOpCode(TR::Node* node, BinaryArithmeticOps arithmetic, bool isMemForm)
+   {
+   TR::DataType type = node->getDataType();
+   if (type.isVector() && node->getSize() > 16)
+      {
+      int32_t length = node->getSize() == 64 ? 1 : 0;
+      return isMemForm ? WideVectorBinaryArithmeticOpCodesForMem[length][type.getDataType() - TR::VectorInt8][arithmetic] :
+                         WideVectorBinaryArithmeticOpCodesForReg[length][type.getDataType() - TR::VectorInt8][arithmetic];
+      }
+   return isMemForm ? BinaryArithmeticOpCodesForMem[type][arithmetic] : BinaryArithmeticOpCodesForReg[type][arithmetic];
+   }
+
 static const TR::ILOpCodes MemoryLoadOpCodes[TR::NumOMRTypes] =
    {
    TR::BadILOp, // NoType
@@ -4249,7 +4309,7 @@ TR::Register* OMR::X86::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEva
       if (operandNode1->getRegister()                               ||
           operandNode1->getReferenceCount() != 1                    ||
           operandNode1->getOpCodeValue() != MemoryLoadOpCodes[type] ||
-          BinaryArithmeticOpCodesForMem[type][arithmetic] == BADIA32Op)
+          BinaryArithmeticOpCode(node, arithmetic, true) == BADIA32Op)
          {
          useRegMemForm = false;
          }
@@ -4260,7 +4320,7 @@ TR::Register* OMR::X86::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEva
    TR::Register* resultReg = cg->allocateRegister(operandReg0->getKind());
    resultReg->setIsSinglePrecision(operandReg0->isSinglePrecision());
 
-   TR_X86OpCodes opCode = useRegMemForm ? BinaryArithmeticOpCodesForMem[type][arithmetic] : BinaryArithmeticOpCodesForReg[type][arithmetic];
+   TR_X86OpCodes opCode = BinaryArithmeticOpCode(node, arithmetic, useRegMemForm);
    TR_ASSERT(opCode != BADIA32Op, "FloatingPointAndVectorBinaryArithmeticEvaluator: unsupported data type or arithmetic.");
 
    if (cg->comp()->target().cpu.supportsAVX())
@@ -142,9 +142,11 @@ void TR_OutlinedInstructions::generateOutlinedInstructionsDispatch()
                mov = MOVRegReg();
                break;
             case TR_FPR:
-            case TR_VRF:
                mov = MOVDQURegReg;
                break;
+            case TR_VRF:
+               mov = VectorMOVDQURegReg(TR::DataType::getSize(TR::VectorInt8));
+               break;
             default:
                TR_ASSERT(false, "OutlinedInstructions: unsupported result register kind.");
                break;
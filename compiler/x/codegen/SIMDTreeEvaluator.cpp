@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2017, 2019 IBM Corp. and others
+ * Copyright (c) 2017, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -81,6 +81,12 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDloadEvaluator(TR::Node* node, TR::Cod
       case 16:
          opCode = MOVDQURegMem;
          break;
+      case 32:
+         opCode = VMOVDQURegMem;
+         break;
+      case 64:
+         opCode = VMOVDQU512RegMem;
+         break;
       default:
          if (cg->comp()->getOption(TR_TraceCG))
             traceMsg(cg->comp(), "Unsupported fill size: Node = %p\n", node);
@@ -109,6 +115,12 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDstoreEvaluator(TR::Node* node, TR::Co
       case 16:
          opCode = MOVDQUMemReg;
          break;
+      case 32:
+         opCode = VMOVDQUMemReg;
+         break;
+      case 64:
+         opCode = VMOVDQU512MemReg;
+         break;
       default:
          if (cg->comp()->getOption(TR_TraceCG))
             traceMsg(cg->comp(), "Unsupported fill size: Node = %p\n", node);
@@ -166,6 +178,16 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDsplatsEvaluator(TR::Node* node, TR::C
          break;
       }
 
+   // Broadcast the lowest element, which the shuffles above left in every element of the low 128 bits, to wider vectors
+   if (node->getSize() > 16)
+      {
+      bool isQuadWord = node->getDataType() == TR::VectorInt64 || node->getDataType() == TR::VectorDouble;
+      TR_X86OpCodes opCode = isQuadWord ?
+         VectorLengthParameterizedOpCode<BADIA32Op, VPBROADCASTQRegReg, VPBROADCASTQ512RegReg>(node->getSize()) :
+         VectorLengthParameterizedOpCode<BADIA32Op, VPBROADCASTDRegReg, VPBROADCASTD512RegReg>(node->getSize());
+      generateRegRegInstruction(opCode, node, resultReg, resultReg, cg);
+      }
+
    node->setRegister(resultReg);
    cg->decReferenceCount(childNode);
    return resultReg;
@@ -176,6 +198,8 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDgetvelemEvaluator(TR::Node* node, TR:
    TR::Node* firstChild = node->getChild(0);
    TR::Node* secondChild = node->getChild(1);
 
+   TR_ASSERT_FATAL(firstChild->getSize() == 16, "SIMDgetvelemEvaluator only supports 128-bit vectors, node %p has %d bytes", firstChild, firstChild->getSize());
+
    TR::Register* srcVectorReg = cg->evaluate(firstChild);
    TR::Register* resReg = 0;
    TR::Register* lowResReg = 0;
@@ -1471,7 +1471,8 @@ uint8_t* TR::X86RegRegRegInstruction::generateOperand(uint8_t* cursor)
       {
       applySourceRegisterToModRMByte(modRM);
       }
-   applySource2ndRegisterToVEX(modRM - 2);
+   // vvvv is in the byte preceding the opcode of VEX prefixes, and one byte further of EVEX ones
+   applySource2ndRegisterToVEX(modRM - (getOpCode().info().isEVEX() ? 3 : 2));
    return cursor;
    }
 
@@ -1934,6 +1935,10 @@ int32_t TR::X86MemInstruction::estimateBinaryLength(int32_t currentEstimate)
    if (getOpCode().needsLockPrefix() || (barrier & LockPrefix))
       length++;
 
+   // EVEX scales 8-bit displacements by the operand size, use 32-bit ones instead
+   if (getOpCode().info().isEVEX())
+      getMemoryReference()->setForceWideDisplacement();
+
    length += getMemoryReference()->estimateBinaryLength(cg());
 
    if (barrier & NeedsExplicitBarrier)
@@ -2387,6 +2392,10 @@ int32_t TR::X86RegMemInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
+   // EVEX scales 8-bit displacements by the operand size, use 32-bit ones instead
+   if (getOpCode().info().isEVEX())
+      getMemoryReference()->setForceWideDisplacement();
+
    int32_t length = getMemoryReference()->estimateBinaryLength(cg());
 
    if (barrier & LockPrefix)
@@ -2427,7 +2436,8 @@ uint8_t* TR::X86RegRegMemInstruction::generateOperand(uint8_t* cursor)
       {
       applyTargetRegisterToModRMByte(modRM);
       }
-   applySource2ndRegisterToVEX(modRM - 2);
+   // vvvv is in the byte preceding the opcode of VEX prefixes, and one byte further of EVEX ones
+   applySource2ndRegisterToVEX(modRM - (getOpCode().info().isEVEX() ? 3 : 2));
    cursor = getMemoryReference()->generateBinaryEncoding(modRM, this, cg());
    return cursor;
    }
@@ -2891,7 +2901,7 @@ TR::AMD64RegImm64SymInstruction::addMetaDataForCodeAddress(uint8_t *cursor)
             }
          case TR_NativeMethodAbsolute:
             {
-            if (cg()->comp()->getOption(TR_EmitRelocatableELFFile))
+            if (cg()->needsStaticRelocations())
                {
                TR_ResolvedMethod *target = getSymbolReference()->getSymbol()->castToResolvedMethodSymbol()->getResolvedMethod();
                cg()->addStaticRelocation(TR::StaticRelocation(cursor, target->externalName(cg()->trMemory()), TR::StaticRelocationSize::word64, TR::StaticRelocationType::Absolute));
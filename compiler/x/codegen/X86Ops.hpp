@@ -172,6 +172,26 @@ inline TR_X86OpCodes SizeParameterizedOpCode(bool is64Bit =
 // FMA
 #define VFMADD231SRegRegReg  SizeParameterizedOpCode<VFMADD231SDRegRegReg, VFMADD231SSRegRegReg>
 
+// Vector-length-parameterized opcodes
+//
+template <TR_X86OpCodes Op128, TR_X86OpCodes Op256, TR_X86OpCodes Op512>
+inline TR_X86OpCodes VectorLengthParameterizedOpCode(int32_t vectorLength)
+   {
+   switch (vectorLength)
+      {
+      case 64:
+         return Op512;
+      case 32:
+         return Op256;
+      default:
+         return Op128;
+      }
+   }
+
+#define VectorMOVDQURegReg VectorLengthParameterizedOpCode<MOVDQURegReg, VMOVDQURegReg, VMOVDQU512RegReg>
+#define VectorMOVDQURegMem VectorLengthParameterizedOpCode<MOVDQURegMem, VMOVDQURegMem, VMOVDQU512RegMem>
+#define VectorMOVDQUMemReg VectorLengthParameterizedOpCode<MOVDQUMemReg, VMOVDQUMemReg, VMOVDQU512MemReg>
+
 // Size and carry-parameterized opcodes
 //
 inline TR_X86OpCodes AddMemImms (bool is64Bit, bool isWithCarry)  { return isWithCarry   ? ADCMemImms(is64Bit) : ADDMemImms(is64Bit) ; }
@@ -406,6 +426,11 @@ class TR_X86OpCode
          {
          return vex_l != VEX_L___;
          }
+      // check if the instruction requires EVEX encoding (AVX-512)
+      inline bool isEVEX() const
+         {
+         return vex_l == VEX_L512;
+         }
       // check if the instruction is X87
       inline bool isX87() const
          {
@@ -552,6 +577,7 @@ class TR_X86OpCode
    inline uint32_t targetRegIsImplicit()           const { return _properties1[_opCode] & IA32OpProp1_TargetRegIsImplicit;}
    inline uint32_t sourceRegIsImplicit()           const { return _properties1[_opCode] & IA32OpProp1_SourceRegIsImplicit;}
    inline uint32_t isFusableCompare()              const { return _properties1[_opCode] & IA32OpProp1_FusableCompare; }
+   inline bool     usesUpperVectorBits()           const { return info().vex_l == VEX_L256 || info().vex_l == VEX_L512; }
 
    inline bool isSetRegInstruction() const
       {
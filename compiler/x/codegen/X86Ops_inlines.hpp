@@ -41,7 +41,16 @@ template <typename TBuffer> inline typename TBuffer::cursor_t TR_X86OpCode::OpCo
    TR::Compilation *comp = TR::comp();
    TR_ASSERT_FATAL(comp->compileRelocatableCode() || comp->isOutOfProcessCompilation() || comp->target().cpu.supportsAVX() == TR::CodeGenerator::getX86ProcessorInfo().supportsAVX(), "supportsAVX() failed\n");
 
-   if (supportsAVX() && comp->target().cpu.supportsAVX())
+   if (isEVEX())
+      {
+      TR::Instruction::EVEX evex(rex, modrm_opcode);
+      evex.m = escape;
+      evex.L = vex_l;
+      evex.p = prefixes;
+      evex.opcode = opcode;
+      buffer.append(evex);
+      }
+   else if (supportsAVX() && comp->target().cpu.supportsAVX())
       {
       TR::Instruction::VEX<3> vex(rex, modrm_opcode);
       vex.m = escape;
@@ -50,10 +59,22 @@ template <typename TBuffer> inline typename TBuffer::cursor_t TR_X86OpCode::OpCo
       vex.opcode = opcode;
       if(vex.CanBeShortened())
          {
-         buffer.append(TR::Instruction::VEX<2>(vex));
+         TR::Instruction::VEX<2> vex2(vex);
+         if (modrm_form)
+            {
+            buffer.append(vex2);
+            }
+         else
+            {
+            // Instructions without operands, e.g. VZEROUPPER, have no ModRM byte
+            buffer.append(vex2.escape);
+            buffer.append(((uint8_t*)&vex2)[1]);
+            buffer.append(vex2.opcode);
+            }
          }
       else
          {
+         TR_ASSERT_FATAL(modrm_form, "3-byte VEX prefix requires a ModRM byte\n");
          buffer.append(vex);
          }
       }
@@ -112,7 +133,7 @@ template <typename TBuffer> inline typename TBuffer::cursor_t TR_X86OpCode::OpCo
 
 inline void TR_X86OpCode::OpCode_t::finalize(uint8_t* cursor) const
    {
-   // Finalize VEX prefix
+   // Finalize VEX or EVEX prefix
    switch (*cursor)
       {
       case 0xC4:
@@ -133,6 +154,15 @@ inline void TR_X86OpCode::OpCode_t::finalize(uint8_t* cursor) const
             }
          }
          break;
+      case 0x62:
+         {
+         auto pEVEX = (TR::Instruction::EVEX*)cursor;
+         if (vex_v == VEX_vReg_)
+            {
+            pEVEX->v = ~(modrm_form == ModRM_EXT_ ? pEVEX->RM() : pEVEX->Reg());
+            }
+         }
+         break;
       default:
          break;
       }
@@ -293,6 +293,10 @@ TR::X86SystemLinkage::savePreservedRegisters(TR::Instruction *cursor)
 
    int32_t offsetCursor = -localSize + getProperties().getOffsetToFirstLocal() - pointerSize;
 
+   // The VFP is the stack pointer on entry, just below the CFA
+   //
+   const int32_t retAddressWidth = getProperties().getRetAddressWidth();
+
    if (_properties.getUsesPushesForPreservedRegs())
       {
       for (int32_t pindex = _properties.getMaxRegistersPreservedInPrologue()-1;
@@ -324,6 +328,8 @@ TR::X86SystemLinkage::savePreservedRegisters(TR::Instruction *cursor)
                reg,
                cg()
                );
+            if (reg->getKind() == TR_GPR)
+               cg()->addCallFrameSavedRegister(cursor, idx, retAddressWidth - offsetCursor);
             offsetCursor -= pointerSize;
             }
          }
@@ -484,6 +490,9 @@ TR::X86SystemLinkage::createPrologue(TR::Instruction *cursor)
 
    // Set the VFP state for the PROCENTRY instruction
    //
+   // Frame changes are recorded for the unwind information given to profilers
+   //
+   const int32_t retAddressWidth = properties.getRetAddressWidth();
    if (properties.getAlwaysDedicateFramePointerRegister())
       {
       cursor = new (trHeapMemory()) TR::X86RegInstruction(
@@ -491,6 +500,7 @@ TR::X86SystemLinkage::createPrologue(TR::Instruction *cursor)
          PUSHReg,
          machine()->getRealRegister(properties.getFramePointerRegister()),
          cg());
+      cg()->addCallFrameChange(cursor, TR::RealRegister::esp, retAddressWidth + properties.getGPRWidth(), properties.getFramePointerRegister());
 
       TR::RealRegister *stackPointerReg = machine()->getRealRegister(TR::RealRegister::esp);
       cursor = new (trHeapMemory()) TR::X86RegRegInstruction(
@@ -499,6 +509,7 @@ TR::X86SystemLinkage::createPrologue(TR::Instruction *cursor)
          machine()->getRealRegister(properties.getFramePointerRegister()),
          stackPointerReg,
          cg());
+      cg()->addCallFrameChange(cursor, properties.getFramePointerRegister(), retAddressWidth + properties.getGPRWidth());
 
       cg()->initializeVFPState(properties.getFramePointerRegister(), _properties.getPointerSize());
       }
@@ -532,6 +543,9 @@ TR::X86SystemLinkage::createPrologue(TR::Instruction *cursor)
       cursor = new (trHeapMemory()) TR::X86RegImmInstruction(cursor, subOp, espReal, allocSize, cg());
       }
 
+   if (allocSize != 0 && !properties.getAlwaysDedicateFramePointerRegister())
+      cg()->addCallFrameChange(cursor, TR::RealRegister::esp, retAddressWidth + allocSize);
+
    // Save preserved regs, and tell the frontend how many there are
    //
    bodySymbol->setProloguePushSlots(preservedRegsSize / properties.getPointerSize());
@@ -729,6 +743,21 @@ TR::X86SystemLinkage::createEpilogue(TR::Instruction *cursor)
       cursor = new (trHeapMemory()) TR::X86RegImmInstruction(cursor, op, espReal, allocSize, cg());
       }
 
+   // Only the return address is left on the stack until the return, after which
+   // the code that follows runs with the frame of the method body again
+   //
+   const int32_t retAddressWidth = _properties.getRetAddressWidth();
+   if (_properties.getAlwaysDedicateFramePointerRegister())
+      {
+      cg()->addCallFrameChange(cursor, TR::RealRegister::esp, retAddressWidth);
+      cg()->addCallFrameChange(cursor->getNext(), _properties.getFramePointerRegister(), retAddressWidth + _properties.getGPRWidth());
+      }
+   else if (allocSize != 0)
+      {
+      cg()->addCallFrameChange(cursor, TR::RealRegister::esp, retAddressWidth);
+      cg()->addCallFrameChange(cursor->getNext(), TR::RealRegister::esp, retAddressWidth + allocSize);
+      }
+
    if (comp()->getOption(TR_TraceCG))
       {
       traceMsg(comp(), "create epilogue using system linkage, after delocating stack frame, cursor is %x.\n", cursor);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2018 IBM Corp. and others
+ * Copyright (c) 2000, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -40,7 +40,8 @@ OMR::X86::CPU::detect(OMRPortLibrary * const omrPortLib)
                                         OMR_FEATURE_X86_MMX, OMR_FEATURE_X86_SSE, OMR_FEATURE_X86_SSE2,
                                         OMR_FEATURE_X86_SSSE3, OMR_FEATURE_X86_SSE4_1, OMR_FEATURE_X86_POPCNT,
                                         OMR_FEATURE_X86_AESNI, OMR_FEATURE_X86_OSXSAVE, OMR_FEATURE_X86_AVX,
-                                        OMR_FEATURE_X86_FMA, OMR_FEATURE_X86_HLE, OMR_FEATURE_X86_RTM};
+                                        OMR_FEATURE_X86_FMA, OMR_FEATURE_X86_HLE, OMR_FEATURE_X86_RTM,
+                                        OMR_FEATURE_X86_AVX2, OMR_FEATURE_X86_AVX512F, OMR_FEATURE_X86_AVX512BW};
 
    OMRPORT_ACCESS_FROM_OMRPORT(omrPortLib);
    OMRProcessorDesc featureMasks;
@@ -64,6 +65,12 @@ OMR::X86::CPU::detect(OMRPortLibrary * const omrPortLib)
          // Unset OSXSAVE if not enabled via CR0
          omrsysinfo_processor_set_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE, FALSE);
          }
+      else if (((0xE6 & _xgetbv(0)) != 0xE6) || feGetEnv("TR_DisableAVX512")) // '0xE6' = mask for XCR0[7:5]='111b' (Opmask, ZMM_Hi256, Hi16_ZMM) and XCR0[2:1]='11b'
+         {
+         // Unset AVX-512 if its state is not enabled via XCR0
+         omrsysinfo_processor_set_feature(&processorDescription, OMR_FEATURE_X86_AVX512F, FALSE);
+         omrsysinfo_processor_set_feature(&processorDescription, OMR_FEATURE_X86_AVX512BW, FALSE);
+         }
       }
 
    return TR::CPU(processorDescription);
@@ -249,6 +256,18 @@ OMR::X86::CPU::supportsAVX()
    return self()->supportsFeature(OMR_FEATURE_X86_AVX) && self()->supportsFeature(OMR_FEATURE_X86_OSXSAVE);
    }
 
+int32_t
+OMR::X86::CPU::getMaxVectorLength()
+   {
+   flags32_t processorFeatureFlags2(self()->getX86ProcessorFeatureFlags2());
+   flags32_t processorFeatureFlags8(self()->getX86ProcessorFeatureFlags8());
+   if (!processorFeatureFlags2.testAll(TR_AVX | TR_OSXSAVE))
+      return 16;
+   if (processorFeatureFlags8.testAll(TR_AVX512F | TR_AVX512BW))
+      return 64;
+   return processorFeatureFlags8.testAny(TR_AVX2) ? 32 : 16;
+   }
+
 bool
 OMR::X86::CPU::is(OMRProcessorArchitecture p)
    {
@@ -397,6 +416,12 @@ OMR::X86::CPU::supports_feature_test(uint32_t feature)
          return TR::CodeGenerator::getX86ProcessorInfo().hasThermalMonitor() == ans;
       case OMR_FEATURE_X86_AVX:
          return true;
+      case OMR_FEATURE_X86_AVX2:
+         return TR::CodeGenerator::getX86ProcessorInfo().supportsAVX2() == (ans && TR::CodeGenerator::getX86ProcessorInfo().enabledXSAVE());
+      case OMR_FEATURE_X86_AVX512F:
+         return TR::CodeGenerator::getX86ProcessorInfo().supportsAVX512F() == (ans && TR::CodeGenerator::getX86ProcessorInfo().enabledXSAVE());
+      case OMR_FEATURE_X86_AVX512BW:
+         return TR::CodeGenerator::getX86ProcessorInfo().supportsAVX512BW() == (ans && TR::CodeGenerator::getX86ProcessorInfo().enabledXSAVE());
       default:
          return false;
       }
@@ -581,6 +606,15 @@ OMR::X86::CPU::supports_feature_old_api(uint32_t feature)
       case OMR_FEATURE_X86_TM:
          supported = TR::CodeGenerator::getX86ProcessorInfo().hasThermalMonitor();
          break;
+      case OMR_FEATURE_X86_AVX2:
+         supported = TR::CodeGenerator::getX86ProcessorInfo().supportsAVX2();
+         break;
+      case OMR_FEATURE_X86_AVX512F:
+         supported = TR::CodeGenerator::getX86ProcessorInfo().supportsAVX512F();
+         break;
+      case OMR_FEATURE_X86_AVX512BW:
+         supported = TR::CodeGenerator::getX86ProcessorInfo().supportsAVX512BW();
+         break;
       default:
          TR_ASSERT_FATAL(false, "Unknown feature %d", feature);
          break;
@@ -100,6 +100,12 @@ public:
    bool prefersMultiByteNOP();
    bool supportsAVX();
    bool testOSForSSESupport() { return false; }
+
+   /**
+    * @brief Determines the widest vector register the code generator can use on the current processor.
+    * @return 64 with AVX-512 F and BW, 32 with AVX2, 16 otherwise
+    */
+   int32_t getMaxVectorLength();
    
    /**
     * @brief Determines whether 32bit integer rotate is available
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2018 IBM Corp. and others
+ * Copyright (c) 2000, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -94,6 +94,11 @@ inline bool jitGetCPUID(TR_X86CPUIDBuffer* pBuffer)
             // Unset OSXSAVE if not enabled via CR0
             pBuffer->_featureFlags2 &= ~TR_OSXSAVE;
             }
+         else if(((0xE6 & _xgetbv(0)) != 0xE6) || feGetEnv("TR_DisableAVX512")) // '0xE6' = mask for XCR0[7:5]='111b' (Opmask, ZMM_Hi256, Hi16_ZMM) and XCR0[2:1]='11b'
+            {
+            // Unset AVX-512 if its state is not enabled via XCR0
+            pBuffer->_featureFlags8 &= ~(TR_AVX512F | TR_AVX512DQ | TR_AVX512BW);
+            }
          }
 
       /* Mask out the bits the compiler does not care about.
@@ -100,6 +100,8 @@ initializeCodeCache(TR::CodeCacheManager & codeCacheManager)
    codeCacheConfig._emitExecutableELF = TR::Options::getCmdLineOptions()->getOption(TR_PerfTool)
                                     ||  TR::Options::getCmdLineOptions()->getOption(TR_EmitExecutableELFFile);
    codeCacheConfig._emitRelocatableELF = TR::Options::getCmdLineOptions()->getOption(TR_EmitRelocatableELFFile);
+   codeCacheConfig._emitPerfJitDump = TR::Options::getCmdLineOptions()->getOption(TR_PerfToolJitDump);
+   codeCacheConfig._persistentCodeCacheDir = TR::Options::getCmdLineOptions()->getPersistentCodeCacheDir();
 
    TR::CodeCache *firstCodeCache = codeCacheManager.initialize(true, 1);
    }
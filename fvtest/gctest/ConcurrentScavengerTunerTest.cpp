@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Steps of the Concurrent Scavenger slowdown tuner ladder. The model is driven directly with measured
+ * slowdowns since the example glue does not run Concurrent Scavenger.
+ */
+
+#include "ConcurrentScavengerTuner.hpp"
+#include "gcTestHelpers.hpp"
+
+#define TUNER_TEST_TARGET ((float)5.0)
+#define TUNER_TEST_MAX_THREADS 4
+
+TEST(ConcurrentScavengerTunerTest, slowdownLadder)
+{
+	MM_ConcurrentScavengerTuner tuner;
+	EXPECT_EQ((uintptr_t)UDATA_MAX, tuner.getRecommendedThreadCount());
+	EXPECT_FALSE(tuner.shouldYieldToMutators());
+
+	/* a slowdown within the target keeps the current setting */
+	tuner.update(4.0f, TUNER_TEST_TARGET, 2, 1, TUNER_TEST_MAX_THREADS);
+	EXPECT_EQ((uintptr_t)2, tuner.getRecommendedThreadCount());
+	EXPECT_FALSE(tuner.shouldYieldToMutators());
+
+	/* well under the target, background threads are removed first, then the last one yields */
+	tuner.update(1.0f, TUNER_TEST_TARGET, 2, 1, TUNER_TEST_MAX_THREADS);
+	EXPECT_EQ((uintptr_t)1, tuner.getRecommendedThreadCount());
+	EXPECT_FALSE(tuner.shouldYieldToMutators());
+	tuner.update(1.0f, TUNER_TEST_TARGET, 1, 1, TUNER_TEST_MAX_THREADS);
+	EXPECT_EQ((uintptr_t)1, tuner.getRecommendedThreadCount());
+	EXPECT_TRUE(tuner.shouldYieldToMutators());
+
+	/* over the target, yielding stops first, then threads are added up to the maximum */
+	tuner.update(8.0f, TUNER_TEST_TARGET, 1, 1, TUNER_TEST_MAX_THREADS);
+	EXPECT_EQ((uintptr_t)1, tuner.getRecommendedThreadCount());
+	EXPECT_FALSE(tuner.shouldYieldToMutators());
+	uintptr_t threadCount = 1;
+	for (uintptr_t i = 0; i < TUNER_TEST_MAX_THREADS; i++) {
+		tuner.update(8.0f, TUNER_TEST_TARGET, threadCount, 1, TUNER_TEST_MAX_THREADS);
+		threadCount = tuner.getRecommendedThreadCount();
+	}
+	EXPECT_EQ((uintptr_t)TUNER_TEST_MAX_THREADS, threadCount);
+	EXPECT_FALSE(tuner.shouldYieldToMutators());
+}
+
+TEST(ConcurrentScavengerTunerTest, forcedThreadCount)
+{
+	MM_ConcurrentScavengerTuner tuner;
+
+	/* with the thread count pinned only the yield criteria move */
+	tuner.update(0.0f, TUNER_TEST_TARGET, 3, 3, 3);
+	EXPECT_EQ((uintptr_t)3, tuner.getRecommendedThreadCount());
+	EXPECT_TRUE(tuner.shouldYieldToMutators());
+	tuner.update(20.0f, TUNER_TEST_TARGET, 3, 3, 3);
+	EXPECT_EQ((uintptr_t)3, tuner.getRecommendedThreadCount());
+	EXPECT_FALSE(tuner.shouldYieldToMutators());
+	tuner.update(20.0f, TUNER_TEST_TARGET, 3, 3, 3);
+	EXPECT_EQ((uintptr_t)3, tuner.getRecommendedThreadCount());
+	EXPECT_FALSE(tuner.shouldYieldToMutators());
+}
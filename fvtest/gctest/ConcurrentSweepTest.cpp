@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Concurrent sweep of the flat collector. A collection connects only the free memory the triggering allocation
+ * needs; the rest of the heap is swept by the background main GC thread and connected into the free list by
+ * allocating threads, and whatever is left is completed by the next collection before it marks.
+ */
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "GlobalCollector.hpp"
+#include "Heap.hpp"
+#include "mmomrhook.h"
+#include "ObjectAllocationModel.hpp"
+#include "omrgc.h"
+
+#define CONCURRENT_SWEEP_TEST_OBJECT_SIZE 1024
+
+typedef struct GCStartState {
+	MM_EnvironmentBase *env;
+	uintptr_t gcCount;
+	bool sweepActive; /**< The sweep of the previous cycle was still active when the collection started */
+	uintptr_t freeMemorySize; /**< Free memory of the heap when the collection started */
+} GCStartState;
+
+class ConcurrentSweepTest : public GCHeapTest
+{
+protected:
+	void allocateObjects(uintptr_t bytes);
+	void allocateUntilCollection();
+
+public:
+	ConcurrentSweepTest()
+		: GCHeapTest("fvtest/gctest/configuration/concurrent_sweep_config.xml", true, true)
+	{
+	}
+};
+
+/**
+ * Allocate unreferenced objects, collecting when the heap is full.
+ */
+void
+ConcurrentSweepTest::allocateObjects(uintptr_t bytes)
+{
+	uintptr_t allocationFlags = MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false);
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+
+	for (uintptr_t i = 0; i < (bytes / CONCURRENT_SWEEP_TEST_OBJECT_SIZE); i++) {
+		MM_ObjectAllocationModel *model = new(objectAllocationModelSpace) MM_ObjectAllocationModel(env, CONCURRENT_SWEEP_TEST_OBJECT_SIZE, allocationFlags);
+		ASSERT_TRUE(NULL != OMR_GC_AllocateObject(exampleVM->_omrVMThread, model)) << "failed to allocate object " << i;
+	}
+}
+
+/**
+ * Allocate unreferenced objects until the heap is full and an allocation failure collects them. Unlike an
+ * explicit collection, which completes the sweep, this leaves the sweep to proceed concurrently.
+ */
+void
+ConcurrentSweepTest::allocateUntilCollection()
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	uintptr_t maxObjectCount = (2 * extensions->heap->getActiveMemorySize()) / CONCURRENT_SWEEP_TEST_OBJECT_SIZE;
+
+	for (uintptr_t i = 0; (gcCount == extensions->globalGCStats.gcCount) && (i < maxObjectCount); i++) {
+		ASSERT_NO_FATAL_FAILURE(allocateObjects(CONCURRENT_SWEEP_TEST_OBJECT_SIZE));
+	}
+	ASSERT_EQ(gcCount + 1, extensions->globalGCStats.gcCount) << "allocation did not trigger a collection";
+}
+
+static void
+recordGCStart(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	GCStartState *state = (GCStartState *)userData;
+	MM_GCExtensionsBase *extensions = state->env->getExtensions();
+	state->gcCount += 1;
+	state->sweepActive = extensions->getGlobalCollector()->isConcurrentWorkAvailable(state->env);
+	state->freeMemorySize = extensions->heap->getActualFreeMemorySize();
+}
+
+TEST_F(ConcurrentSweepTest, freeMemoryGrowsAsSweepProceeds)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_GlobalCollector *collector = extensions->getGlobalCollector();
+	ASSERT_TRUE(extensions->concurrentSweep);
+
+	uintptr_t heapSize = extensions->heap->getActiveMemorySize();
+
+	/* the collection leaves the sweep active and connects only part of the garbage into the free list */
+	ASSERT_NO_FATAL_FAILURE(allocateUntilCollection());
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	ASSERT_TRUE(collector->isConcurrentWorkAvailable(env));
+	uintptr_t freeAfterCollect = extensions->heap->getActualFreeMemorySize();
+	EXPECT_GT(heapSize / 2, freeAfterCollect);
+
+	/* allocating more than was free connects swept chunks, without another collection */
+	uintptr_t allocatedBytes = heapSize / 2;
+	ASSERT_NO_FATAL_FAILURE(allocateObjects(allocatedBytes));
+	EXPECT_EQ(gcCount, extensions->globalGCStats.gcCount);
+	EXPECT_LT(freeAfterCollect, extensions->heap->getActualFreeMemorySize() + allocatedBytes);
+
+	/* the next collection completes the sweep, connecting all the garbage of the previous cycle, before it marks */
+	GCStartState gcStartState = {env, 0, true, 0};
+	J9HookInterface **omrHooks = extensions->getOmrHookInterface();
+	ASSERT_EQ(0, (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, recordGCStart, OMR_GET_CALLSITE(), &gcStartState));
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, recordGCStart, &gcStartState);
+	EXPECT_EQ((uintptr_t)1, gcStartState.gcCount);
+	EXPECT_FALSE(gcStartState.sweepActive);
+	/* only the objects allocated since, and the allocation caches, are not free */
+	EXPECT_LE((heapSize / 10) * 9, gcStartState.freeMemorySize + allocatedBytes);
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Aging and decommit of idle free entries by the background free page returner. The test collects a flat heap
+ * repeatedly and waits for the returner thread to complete its pass after each global collection.
+ */
+
+#include "EnvironmentBase.hpp"
+#include "FreePageReturner.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+
+#define FREE_PAGE_RETURNER_TEST_OBJECT_SIZE (4 * 1024 * 1024)
+#define FREE_PAGE_RETURNER_TEST_TIMEOUT_MILLIS 60000
+
+class FreePageReturnerTest : public GCHeapTest
+{
+protected:
+	void setRoot(omrobjectptr_t object);
+	bool collect(MM_FreePageReturner *returner);
+
+public:
+	FreePageReturnerTest()
+		: GCHeapTest("fvtest/gctest/configuration/free_page_returner_config.xml", true, true)
+	{
+	}
+};
+
+/**
+ * Replace the single root of the test, NULL to leave the heap without roots.
+ */
+void
+FreePageReturnerTest::setRoot(omrobjectptr_t object)
+{
+	RootEntry searchEntry;
+	searchEntry.name = "freePageReturnerRoot";
+	RootEntry *rootEntry = (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
+	if (NULL != rootEntry) {
+		hashTableRemove(exampleVM->rootTable, rootEntry);
+	}
+	if (NULL != object) {
+		RootEntry newEntry;
+		newEntry.name = searchEntry.name;
+		newEntry.rootPtr = object;
+		ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &newEntry));
+	}
+}
+
+/**
+ * Run a global collection and wait for the returner pass it triggers.
+ */
+bool
+FreePageReturnerTest::collect(MM_FreePageReturner *returner)
+{
+	uintptr_t passCount = returner->getPassCount();
+	if (OMR_ERROR_NONE != OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_NOT_AGGRESSIVE)) {
+		return false;
+	}
+	return returner->waitForPasses(passCount + 1, FREE_PAGE_RETURNER_TEST_TIMEOUT_MILLIS);
+}
+
+TEST_F(FreePageReturnerTest, releaseIdleFreeEntries)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->freePageReturner);
+	ASSERT_EQ((uintptr_t)2, extensions->freePageReturnerIdleCycles);
+
+	MM_FreePageReturner *returner = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getFreePageReturner();
+#if defined(LINUX) || defined(OSX)
+	ASSERT_TRUE(NULL != returner);
+#else /* defined(LINUX) || defined(OSX) */
+	/* decommitted heap pages are not mapped back in on touch, the returner is not started */
+	ASSERT_TRUE(NULL == returner);
+	return;
+#endif /* defined(LINUX) || defined(OSX) */
+
+	/* the free memory of the heap has only been free at the end of one collection */
+	ASSERT_TRUE(collect(returner));
+	EXPECT_EQ((uint64_t)0, returner->getReleasedBytes());
+
+	/* the second collection in a row decommits it */
+	ASSERT_TRUE(collect(returner));
+	uint64_t releasedBytes = returner->getReleasedBytes();
+	EXPECT_LT((uint64_t)FREE_PAGE_RETURNER_TEST_OBJECT_SIZE, releasedBytes);
+	gcTestEnv->log("released %llu bytes in %zu byte granules\n", releasedBytes, returner->getGranuleSize());
+
+	/* pages which stay free are not counted again */
+	ASSERT_TRUE(collect(returner));
+	EXPECT_EQ(releasedBytes, returner->getReleasedBytes());
+
+	/* allocating from decommitted pages maps them back in */
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+			MM_ObjectAllocationModel(env, FREE_PAGE_RETURNER_TEST_OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+	omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+	ASSERT_TRUE(NULL != object);
+	/* every slot of an example object is a reference, writing NULL into each touches all of its pages */
+	memset((uint8_t *)object + sizeof(uintptr_t), 0, FREE_PAGE_RETURNER_TEST_OBJECT_SIZE - sizeof(uintptr_t));
+	setRoot(object);
+
+	/* the pages of the live object start a new idle period once it dies */
+	ASSERT_TRUE(collect(returner));
+	EXPECT_EQ(releasedBytes, returner->getReleasedBytes());
+	setRoot(NULL);
+	ASSERT_TRUE(collect(returner));
+	EXPECT_EQ(releasedBytes, returner->getReleasedBytes());
+	ASSERT_TRUE(collect(returner));
+	EXPECT_LE(releasedBytes + FREE_PAGE_RETURNER_TEST_OBJECT_SIZE - (2 * returner->getGranuleSize()), returner->getReleasedBytes());
+}
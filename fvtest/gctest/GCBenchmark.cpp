@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * GC pause and throughput benchmark. Each workload is a GCConfigTest configuration whose object graph is built
+ * by the GCConfigTest builders, so every run allocates the same objects in the same order. A workload is run under
+ * every GC policy built into the collector and several GC thread counts, and one CSV row of pause percentiles,
+ * throughput and resident set size is reported per run, appended to the file named by -gcBenchmarkResults=<file>
+ * or written to the test log.
+ */
+
+#include <algorithm>
+
+#include "GCConfigTest.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "VerboseManager.hpp"
+
+#define BENCHMARK_ROW_LENGTH 512
+#define BENCHMARK_HEADER "workload,policy,threads,gcs,pauses,p50ms,p90ms,p99ms,maxms,totalpausems,elapsedms,allocatedmb,mbpersecond,gcpercent,rssmb\n"
+
+const char *benchmarkWorkloads[] = {"perftest/gctest/configuration/benchmark_wide_arrays.xml"
+                                   , "perftest/gctest/configuration/benchmark_deep_lists.xml"
+                                   , "perftest/gctest/configuration/benchmark_high_survival_cache.xml"
+                                   };
+
+const char *benchmarkPolicies[] = {"optthruput"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                                  , "optavgpause"
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+                                  , "gencon"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                                  , "segregated"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+                                  };
+
+const uintptr_t benchmarkThreadCounts[] = {1, 2, 4};
+
+class GCBenchmark : public GCConfigTest
+{
+	/*
+	 * Function members
+	 */
+protected:
+	/**
+	 * Read the pause of every exclusive access and the number of GC cycles from the verbose log of the current run.
+	 * @param[out] pauses the pause durations in milliseconds
+	 * @param[out] gcCount the number of GC cycles
+	 * @return 0 on success
+	 */
+	int32_t readPauses(std::vector<double> *pauses, uintptr_t *gcCount);
+	void report(const char *row);
+
+	/* every run starts up and shuts down its own heap */
+	virtual void SetUp() {}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != env) {
+			shutDown();
+		}
+	}
+
+public:
+	GCBenchmark()
+		: GCConfigTest()
+	{
+	}
+};
+
+/**
+ * @return the smallest pause such that at least percent of all pauses are not longer (nearest rank)
+ */
+static double
+percentile(std::vector<double> &sortedPauses, uintptr_t percent)
+{
+	if (sortedPauses.empty()) {
+		return 0.0;
+	}
+	size_t rank = ((sortedPauses.size() * percent) + 99) / 100;
+	return sortedPauses[OMR_MAX(rank, 1) - 1];
+}
+
+int32_t
+GCBenchmark::readPauses(std::vector<double> *pauses, uintptr_t *gcCount)
+{
+	pugi::xml_document verboseDoc;
+	pugi::xml_parse_result result = loadVerboseLog(verboseDoc, verboseFile);
+	if (pugi::status_file_not_found == result.status) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not open verbose log %s.\n", __FILE__, __LINE__, verboseFile);
+		return 1;
+	}
+
+	pugi::xpath_node_set exclusiveEnds = verboseDoc.select_nodes("//exclusive-end");
+	for (pugi::xpath_node_set::const_iterator it = exclusiveEnds.begin(); it != exclusiveEnds.end(); ++it) {
+		pauses->push_back(it->node().attribute("durationms").as_double());
+	}
+	*gcCount = verboseDoc.select_nodes("//cycle-end").size();
+	return 0;
+}
+
+void
+GCBenchmark::report(const char *row)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	if (NULL == gcTestEnv->benchmarkResults) {
+		gcTestEnv->log("%s", row);
+	} else {
+		bool isNew = (EsIsFile != omrfile_attr(gcTestEnv->benchmarkResults));
+		intptr_t fileDescriptor = omrfile_open(gcTestEnv->benchmarkResults, EsOpenWrite | EsOpenCreate | EsOpenAppend, 0666);
+		ASSERT_NE(-1, fileDescriptor) << "Failed to open benchmark results file " << gcTestEnv->benchmarkResults;
+		if (isNew) {
+			omrfile_write_text(fileDescriptor, BENCHMARK_HEADER, strlen(BENCHMARK_HEADER));
+		}
+		omrfile_write_text(fileDescriptor, row, strlen(row));
+		omrfile_close(fileDescriptor);
+	}
+}
+
+TEST_P(GCBenchmark, run)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	/* the workload name is the configuration file name without its directory and extension */
+	const char *workload = strrchr(GetParam(), '/') + 1;
+	size_t workloadLength = strrchr(workload, '.') - workload;
+
+	if (NULL == gcTestEnv->benchmarkResults) {
+		gcTestEnv->log("%s", BENCHMARK_HEADER);
+	}
+	for (size_t i = 0; i < sizeof(benchmarkPolicies) / sizeof(benchmarkPolicies[0]); i++) {
+		for (size_t j = 0; j < sizeof(benchmarkThreadCounts) / sizeof(benchmarkThreadCounts[0]); j++) {
+			ASSERT_NO_FATAL_FAILURE(startUp(benchmarkPolicies[i], benchmarkThreadCounts[j]));
+			MM_GCExtensionsBase *extensions = env->getExtensions();
+			uintptr_t threadCount = extensions->dispatcher->threadCountMaximum();
+
+			uint64_t startTime = omrtime_hires_clock();
+			ASSERT_NO_FATAL_FAILURE(runConfiguration());
+			uint64_t elapsedMicros = OMR_MAX(1, omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+			uintptr_t residentBytes = getResidentSetSize(gcTestEnv->portLib);
+
+			std::vector<double> pauses;
+			uintptr_t gcCount = 0;
+			ASSERT_EQ(0, readPauses(&pauses, &gcCount)) << "Failed to read pauses from the verbose log.";
+			std::sort(pauses.begin(), pauses.end());
+			double totalPauseMillis = 0.0;
+			for (size_t k = 0; k < pauses.size(); k++) {
+				totalPauseMillis += pauses[k];
+			}
+			double elapsedMillis = (double)elapsedMicros / 1000.0;
+			double allocatedMB = (double)allocatedBytes / (1024.0 * 1024.0);
+
+			char row[BENCHMARK_ROW_LENGTH];
+			omrstr_printf(row, sizeof(row), "%.*s,%s,%zu,%zu,%zu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f,%.3f\n",
+					(int)workloadLength, workload, benchmarkPolicies[i], threadCount, gcCount, pauses.size(),
+					percentile(pauses, 50), percentile(pauses, 90), percentile(pauses, 99), percentile(pauses, 100), totalPauseMillis,
+					elapsedMillis, allocatedMB, (allocatedMB * 1000.0) / elapsedMillis, (totalPauseMillis * 100.0) / elapsedMillis,
+					(double)residentBytes / (1024.0 * 1024.0));
+			ASSERT_NO_FATAL_FAILURE(report(row));
+
+			ASSERT_NO_FATAL_FAILURE(shutDown());
+		}
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(perfTestGCBenchmark, GCBenchmark,
+        ::testing::ValuesIn(benchmarkWorkloads));
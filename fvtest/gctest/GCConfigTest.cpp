@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2018 IBM Corp. and others
+ * Copyright (c) 2015, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -28,7 +28,9 @@
 #include "omrgc.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryLogConverter.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
@@ -43,16 +45,33 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binary_verbose_config.xml"
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/global_GC_concurrent_sweep_config.xml"
+#endif
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+                        , "fvtest/gctest/configuration/global_GC_free_page_returner_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_tlh_size_class_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_pacer_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptive_threads_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_hierarchical_copy_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_huge_pages_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_remembered_set_cards_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_pause_target_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_pause_target_contract_config.xml"
 #endif
                         };
 
@@ -60,13 +79,27 @@ const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.20
 								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
 void
 GCConfigTest::SetUp()
+{
+	startUp(NULL, 0);
+}
+
+void
+GCConfigTest::TearDown()
+{
+	shutDown();
+}
+
+void
+GCConfigTest::startUp(const char *gcPolicy, uintptr_t gcThreadCount)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
 	printMemUsed("Setup()", gcTestEnv->portLib);
 
 	gcTestEnv->log("Configuration File: %s\n", GetParam());
-	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, GetParam());
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, GetParam(), gcPolicy, gcThreadCount);
+	gp.garbageSeq = 0;
+	allocatedBytes = 0;
 
 	/* Initialize heap and collector */
 	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
@@ -128,7 +161,7 @@ GCConfigTest::SetUp()
 }
 
 void
-GCConfigTest::TearDown()
+GCConfigTest::shutDown()
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
@@ -183,6 +216,7 @@ GCConfigTest::TearDown()
 
 	if (NULL != cli) {
 		cli->kill(env);
+		cli = NULL;
 	}
 
 	if (NULL != exampleVM->_omrVMThread) {
@@ -199,6 +233,7 @@ GCConfigTest::TearDown()
 	ASSERT_EQ(OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM), OMR_ERROR_NONE);
 
 	exampleVM->_omrVMThread = NULL;
+	env = NULL;
 
 	printMemUsed("TearDown()", gcTestEnv->portLib);
 }
@@ -327,6 +362,7 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 		} else {
 			gcTestEnv->log(LEVEL_ERROR, "Consumed size for allocated object name: %s(%p[0x%llx]) != adjusted request size [0x%llx].\n", objEntry.name, objEntry.objPtr, consumedSize, adjustedSize);
 		}
+		allocatedBytes += consumedSize;
 		newEntry = add(&objEntry);
 	} else {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d No free memory after a GC. Failed to allocate object %s of size 0x%llx.\n", __FILE__, __LINE__, objName, size);
@@ -809,6 +845,39 @@ printFile(const char *name)
 }
 #endif
 
+/**
+ * Load a verbose log, converting it to XML first if it was written by the binary writer.
+ */
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document &verboseDoc, const char *logFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+
+	if (!extensions->verboseBinaryLogging) {
+		return verboseDoc.load_file(logFile);
+	}
+
+	pugi::xml_parse_result result;
+	if (EsIsFile != omrfile_attr(logFile)) {
+		result.status = pugi::status_file_not_found;
+		return result;
+	}
+
+	char convertedFile[MAX_NAME_LENGTH];
+	omrstr_printf(convertedFile, MAX_NAME_LENGTH, "%s.converted.xml", logFile);
+	if (MM_VerboseBinaryLogConverter::convert(gcTestEnv->portLib, logFile, convertedFile)) {
+		result = verboseDoc.load_file(convertedFile);
+	} else {
+		gcTestEnv->log(LEVEL_ERROR, "*FAILED* Could not convert binary verbose log %s.\n", logFile);
+		result.status = pugi::status_io_error;
+	}
+	if (false == gcTestEnv->keepLog) {
+		omrfile_unlink(convertedFile);
+	}
+	return result;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -826,11 +895,18 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		isFound[i] = false;
 	}
 
+	/* the binary writer logs from a background thread, wait for it to catch up */
+	for (MM_VerboseWriter *writer = verboseManager->getWriterChain()->getFirstWriter(); NULL != writer; writer = writer->getNextWriter()) {
+		if (VERBOSE_WRITER_FILE_LOGGING_BINARY == writer->getType()) {
+			((MM_VerboseWriterFileLoggingBinary *)writer)->drain(env);
+		}
+	}
+
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseLog(verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +914,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseLog(verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -1011,7 +1087,8 @@ GCConfigTest::iniXMLStr(const char *configStyle)
 	return rt;
 }
 
-TEST_P(GCConfigTest, test)
+void
+GCConfigTest::runConfiguration()
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
@@ -1059,6 +1136,11 @@ TEST_P(GCConfigTest, test)
 	}
 }
 
+TEST_P(GCConfigTest, test)
+{
+	runConfiguration();
+}
+
 INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
         ::testing::ValuesIn(gcTests));
 
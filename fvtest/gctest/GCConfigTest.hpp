@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2016 IBM Corp. and others
+ * Copyright (c) 2015, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -81,6 +81,7 @@ protected:
 	pugi::xml_document doc;
 	GarbagePolicy gp;
 	XmlStr xs;
+	uintptr_t allocatedBytes; /**< Bytes allocated for objects since startUp() */
 
 	/* verbose log options */
 	MM_VerboseManager *verboseManager;
@@ -107,11 +108,25 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_result loadVerboseLog(pugi::xml_document &verboseDoc, const char *logFile);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
+	/**
+	 * Initialize the heap and collector for the configuration file of the test parameter.
+	 * @param gcPolicy GC policy overriding the one of the configuration file, or NULL
+	 * @param gcThreadCount GC thread count overriding the one of the configuration file, or 0
+	 */
+	void startUp(const char *gcPolicy, uintptr_t gcThreadCount);
+	void shutDown();
+
+	/**
+	 * Perform the allocations, operations and verifications of the configuration file in order.
+	 */
+	void runConfiguration();
+
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
 	 * be moved whenever new entries are added. This complicates the usage of ObjectEntry pointers that
 	 * are returned from find() and add(), because these pointers may become invalid if new entries are
@@ -156,6 +171,7 @@ public:
 		, exampleVM(&(gcTestEnv->exampleVM))
 		, env(NULL)
 		, cli(NULL)
+		, allocatedBytes(0)
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
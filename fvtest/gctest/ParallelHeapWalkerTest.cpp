@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/*
+ * Batched object walks of MM_ParallelHeapWalker must report the same objects as the per object walk,
+ * in batches that never exceed the requested size or span regions, both from the walkable heap and,
+ * when the mark map is valid, from the mark map alone.
+ */
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "MarkMap.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+
+#define HEAP_WALKER_TEST_OBJECT_COUNT 2000
+#define HEAP_WALKER_TEST_OBJECT_SIZE 64
+#define HEAP_WALKER_TEST_BATCH_SIZE 7
+
+typedef struct HeapWalkCount {
+	MM_MarkMap *markMap; /**< Only objects marked in this map are counted, NULL to count every object */
+	uintptr_t batchSize;
+	volatile uintptr_t objectCount;
+	volatile uintptr_t addressSum; /**< Sum of the reported object addresses, wrapping */
+	volatile uintptr_t batchCount;
+	volatile uintptr_t badBatchCount; /**< Batches that were empty, too large or not within their region */
+} HeapWalkCount;
+
+class ParallelHeapWalkerTest : public GCHeapTest
+{
+public:
+	ParallelHeapWalkerTest()
+		: GCHeapTest("fvtest/gctest/configuration/global_GC_config.xml")
+	{
+	}
+};
+
+static void
+countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkCount *count = (HeapWalkCount *)userData;
+	if ((NULL == count->markMap) || count->markMap->isBitSet(object)) {
+		count->objectCount += 1;
+		count->addressSum += (uintptr_t)object;
+	}
+}
+
+static void
+countObjectBatch(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t objectCount, void *userData)
+{
+	HeapWalkCount *count = (HeapWalkCount *)userData;
+	uintptr_t addressSum = 0;
+	bool badBatch = (0 == objectCount) || (count->batchSize < objectCount);
+
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		addressSum += (uintptr_t)objects[i];
+		badBatch = badBatch || !region->isAddressInRegion(objects[i]);
+	}
+	MM_AtomicOperations::add(&count->objectCount, objectCount);
+	MM_AtomicOperations::add(&count->addressSum, addressSum);
+	MM_AtomicOperations::add(&count->batchCount, 1);
+	if (badBatch) {
+		MM_AtomicOperations::add(&count->badBatchCount, 1);
+	}
+}
+
+static void
+resetCount(HeapWalkCount *count, MM_MarkMap *markMap, uintptr_t batchSize)
+{
+	count->markMap = markMap;
+	count->batchSize = batchSize;
+	count->objectCount = 0;
+	count->addressSum = 0;
+	count->batchCount = 0;
+	count->badBatchCount = 0;
+}
+
+TEST_F(ParallelHeapWalkerTest, batchedWalkMatchesObjectWalk)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+	MM_MarkMap *markMap = heapWalker->getMarkMap();
+	omrobjectptr_t objects[HEAP_WALKER_TEST_OBJECT_COUNT];
+
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+	for (uintptr_t i = 0; i < HEAP_WALKER_TEST_OBJECT_COUNT; i++) {
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, HEAP_WALKER_TEST_OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		objects[i] = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+		ASSERT_TRUE(NULL != objects[i]) << "failed to allocate object " << i;
+	}
+
+	HeapWalkCount expected;
+	HeapWalkCount actual;
+
+	/* walkable heap, every object is reported */
+	resetCount(&expected, NULL, 0);
+	heapWalker->allObjectsDo(env, countObject, &expected, 0, false, false);
+	ASSERT_LE((uintptr_t)HEAP_WALKER_TEST_OBJECT_COUNT, expected.objectCount);
+
+	bool parallel[] = {false, true};
+	uintptr_t batchSizes[] = {1, HEAP_WALKER_TEST_BATCH_SIZE, HEAP_WALKER_MAX_BATCH_SIZE};
+	for (uintptr_t p = 0; p < sizeof(parallel) / sizeof(parallel[0]); p++) {
+		for (uintptr_t b = 0; b < sizeof(batchSizes) / sizeof(batchSizes[0]); b++) {
+			resetCount(&actual, NULL, batchSizes[b]);
+			heapWalker->allObjectsBatchDo(env, countObjectBatch, &actual, 0, batchSizes[b], 0, parallel[p], false);
+			EXPECT_EQ(expected.objectCount, actual.objectCount) << "parallel=" << parallel[p] << " batchSize=" << batchSizes[b];
+			EXPECT_EQ(expected.addressSum, actual.addressSum) << "parallel=" << parallel[p] << " batchSize=" << batchSizes[b];
+			EXPECT_EQ((uintptr_t)0, actual.badBatchCount) << "parallel=" << parallel[p] << " batchSize=" << batchSizes[b];
+		}
+	}
+
+	/* valid mark map, only marked objects are reported whatever the chunk size */
+	for (uintptr_t i = 0; i < HEAP_WALKER_TEST_OBJECT_COUNT; i += 3) {
+		markMap->setBit(objects[i]);
+	}
+	markMap->setMarkMapValid(true);
+
+	resetCount(&expected, markMap, 0);
+	heapWalker->allObjectsDo(env, countObject, &expected, 0, false, false);
+	ASSERT_LE((uintptr_t)(HEAP_WALKER_TEST_OBJECT_COUNT / 3), expected.objectCount);
+
+	uintptr_t chunkSizes[] = {0, J9MODRON_HMI_HEAPMAP_ALIGNMENT, 4096, HEAP_WALKER_TEST_OBJECT_SIZE * 100};
+	for (uintptr_t p = 0; p < sizeof(parallel) / sizeof(parallel[0]); p++) {
+		for (uintptr_t c = 0; c < sizeof(chunkSizes) / sizeof(chunkSizes[0]); c++) {
+			resetCount(&actual, NULL, HEAP_WALKER_TEST_BATCH_SIZE);
+			heapWalker->allObjectsBatchDo(env, countObjectBatch, &actual, 0, HEAP_WALKER_TEST_BATCH_SIZE, chunkSizes[c], parallel[p], false);
+			EXPECT_EQ(expected.objectCount, actual.objectCount) << "parallel=" << parallel[p] << " chunkSize=" << chunkSizes[c];
+			EXPECT_EQ(expected.addressSum, actual.addressSum) << "parallel=" << parallel[p] << " chunkSize=" << chunkSizes[c];
+			EXPECT_EQ((uintptr_t)0, actual.badBatchCount) << "parallel=" << parallel[p] << " chunkSize=" << chunkSizes[c];
+		}
+	}
+	gcTestEnv->log("%zu marked objects walked in %zu batches\n", actual.objectCount, actual.batchCount);
+
+	markMap->setMarkMapValid(false);
+	for (uintptr_t i = 0; i < HEAP_WALKER_TEST_OBJECT_COUNT; i += 3) {
+		markMap->clearBit(objects[i]);
+	}
+}
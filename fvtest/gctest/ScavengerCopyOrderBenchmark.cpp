@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Mutator traversal speed over linked structures laid out by a scavenge, with and without hierarchical copying.
+ * The nodes of many binary trees are allocated level by level, interleaved across the trees, so that parents and
+ * children start out far apart; a single threaded scavenge then lays them out in its copy order, and the trees are
+ * walked depth first as a mutator would.
+ */
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "Heap.hpp"
+#include "MemorySpace.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "SlotObject.hpp"
+#include "StandardWriteBarrier.hpp"
+
+#define COPY_ORDER_TREE_COUNT 64
+#define COPY_ORDER_TREE_DEPTH 13
+#define COPY_ORDER_TREE_NODES ((1 << COPY_ORDER_TREE_DEPTH) - 1)
+#define COPY_ORDER_NODE_SIZE (sizeof(uintptr_t) + (2 * sizeof(fomrobject_t)))
+#define COPY_ORDER_TRAVERSALS 10
+#define COPY_ORDER_NEAR_DISTANCE 256 /**< A child this close after its parent shares the parent's block of cache lines */
+
+typedef struct TraversalResult {
+	uintptr_t nodeCount;
+	uintptr_t nearChildCount; /**< Children found within COPY_ORDER_NEAR_DISTANCE bytes after their parent */
+	uint64_t nanosPerNode;
+} TraversalResult;
+
+class ScavengerCopyOrderBenchmark : public GCHeapTest
+{
+protected:
+	char rootNames[COPY_ORDER_TREE_COUNT][32];
+
+	virtual void SetUp();
+	void buildTrees(omrobjectptr_t *nodes);
+	void setRoots(omrobjectptr_t *roots);
+	omrobjectptr_t getRoot(uintptr_t tree);
+	void traverse(TraversalResult *result);
+
+public:
+	ScavengerCopyOrderBenchmark()
+		: GCHeapTest("perftest/gctest/configuration/scavenger_copy_order_config.xml", true, true)
+	{
+	}
+};
+
+void
+ScavengerCopyOrderBenchmark::SetUp()
+{
+	ASSERT_NO_FATAL_FAILURE(GCHeapTest::SetUp());
+
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	for (uintptr_t i = 0; i < COPY_ORDER_TREE_COUNT; i++) {
+		omrstr_printf(rootNames[i], sizeof(rootNames[i]), "copyOrderTree_%zu", i);
+	}
+}
+
+/**
+ * Allocate the trees without letting a collection move them. nodes is indexed by tree then by breadth first
+ * position within the tree, so the children of node n of a tree are nodes 2n + 1 and 2n + 2.
+ */
+void
+ScavengerCopyOrderBenchmark::buildTrees(omrobjectptr_t *nodes)
+{
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+
+	for (uintptr_t level = 0; level < COPY_ORDER_TREE_DEPTH; level++) {
+		uintptr_t first = ((uintptr_t)1 << level) - 1;
+		uintptr_t last = ((uintptr_t)2 << level) - 1;
+		for (uintptr_t tree = 0; tree < COPY_ORDER_TREE_COUNT; tree++) {
+			for (uintptr_t node = first; node < last; node++) {
+				MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+						MM_ObjectAllocationModel(env, COPY_ORDER_NODE_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+				omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+				ASSERT_TRUE(NULL != object) << "failed to allocate node " << node << " of tree " << tree;
+				nodes[(tree * COPY_ORDER_TREE_NODES) + node] = object;
+				if (0 != node) {
+					omrobjectptr_t parent = nodes[(tree * COPY_ORDER_TREE_NODES) + ((node - 1) / 2)];
+					fomrobject_t *parentSlot = (fomrobject_t *)parent + 1 + ((node - 1) % 2);
+					standardWriteBarrierStore(exampleVM->_omrVMThread, parent, parentSlot, object);
+				}
+			}
+		}
+	}
+}
+
+void
+ScavengerCopyOrderBenchmark::setRoots(omrobjectptr_t *roots)
+{
+	for (uintptr_t tree = 0; tree < COPY_ORDER_TREE_COUNT; tree++) {
+		RootEntry searchEntry;
+		searchEntry.name = rootNames[tree];
+		RootEntry *rootEntry = (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
+		if (NULL != rootEntry) {
+			hashTableRemove(exampleVM->rootTable, rootEntry);
+		}
+		if (NULL != roots) {
+			RootEntry newEntry;
+			newEntry.name = rootNames[tree];
+			newEntry.rootPtr = roots[tree * COPY_ORDER_TREE_NODES];
+			ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &newEntry));
+		}
+	}
+}
+
+omrobjectptr_t
+ScavengerCopyOrderBenchmark::getRoot(uintptr_t tree)
+{
+	RootEntry searchEntry;
+	searchEntry.name = rootNames[tree];
+	RootEntry *rootEntry = (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
+	return (NULL == rootEntry) ? NULL : rootEntry->rootPtr;
+}
+
+/**
+ * Walk every tree depth first, reading each reference slot as a mutator would.
+ */
+void
+ScavengerCopyOrderBenchmark::traverse(TraversalResult *result)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	omrobjectptr_t stack[2 * COPY_ORDER_TREE_DEPTH];
+	uintptr_t nodeCount = 0;
+	uintptr_t nearChildCount = 0;
+
+	uint64_t startTime = omrtime_hires_clock();
+	for (uintptr_t traversal = 0; traversal < COPY_ORDER_TRAVERSALS; traversal++) {
+		nodeCount = 0;
+		nearChildCount = 0;
+		for (uintptr_t tree = 0; tree < COPY_ORDER_TREE_COUNT; tree++) {
+			uintptr_t depth = 0;
+			stack[depth++] = getRoot(tree);
+			while (0 != depth) {
+				omrobjectptr_t node = stack[--depth];
+				nodeCount += 1;
+				for (uintptr_t i = 2; i > 0; i--) {
+					GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)node + i);
+					omrobjectptr_t child = slotObject.readReferenceFromSlot();
+					if (NULL != child) {
+						if (((uintptr_t)child > (uintptr_t)node) && (((uintptr_t)child - (uintptr_t)node) < COPY_ORDER_NEAR_DISTANCE)) {
+							nearChildCount += 1;
+						}
+						stack[depth++] = child;
+					}
+				}
+			}
+		}
+	}
+	uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	result->nodeCount = nodeCount;
+	result->nearChildCount = nearChildCount;
+	result->nanosPerNode = elapsed / OMR_MAX(1, (uint64_t)nodeCount * COPY_ORDER_TRAVERSALS);
+}
+
+TEST_F(ScavengerCopyOrderBenchmark, traversalAfterScavenge)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_EQ(MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL, extensions->scavengerScanOrdering);
+	uintptr_t treeNodeCount = COPY_ORDER_TREE_COUNT * COPY_ORDER_TREE_NODES;
+	omrobjectptr_t *nodes = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * treeNodeCount, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != nodes);
+
+	const char *modes[] = {"aliasing", "hierarchical copy"};
+	TraversalResult results[2];
+	uint64_t hierarchicalCopyCounts[2];
+
+	gcTestEnv->log("%18s %12s %14s %14s\n", "copy order", "nodes", "near children", "ns/node");
+	for (uintptr_t mode = 0; mode < 2; mode++) {
+		extensions->scavengerHierarchicalCopy = (1 == mode);
+
+		/* the trees of the previous mode die in the scavenge that lays out the new ones */
+		buildTrees(nodes);
+		if (HasFatalFailure()) {
+			break;
+		}
+		setRoots(nodes);
+
+		if (0 == mode) {
+			TraversalResult allocationOrder;
+			traverse(&allocationOrder);
+			EXPECT_EQ(treeNodeCount, allocationOrder.nodeCount);
+			gcTestEnv->log("%18s %12zu %14zu %14llu\n", "allocation", allocationOrder.nodeCount, allocationOrder.nearChildCount, allocationOrder.nanosPerNode);
+		}
+
+		uintptr_t gcCount = extensions->scavengerStats._gcCount;
+		extensions->heap->getDefaultMemorySpace()->localGarbageCollect(env, J9MMCONSTANT_IMPLICIT_GC_DEFAULT);
+		ASSERT_EQ(gcCount + 1, extensions->scavengerStats._gcCount) << "no scavenge in mode " << modes[mode];
+		hierarchicalCopyCounts[mode] = extensions->scavengerStats._hierarchicalCopyCount;
+
+		traverse(&results[mode]);
+		EXPECT_EQ(treeNodeCount, results[mode].nodeCount) << "trees damaged in mode " << modes[mode];
+		gcTestEnv->log("%18s %12zu %14zu %14llu\n", modes[mode], results[mode].nodeCount, results[mode].nearChildCount, results[mode].nanosPerNode);
+	}
+
+	if (!HasFatalFailure()) {
+		EXPECT_EQ((uint64_t)0, hierarchicalCopyCounts[0]);
+		EXPECT_LT((uint64_t)0, hierarchicalCopyCounts[1]);
+		/* a single threaded scavenge lays the trees out deterministically, copying children ahead must bring them closer */
+		EXPECT_LT(results[0].nearChildCount, results[1].nearChildCount);
+	}
+
+	extensions->scavengerHierarchicalCopy = false;
+	setRoots(NULL);
+	omrmem_free_memory(nodes);
+}
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Allocation throughput of the segregated small object path. Each configuration starts a segregated heap,
+ * with or without allocation magazines, and threads attached to the VM allocate through OMR_GC_AllocateObject
+ * so every cache replenish goes through MM_SegregatedAllocationInterface and the allocation context. The
+ * objects are garbage and are reclaimed by a global collection between measurements.
+ *
+ * This is a benchmark rather than a functional test, run it with:
+ *   omrgctest --gtest_filter=perfTest* -logLevel=info
+ */
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrgc.h"
+#include "SizeClasses.hpp"
+
+#define BENCHMARK_BYTES_PER_RUN (64 * 1024 * 1024)
+#define BENCHMARK_MAX_THREADS 16
+#define BENCHMARK_TIMEOUT_MILLIS 60000
+
+const char *segregatedAllocationConfigurations[] = {"perftest/gctest/configuration/segregated_allocation_config.xml"
+                                                  , "perftest/gctest/configuration/segregated_allocation_magazines_config.xml"};
+
+typedef struct BenchmarkRun {
+	omrthread_monitor_t monitor; /**< Protects the run state */
+	OMR_VM *omrVM;
+	uintptr_t sizeInBytes;
+	uintptr_t allocationsPerThread;
+	uintptr_t threadCount;
+	uintptr_t startedCount;
+	uintptr_t finishedCount;
+	uintptr_t failedCount; /**< Threads that could not attach or whose allocations failed */
+	bool go;
+} BenchmarkRun;
+
+class SegregatedAllocationBenchmark : public GCHeapTest, public ::testing::WithParamInterface<const char *>
+{
+protected:
+	uint64_t measure(BenchmarkRun *run);
+
+public:
+	SegregatedAllocationBenchmark()
+		: GCHeapTest(GetParam(), true, true)
+	{
+	}
+};
+
+static int J9THREAD_PROC
+allocationThread(void *arg)
+{
+	BenchmarkRun *run = (BenchmarkRun *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+	bool failed = (OMR_ERROR_NONE != OMR_Thread_Init(run->omrVM, NULL, &omrVMThread, "SegregatedAllocationBenchmark"));
+
+	omrthread_monitor_enter(run->monitor);
+	run->startedCount += 1;
+	omrthread_monitor_notify_all(run->monitor);
+	while (!run->go) {
+		omrthread_monitor_wait(run->monitor);
+	}
+	omrthread_monitor_exit(run->monitor);
+
+	if (!failed) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		uintptr_t allocationFlags = MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true);
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		for (uintptr_t i = 0; !failed && (i < run->allocationsPerThread); i++) {
+			MM_ObjectAllocationModel *model = new(objectAllocationModelSpace) MM_ObjectAllocationModel(env, run->sizeInBytes, allocationFlags);
+			failed = (NULL == OMR_GC_AllocateObject(omrVMThread, model));
+		}
+		/* flushes the caches and magazines of the thread */
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(run->monitor);
+	run->finishedCount += 1;
+	if (failed) {
+		run->failedCount += 1;
+	}
+	omrthread_monitor_notify_all(run->monitor);
+	omrthread_monitor_exit(run->monitor);
+
+	return 0;
+}
+
+/**
+ * Run threadCount allocating threads to completion.
+ * @return the elapsed time in microseconds, 0 on failure
+ */
+uint64_t
+SegregatedAllocationBenchmark::measure(BenchmarkRun *run)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uint64_t elapsed = 0;
+	intptr_t waitResult = 0;
+
+	run->startedCount = 0;
+	run->finishedCount = 0;
+	run->failedCount = 0;
+	run->go = false;
+
+	for (uintptr_t i = 0; i < run->threadCount; i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 256 * 1024, J9THREAD_PRIORITY_NORMAL, 0, allocationThread, run)) {
+			return 0;
+		}
+	}
+
+	omrthread_monitor_enter(run->monitor);
+	while (run->startedCount < run->threadCount) {
+		omrthread_monitor_wait(run->monitor);
+	}
+	uint64_t startTime = omrtime_hires_clock();
+	run->go = true;
+	omrthread_monitor_notify_all(run->monitor);
+	while ((0 == waitResult) && (run->finishedCount < run->threadCount)) {
+		waitResult = omrthread_monitor_wait_timed(run->monitor, BENCHMARK_TIMEOUT_MILLIS, 0);
+	}
+	if ((0 == waitResult) && (0 == run->failedCount)) {
+		elapsed = OMR_MAX(1, omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+	omrthread_monitor_exit(run->monitor);
+
+	return elapsed;
+}
+
+TEST_P(SegregatedAllocationBenchmark, allocationsPerSecond)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_GlobalAllocationManagerSegregated *globalAllocationManager = (MM_GlobalAllocationManagerSegregated *)extensions->globalAllocationManager;
+	ASSERT_EQ(extensions->segregatedAllocationMagazines, NULL != globalAllocationManager->getMagazineDepot());
+
+	MM_SizeClasses *sizeClasses = extensions->defaultSizeClasses;
+	uintptr_t threadCounts[] = {1, 2, 4, 0};
+	BenchmarkRun run;
+
+	threadCounts[3] = OMR_MIN(BENCHMARK_MAX_THREADS, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&run.monitor, 0, "SegregatedAllocationBenchmark"));
+	run.omrVM = exampleVM->_omrVM;
+
+	gcTestEnv->log("%s\n", GetParam());
+	gcTestEnv->log("%10s %9s %7s %14s\n", "size class", "cell size", "threads", "allocs/s");
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		/* objects filling their cell exactly, the allocation size includes the header */
+		uintptr_t cellSize = sizeClasses->getCellSize(sizeClass);
+		run.sizeInBytes = cellSize;
+
+		for (uintptr_t i = 0; i < sizeof(threadCounts) / sizeof(threadCounts[0]); i++) {
+			if ((0 != i) && (threadCounts[i] <= threadCounts[i - 1])) {
+				continue;
+			}
+			run.threadCount = threadCounts[i];
+			run.allocationsPerThread = BENCHMARK_BYTES_PER_RUN / (cellSize * run.threadCount);
+
+			uint64_t micros = measure(&run);
+			ASSERT_NE((uint64_t)0, micros) << "allocation threads failed or did not complete";
+
+			uint64_t allocations = (uint64_t)run.allocationsPerThread * run.threadCount;
+			gcTestEnv->log("%10zu %9zu %7zu %14llu\n", sizeClass, cellSize, run.threadCount, (allocations * 1000000) / micros);
+
+			/* every object allocated is garbage */
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+		}
+	}
+
+	omrthread_monitor_destroy(run.monitor);
+}
+
+INSTANTIATE_TEST_CASE_P(perfTestSegregatedAllocation, SegregatedAllocationBenchmark,
+        ::testing::ValuesIn(segregatedAllocationConfigurations));
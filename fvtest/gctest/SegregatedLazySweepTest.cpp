@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Lazy sweep of a segregated heap. A collection leaves the small regions it marked unswept; they are then swept
+ * one at a time by allocation, by the background sweep threads, or all at once by the next collection before
+ * it marks.
+ */
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionIterator.hpp"
+#include "MemoryPoolSegregated.hpp"
+#include "MemorySubSpace.hpp"
+#include "mmprivatehook.h"
+#include "ObjectAllocationModel.hpp"
+#include "omrgc.h"
+#include "RegionPoolSegregated.hpp"
+#include "SizeClasses.hpp"
+
+#define LAZY_SWEEP_TEST_REGION_COUNT 8
+#define LAZY_SWEEP_TEST_SIZE_CLASS (OMR_SIZECLASSES_MIN_SMALL + 3)
+#define LAZY_SWEEP_TEST_TIMEOUT_MILLIS 10000
+
+typedef struct MarkStartCount {
+	MM_RegionPoolSegregated *regionPool;
+	uintptr_t markCount;
+	uintptr_t markWithUnsweptRegionsCount; /**< Marks started while small regions were still waiting for a lazy sweep */
+} MarkStartCount;
+
+class SegregatedLazySweepTest : public GCHeapTest
+{
+protected:
+	MM_RegionPoolSegregated *regionPool;
+
+	void allocateObjects(uintptr_t objectCount);
+	uintptr_t countUnsweptRegions();
+
+	virtual void
+	SetUp()
+	{
+		GCHeapTest::SetUp();
+		regionPool = ((MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool();
+	}
+
+public:
+	SegregatedLazySweepTest(const char *configFile = "fvtest/gctest/configuration/segregated_lazy_sweep_config.xml")
+		: GCHeapTest(configFile, true, true)
+		, regionPool(NULL)
+	{
+	}
+};
+
+class SegregatedLazySweepBackgroundTest : public SegregatedLazySweepTest
+{
+public:
+	SegregatedLazySweepBackgroundTest()
+		: SegregatedLazySweepTest("fvtest/gctest/configuration/segregated_lazy_sweep_background_config.xml")
+	{
+	}
+};
+
+/**
+ * Allocate unreferenced objects filling the cells of the test size class.
+ */
+void
+SegregatedLazySweepTest::allocateObjects(uintptr_t objectCount)
+{
+	uintptr_t cellSize = env->getExtensions()->defaultSizeClasses->getCellSize(LAZY_SWEEP_TEST_SIZE_CLASS);
+	uintptr_t allocationFlags = MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true);
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		MM_ObjectAllocationModel *model = new(objectAllocationModelSpace) MM_ObjectAllocationModel(env, cellSize, allocationFlags);
+		ASSERT_TRUE(NULL != OMR_GC_AllocateObject(exampleVM->_omrVMThread, model)) << "failed to allocate object " << i;
+	}
+}
+
+/**
+ * @return the number of regions of the test size class marked by the last collection and not swept since
+ */
+uintptr_t
+SegregatedLazySweepTest::countUnsweptRegions()
+{
+	GC_HeapRegionIterator regionIterator(env->getExtensions()->heap->getHeapRegionManager());
+	uintptr_t unsweptCount = 0;
+
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	while (NULL != (region = (MM_HeapRegionDescriptorSegregated *)regionIterator.nextRegion())) {
+		if (region->isSmall() && (LAZY_SWEEP_TEST_SIZE_CLASS == region->getSizeClass())
+			&& (MM_HeapRegionDescriptorSegregated::UNSWEPT == regionPool->getSweepState(region))
+		) {
+			unsweptCount += 1;
+		}
+	}
+	return unsweptCount;
+}
+
+static void
+countMarkStart(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MarkStartCount *count = (MarkStartCount *)userData;
+	count->markCount += 1;
+	if (count->regionPool->hasUnsweptSmallRegions()) {
+		count->markWithUnsweptRegionsCount += 1;
+	}
+}
+
+TEST_F(SegregatedLazySweepTest, sweepOnAllocationAndBeforeMark)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->segregatedLazySweep);
+	ASSERT_EQ((uintptr_t)0, extensions->segregatedLazySweepThreads);
+	ASSERT_FALSE(regionPool->hasUnsweptSmallRegions());
+
+	uintptr_t cellCount = extensions->defaultSizeClasses->getNumCells(LAZY_SWEEP_TEST_SIZE_CLASS);
+	ASSERT_NO_FATAL_FAILURE(allocateObjects(LAZY_SWEEP_TEST_REGION_COUNT * cellCount));
+
+	/* the collection marks and leaves every small region it marked unswept */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	uintptr_t unsweptCount = regionPool->getCurrentCountOfSweepRegions(LAZY_SWEEP_TEST_SIZE_CLASS);
+	EXPECT_TRUE(regionPool->hasUnsweptSmallRegions());
+	EXPECT_LE((uintptr_t)LAZY_SWEEP_TEST_REGION_COUNT, unsweptCount);
+	EXPECT_EQ(unsweptCount, countUnsweptRegions());
+
+	/* with no region available, allocation sweeps an unswept one and allocates from it */
+	ASSERT_NO_FATAL_FAILURE(allocateObjects(1));
+	EXPECT_GT(unsweptCount, regionPool->getCurrentCountOfSweepRegions(LAZY_SWEEP_TEST_SIZE_CLASS));
+	EXPECT_LT((uintptr_t)0, regionPool->getCurrentCountOfSweepRegions(LAZY_SWEEP_TEST_SIZE_CLASS));
+	EXPECT_EQ(regionPool->getCurrentCountOfSweepRegions(LAZY_SWEEP_TEST_SIZE_CLASS), countUnsweptRegions());
+
+	/* the next collection completes the lazy sweep before it marks */
+	MarkStartCount markStartCount = {regionPool, 0, 0};
+	J9HookInterface **privateHooks = extensions->getPrivateHookInterface();
+	ASSERT_EQ(0, (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_MARK_START, countMarkStart, OMR_GET_CALLSITE(), &markStartCount));
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_MARK_START, countMarkStart, &markStartCount);
+	EXPECT_EQ((uintptr_t)1, markStartCount.markCount);
+	EXPECT_EQ((uintptr_t)0, markStartCount.markWithUnsweptRegionsCount);
+}
+
+TEST_F(SegregatedLazySweepBackgroundTest, sweepInBackground)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->segregatedLazySweep);
+	ASSERT_EQ((uintptr_t)2, extensions->segregatedLazySweepThreads);
+
+	uintptr_t cellCount = extensions->defaultSizeClasses->getNumCells(LAZY_SWEEP_TEST_SIZE_CLASS);
+	ASSERT_NO_FATAL_FAILURE(allocateObjects(LAZY_SWEEP_TEST_REGION_COUNT * cellCount));
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+
+	/* with no allocation or collection, the background threads sweep every region the collection left unswept */
+	uint64_t startTime = omrtime_current_time_millis();
+	while (regionPool->hasUnsweptSmallRegions() && ((omrtime_current_time_millis() - startTime) < LAZY_SWEEP_TEST_TIMEOUT_MILLIS)) {
+		omrthread_sleep(10);
+	}
+	EXPECT_FALSE(regionPool->hasUnsweptSmallRegions());
+	EXPECT_EQ((uintptr_t)0, countUnsweptRegions());
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2015 IBM Corp. and others
+ * Copyright (c) 2015, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -24,6 +24,42 @@
 #include <string.h>
 #include "pugixml.hpp"
 
+bool
+MM_StartupManagerTestExample::selectGCPolicy(MM_GCExtensionsBase *extensions, const char *policy)
+{
+	bool scavenger = false;
+	bool concurrentMark = false;
+
+	if (0 == j9_cmdla_stricmp(policy, "gencon")) {
+		scavenger = true;
+		concurrentMark = true;
+	} else if (0 == j9_cmdla_stricmp(policy, "optavgpause")) {
+		concurrentMark = true;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	} else if (0 == j9_cmdla_stricmp(policy, "segregated")) {
+		_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+	} else if (0 != j9_cmdla_stricmp(policy, "optthruput")) {
+		return false;
+	}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	extensions->scavengerEnabled = scavenger;
+#else
+	if (scavenger) {
+		gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=%s ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n", policy);
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	extensions->concurrentMark = concurrentMark;
+#else
+	if (concurrentMark) {
+		gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark for GCPolicy=%s ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n", policy);
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+	return true;
+}
+
 bool
 MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensions)
 {
@@ -83,7 +119,71 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "workPacketStealing")) {
+					extensions->workPacketStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhSizeClassCache")) {
+					extensions->tlhSizeClassCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hugePages")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "all")) {
+						extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_ALL;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "nursery")) {
+						extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_NURSERY;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "tenure")) {
+						extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_TENURE;
+					} else if (0 != j9_cmdla_stricmp(attr.value(), "none")) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized huge pages area (expected all, nursery, tenure or none): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "verboseBinaryLogging")) {
+					extensions->verboseBinaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaInterleave")) {
+					extensions->heapNumaInterleave = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "incrementalCompaction")) {
+					extensions->incrementalCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					if (extensions->incrementalCompaction) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->nocompactOnSystemGC = 0;
+					}
+				} else if (0 == strcmp(attr.name(), "incrementalCompactionBudget")) {
+					extensions->incrementalCompactionBudget = atoi(attr.value()) * unitSize;
+#endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+				} else if (0 == strcmp(attr.name(), "scavengerNumaAwareCopy")) {
+					extensions->scavengerNumaAwareCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetCards")) {
+					extensions->scavengerRememberedSetCards = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPauseTarget")) {
+					extensions->scavengerPauseTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerHierarchicalCopy")) {
+					extensions->scavengerHierarchicalCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+				} else if (0 == strcmp(attr.name(), "concurrentScavengerSlowdownTarget")) {
+					extensions->concurrentScavengerSlowdownTarget = atoi(attr.value());
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "segregatedLazySweep")) {
+					extensions->segregatedLazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedLazySweepThreads")) {
+					extensions->segregatedLazySweepThreads = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedAllocationMagazines")) {
+					extensions->segregatedAllocationMagazines = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+				} else if (0 == strcmp(attr.name(), "freePageReturner")) {
+					extensions->freePageReturner = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freePageReturnerMinimumSize")) {
+					extensions->freePageReturnerMinimumSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "freePageReturnerIdleCycles")) {
+					extensions->freePageReturnerIdleCycles = atoi(attr.value());
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
+				} else if (0 == strcmp(attr.name(), "numaSimulatedNodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +191,16 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
-					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "optthruput")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+						extensions->concurrentMark = false;
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+						_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+					} else if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause, optthruput or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,11 +209,25 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentMarkPacer")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentMarkPacer = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMarkPacer=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep=true ignored, requires OMR_GC_CONCURRENT_SWEEP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "forceRememberedSetCards")) {
+					extensions->fvtest_forceRememberedSetCards = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -113,9 +235,22 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					result = false;
 				}
 			}
+			if ((NULL != _gcPolicy) && !selectGCPolicy(extensions, _gcPolicy)) {
+				gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause, optthruput or segregated): %s\n", _gcPolicy);
+				result = false;
+			}
+			if (0 != _gcThreadCount) {
+				extensions->gcThreadCount = _gcThreadCount;
+				extensions->gcThreadCountForced = true;
+			}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 			extensions->fvtest_forceScavengerBackout &= extensions->scavengerEnabled;
 			extensions->fvtest_forcePoisonEvacuate &= extensions->scavengerEnabled;
+			extensions->fvtest_forceRememberedSetCards &= extensions->scavengerRememberedSetCards;
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+			/* concurrent sweep is only supported by the flat configuration */
+			extensions->concurrentSweep &= !extensions->scavengerEnabled;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		}
 	}
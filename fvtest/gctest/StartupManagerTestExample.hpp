@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2015 IBM Corp. and others
+ * Copyright (c) 2015, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -31,6 +31,8 @@ class MM_StartupManagerTestExample : public MM_StartupManagerImpl
 	 */
 private:
 	const char *_configFile;
+	const char *_gcPolicy; /**< Policy overriding the configuration file, NULL to keep the file's */
+	uintptr_t _gcThreadCount; /**< GC thread count overriding the configuration file, 0 to keep the file's */
 protected:
 
 public:
@@ -39,6 +41,13 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Select every collector used by a GC policy: gencon is the scavenger with concurrent mark, optavgpause
+	 * a flat heap with concurrent mark and optthruput a flat heap with neither.
+	 * @return false if the policy is not recognized
+	 */
+	bool selectGCPolicy(MM_GCExtensionsBase *extensions, const char *policy);
+
 protected:
 	/**
 	 * parse gc options in test configuration file
@@ -48,9 +57,15 @@ protected:
 	virtual bool parseLanguageOptions(MM_GCExtensionsBase *extensions);
 
 public:
-	MM_StartupManagerTestExample(OMR_VM *omrVM, const char *configFile)
+	/**
+	 * @param gcPolicy policy overriding the GCPolicy and concurrentMark options of the configuration file, or NULL
+	 * @param gcThreadCount GC thread count overriding the gcthreadCount option of the configuration file, or 0
+	 */
+	MM_StartupManagerTestExample(OMR_VM *omrVM, const char *configFile, const char *gcPolicy = NULL, uintptr_t gcThreadCount = 0)
 		: MM_StartupManagerImpl(omrVM)
 		, _configFile(configFile)
+		, _gcPolicy(gcPolicy)
+		, _gcThreadCount(gcThreadCount)
 	{
 	}
 };
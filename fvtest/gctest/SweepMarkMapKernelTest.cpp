@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Every findMarkedSlot kernel the processor supports must find the same slot as a plain scan, on random mark
+ * maps of varying density with every alignment of the range ends.
+ */
+
+#include <string.h>
+
+#include "gcTestHelpers.hpp"
+#include "SweepMarkMapKernel.hpp"
+
+#define KERNEL_TEST_MAX_SLOTS 512
+#define KERNEL_TEST_MAX_SKEW 8
+#define KERNEL_TEST_TRIALS 200
+
+typedef struct KernelUnderTest {
+	const char *name;
+	MM_SweepMarkMapKernel::FindMarkedSlotFunction findMarkedSlot;
+} KernelUnderTest;
+
+static uintptr_t *
+findMarkedSlotReference(uintptr_t *markMapCurrent, uintptr_t *markMapTop)
+{
+	while ((markMapCurrent < markMapTop) && (0 == *markMapCurrent)) {
+		markMapCurrent += 1;
+	}
+	return markMapCurrent;
+}
+
+/**
+ * xorshift64, so that a failure reproduces from the trial number
+ */
+static uint64_t
+nextRandom(uint64_t *state)
+{
+	uint64_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*state = x;
+	return x;
+}
+
+TEST(gcFunctionalTestSweepMarkMapKernel, kernelsAgreeWithScan)
+{
+	KernelUnderTest kernels[] = {
+		{"scalar", MM_SweepMarkMapKernel::findMarkedSlotScalar},
+#if defined(OMR_GC_SWEEP_SIMD_KERNELS)
+		{"sse4.1", MM_SweepMarkMapKernel::findMarkedSlotSSE41},
+		{"avx2", MM_SweepMarkMapKernel::findMarkedSlotAVX2},
+#endif /* defined(OMR_GC_SWEEP_SIMD_KERNELS) */
+	};
+	const uintptr_t kernelCount = sizeof(kernels) / sizeof(kernels[0]);
+	bool supported[sizeof(kernels) / sizeof(kernels[0])];
+	for (uintptr_t k = 0; k < kernelCount; k++) {
+		supported[k] = MM_SweepMarkMapKernel::isSupported(gcTestEnv->portLib, kernels[k].findMarkedSlot);
+		gcTestEnv->log(LEVEL_VERBOSE, "findMarkedSlot kernel %s: %s\n", kernels[k].name, supported[k] ? "tested" : "not supported");
+	}
+	ASSERT_TRUE(supported[0]);
+
+	uintptr_t markMap[KERNEL_TEST_MAX_SLOTS];
+	uint64_t randomState = 0x9E3779B97F4A7C15ULL;
+	for (uintptr_t trial = 0; trial < KERNEL_TEST_TRIALS; trial++) {
+		/* from empty maps to one set slot in 4, with single bits anywhere in a slot */
+		uintptr_t density = trial % 5;
+		memset(markMap, 0, sizeof(markMap));
+		if (0 != density) {
+			uintptr_t setCount = nextRandom(&randomState) % ((KERNEL_TEST_MAX_SLOTS >> (2 * (5 - density))) + 1);
+			for (uintptr_t i = 0; i < setCount; i++) {
+				uintptr_t slot = nextRandom(&randomState) % KERNEL_TEST_MAX_SLOTS;
+				markMap[slot] |= (uintptr_t)1 << (nextRandom(&randomState) % (sizeof(uintptr_t) * 8));
+			}
+		}
+
+		for (uintptr_t skewLow = 0; skewLow < KERNEL_TEST_MAX_SKEW; skewLow++) {
+			for (uintptr_t skewHigh = 0; skewHigh < KERNEL_TEST_MAX_SKEW; skewHigh++) {
+				uintptr_t *markMapCurrent = markMap + skewLow;
+				uintptr_t *markMapTop = markMap + KERNEL_TEST_MAX_SLOTS - skewHigh;
+				uintptr_t *expected = findMarkedSlotReference(markMapCurrent, markMapTop);
+				for (uintptr_t k = 0; k < kernelCount; k++) {
+					if (supported[k]) {
+						ASSERT_EQ(expected, kernels[k].findMarkedSlot(markMapCurrent, markMapTop))
+							<< kernels[k].name << " kernel, trial " << trial << ", range [" << skewLow << ", " << (KERNEL_TEST_MAX_SLOTS - skewHigh) << ")";
+					}
+				}
+			}
+		}
+	}
+}
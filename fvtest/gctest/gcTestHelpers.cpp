@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2018 IBM Corp. and others
+ * Copyright (c) 2015, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -20,6 +20,9 @@
  *******************************************************************************/
 
 #include "gcTestHelpers.hpp"
+#include "EnvironmentBase.hpp"
+#include "omrgc.h"
+#include "StartupManagerTestExample.hpp"
 #if defined(OMR_OS_WINDOWS)
 /* windows.h defined uintptr_t.  Ignore its definition */
 #define UDATA UDATA_win_
@@ -34,6 +37,8 @@ GCTestEnvironment::initParams()
 	for (int i = 1; i < _argc; i++) {
 		if (0 == strcmp(_argv[i], "-keepVerboseLog")) {
 			keepLog = true;
+		} else if (0 == strncmp(_argv[i], "-gcBenchmarkResults=", strlen("-gcBenchmarkResults="))) {
+			benchmarkResults = _argv[i] + strlen("-gcBenchmarkResults=");
 		}
 	}
 }
@@ -93,6 +98,64 @@ GCTestEnvironment::GCTestTearDown()
 
 }
 
+void
+GCHeapTest::SetUp()
+{
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, _configFile);
+
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+
+	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+
+	if (_startDispatcherThreads) {
+		rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+	}
+
+	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+	if (_createRootTables) {
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE(NULL != exampleVM->rootTable);
+
+		/* the root scanner expects an object table even when every object is reached from the root table */
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE(NULL != exampleVM->objectTable);
+	}
+}
+
+void
+GCHeapTest::TearDown()
+{
+	if (NULL != exampleVM->rootTable) {
+		hashTableFree(exampleVM->rootTable);
+		exampleVM->rootTable = NULL;
+	}
+	if (NULL != exampleVM->objectTable) {
+		hashTableFree(exampleVM->objectTable);
+		exampleVM->objectTable = NULL;
+	}
+
+	if (_startDispatcherThreads) {
+		omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+	}
+
+	omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+
+	ASSERT_EQ(OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM), OMR_ERROR_NONE);
+
+	exampleVM->_omrVMThread = NULL;
+	env = NULL;
+}
+
 void
 printMemUsed(const char *where, OMRPortLibrary *portLib)
 {
@@ -131,3 +194,30 @@ printMemUsed(const char *where, OMRPortLibrary *portLib)
 	/* memory info not supported */
 #endif /* defined(OMR_OS_WINDOWS) */
 }
+
+uintptr_t
+getResidentSetSize(OMRPortLibrary *portLib)
+{
+	uintptr_t residentBytes = 0;
+#if defined(OMR_OS_WINDOWS)
+	PROCESS_MEMORY_COUNTERS pmc;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+		residentBytes = pmc.WorkingSetSize;
+	}
+#elif defined(LINUX)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	intptr_t fileDescriptor = omrfile_open("/proc/self/statm", EsOpenRead, 0444);
+	if (-1 != fileDescriptor) {
+		char lineStr[2048];
+		unsigned long size = 0;
+		unsigned long resident = 0;
+		if ((NULL != omrfile_read_text(fileDescriptor, lineStr, sizeof(lineStr))) && (2 == sscanf(lineStr, "%lu %lu", &size, &resident))) {
+			residentBytes = resident * omrvmem_supported_page_sizes()[0];
+		}
+		omrfile_close(fileDescriptor);
+	}
+#else
+	/* memory info not supported */
+#endif /* defined(OMR_OS_WINDOWS) */
+	return residentBytes;
+}
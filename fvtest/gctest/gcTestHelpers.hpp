@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2016 IBM Corp. and others
+ * Copyright (c) 2015, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,6 +34,8 @@
 #include "testEnvironment.hpp"
 #include <vector>
 
+class MM_EnvironmentBase;
+
 class GCTestEnvironment: public BaseEnvironment
 {
 	/*
@@ -43,6 +45,7 @@ public:
 	OMR_VM_Example exampleVM;
 	std::vector<const char *> params;
 	bool keepLog;
+	const char *benchmarkResults; /**< File the GC benchmark appends its results to, NULL to log them */
 
 	/*
 	 * Function members
@@ -60,7 +63,7 @@ public:
 
 public:
 	GCTestEnvironment(int argc, char **argv)
-	: BaseEnvironment(argc, argv), keepLog(false)
+	: BaseEnvironment(argc, argv), keepLog(false), benchmarkResults(NULL)
 	{
 	}
 };
@@ -73,6 +76,51 @@ public:
  */
 void printMemUsed(const char *where, OMRPortLibrary *portLib);
 
+/**
+ * Query the physical memory currently consumed by the test process.
+ *
+ * @param[in] portLib The port library
+ * @return the resident set size in bytes, 0 if it is not supported on this platform
+ */
+uintptr_t getResidentSetSize(OMRPortLibrary *portLib);
+
 extern GCTestEnvironment *gcTestEnv;
 
+/**
+ * Fixture for tests that drive the GC directly: SetUp starts a heap and collector from a configuration file and
+ * attaches the test thread, TearDown shuts them down again. Fixtures overriding SetUp or TearDown must call these.
+ */
+class GCHeapTest : public ::testing::Test
+{
+	/*
+	 * Data members
+	 */
+private:
+	const char *_configFile;
+	bool _startDispatcherThreads; /**< Start the GC worker threads, which parallel collections need */
+	bool _createRootTables; /**< Create the root and object tables scanned by the example glue */
+
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	/*
+	 * Function members
+	 */
+protected:
+	virtual void SetUp();
+	virtual void TearDown();
+
+public:
+	GCHeapTest(const char *configFile, bool startDispatcherThreads = false, bool createRootTables = false)
+		: ::testing::Test()
+		, _configFile(configFile)
+		, _startDispatcherThreads(startDispatcherThreads)
+		, _createRootTables(createRootTables)
+		, exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+	{
+	}
+};
+
 #endif /* GCTESTHELPERS_HPP_INCLUDED */
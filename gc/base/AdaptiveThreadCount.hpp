@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ADAPTIVETHREADCOUNT_HPP_)
+#define ADAPTIVETHREADCOUNT_HPP_
+
+#include "omr.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+#include "Math.hpp"
+
+#define ADAPTIVE_THREAD_COUNT_GROW_EFFICIENCY ((float)0.9) /**< Efficiency at or above which one more thread is recommended */
+#define ADAPTIVE_THREAD_COUNT_SHRINK_EFFICIENCY ((float)0.6) /**< Efficiency below which the thread count is reduced */
+#define ADAPTIVE_THREAD_COUNT_TARGET_EFFICIENCY ((float)0.75) /**< Efficiency aimed for when reducing the thread count */
+#define ADAPTIVE_THREAD_COUNT_HISTORY_WEIGHT ((float)0.5) /**< Weight of the history when averaging per-run targets */
+
+/**
+ * Feedback model recommending how many GC threads a parallel task should use.
+ *
+ * After each run of the task the owning collector reports how long the task took and how much
+ * of that time its threads spent stalled (waiting for work, for completion or at sync points).
+ * The resulting parallel efficiency drives the recommendation for the next run: a task that keeps
+ * its threads busy is allowed one more thread, a task whose threads mostly stall is shrunk to the
+ * number of threads it actually kept busy.
+ * @ingroup GC_Base
+ */
+class MM_AdaptiveThreadCount : public MM_BaseNonVirtual
+{
+/* Data members / types */
+public:
+protected:
+private:
+	float _averageThreadCount; /**< Weighted average of the per-run thread count targets */
+	float _lastEfficiency; /**< Parallel efficiency (0.0 - 1.0) measured for the last run */
+	uintptr_t _recommendedThreadCount; /**< Thread count recommended for the next run (UDATA_MAX until first measurement) */
+
+/* Methods */
+public:
+	/**
+	 * Record the outcome of a run and recompute the recommended thread count.
+	 * @param activeThreadCount[in] Number of threads that participated in the run
+	 * @param maxThreadCount[in] Upper bound for the recommendation
+	 * @param elapsedTime[in] Wall time of the run, in hi-res ticks
+	 * @param stallTime[in] Stall time summed over all participating threads, in hi-res ticks
+	 */
+	void
+	update(uintptr_t activeThreadCount, uintptr_t maxThreadCount, uint64_t elapsedTime, uint64_t stallTime)
+	{
+		if ((0 == activeThreadCount) || (0 == elapsedTime)) {
+			return;
+		}
+
+		uint64_t totalTime = elapsedTime * activeThreadCount;
+		float efficiency = 0.0f;
+		if (stallTime < totalTime) {
+			efficiency = 1.0f - ((float)stallTime / (float)totalTime);
+		}
+		_lastEfficiency = efficiency;
+
+		float target = (float)activeThreadCount;
+		if (efficiency >= ADAPTIVE_THREAD_COUNT_GROW_EFFICIENCY) {
+			target += 1.0f;
+		} else if (efficiency < ADAPTIVE_THREAD_COUNT_SHRINK_EFFICIENCY) {
+			target = (efficiency * (float)activeThreadCount) / ADAPTIVE_THREAD_COUNT_TARGET_EFFICIENCY;
+		}
+
+		if (UDATA_MAX == _recommendedThreadCount) {
+			_averageThreadCount = target;
+		} else {
+			_averageThreadCount = MM_Math::weightedAverage(_averageThreadCount, target, ADAPTIVE_THREAD_COUNT_HISTORY_WEIGHT);
+		}
+
+		uintptr_t recommended = (uintptr_t)(_averageThreadCount + 0.5f);
+		_recommendedThreadCount = OMR_MAX(1, OMR_MIN(recommended, maxThreadCount));
+	}
+
+	/**
+	 * @return the number of threads recommended for the next run, or UDATA_MAX if there is no history yet
+	 */
+	MMINLINE uintptr_t getRecommendedThreadCount() { return _recommendedThreadCount; }
+
+	/**
+	 * @return the parallel efficiency (0.0 - 1.0) measured for the last run
+	 */
+	MMINLINE float getLastEfficiency() { return _lastEfficiency; }
+
+	/**
+	 * Create an AdaptiveThreadCount object.
+	 */
+	MM_AdaptiveThreadCount() :
+		MM_BaseNonVirtual(),
+		_averageThreadCount(0.0f),
+		_lastEfficiency(0.0f),
+		_recommendedThreadCount(UDATA_MAX)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ADAPTIVETHREADCOUNT_HPP_ */
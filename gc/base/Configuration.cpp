@@ -41,6 +41,7 @@
 #include "OMR_VMThread.hpp"
 #include "MemoryManager.hpp"
 #include "MemorySpace.hpp"
+#include "Math.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ReferenceChainWalkerMarkMap.hpp"
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
@@ -466,6 +467,16 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 	if (0 == extensions->cacheListSplit) {
 		extensions->cacheListSplit = (extensions->gcThreadCount - 1) / 8  +  1;
 	}
+
+	/* NUMA aware copying partitions the scan cache lists between nodes, so there must be at least one list per node */
+	if (extensions->scavengerNumaAwareCopy) {
+		uintptr_t nodeCount = extensions->_numaManager.getAffinityLeaderCount();
+		if (0 == nodeCount) {
+			extensions->scavengerNumaAwareCopy = false;
+		} else {
+			extensions->cacheListSplit = MM_Math::roundToCeiling(nodeCount, extensions->cacheListSplit);
+		}
+	}
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 	/* initialize default split freelist split amount */
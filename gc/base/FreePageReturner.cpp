@@ -0,0 +1,347 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "Math.hpp"
+#include "MemorySpace.hpp"
+
+#include "FreePageReturner.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#define FREE_PAGE_RETURNER_SEEN ((uint8_t)0x80) /**< Granule found free by the current pass */
+#define FREE_PAGE_RETURNER_AGE_MASK ((uint8_t)0x7F)
+
+typedef struct FreePageReturnerThreadInfo {
+	OMR_VM *omrVM;
+	uintptr_t threadFlags;
+	MM_FreePageReturner *returner;
+} FreePageReturnerThreadInfo;
+
+#define FREE_PAGE_RETURNER_INFO_FLAG_OK 1
+#define FREE_PAGE_RETURNER_INFO_FLAG_FAIL 2
+
+extern "C" {
+
+/**
+ * Free page returner thread procedure
+ *
+ * @parm info Address of FreePageReturnerThreadInfo structure
+ */
+static int J9THREAD_PROC
+free_page_returner_thread_proc(void *info)
+{
+	FreePageReturnerThreadInfo *threadInfo = (FreePageReturnerThreadInfo *)info;
+	MM_FreePageReturner *returner = threadInfo->returner;
+
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(threadInfo->omrVM, "Free Page Returner", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	/* Signal that the returner thread has started (or not) */
+	omrthread_monitor_enter(returner->_monitor);
+	threadInfo->threadFlags = (NULL != omrThread) ? FREE_PAGE_RETURNER_INFO_FLAG_OK : FREE_PAGE_RETURNER_INFO_FLAG_FAIL;
+	omrthread_monitor_notify_all(returner->_monitor);
+	omrthread_monitor_exit(returner->_monitor);
+
+	if (NULL != omrThread) {
+		returner->threadEntryPoint(omrThread);
+	}
+
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_FreePageReturner *
+MM_FreePageReturner::newInstance(MM_EnvironmentBase *env)
+{
+	MM_FreePageReturner *returner = (MM_FreePageReturner *)env->getForge()->allocate(sizeof(MM_FreePageReturner), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != returner) {
+		new(returner) MM_FreePageReturner(env);
+		if (!returner->initialize(env)) {
+			returner->kill(env);
+			returner = NULL;
+		}
+	}
+	return returner;
+}
+
+MM_FreePageReturner::MM_FreePageReturner(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _heapBase(0)
+	, _granuleSize(0)
+	, _granuleShift(0)
+	, _granuleCount(0)
+	, _ageMap(NULL)
+	, _threadsStarted(0)
+	, _threadsShutdownCount(0)
+	, _request(RETURNER_WAIT)
+	, _passCount(0)
+	, _releasedBytes(0)
+	, _monitor(NULL)
+{
+	_typeId = __FUNCTION__;
+}
+
+void
+MM_FreePageReturner::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_FreePageReturner::initialize(MM_EnvironmentBase *env)
+{
+	MM_Heap *heap = _extensions->heap;
+
+	/* the heap base is page aligned, so are the granule boundaries measured from it */
+	_granuleSize = OMR_MAX(heap->getPageSize(), FREE_PAGE_RETURNER_GRANULE_SIZE);
+	_granuleShift = MM_Math::floorLog2(_granuleSize);
+	_granuleSize = (uintptr_t)1 << _granuleShift;
+	_heapBase = (uintptr_t)heap->getHeapBase();
+	_granuleCount = MM_Math::roundToCeiling(_granuleSize, (uintptr_t)heap->getHeapTop() - _heapBase) >> _granuleShift;
+
+	_ageMap = (uint8_t *)env->getForge()->allocate(_granuleCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _ageMap) {
+		return false;
+	}
+	memset(_ageMap, 0, _granuleCount);
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_FreePageReturner::monitor")) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_FreePageReturner::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _ageMap) {
+		env->getForge()->free(_ageMap);
+		_ageMap = NULL;
+	}
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_FreePageReturner::startupThread(MM_GCExtensionsBase *extensions)
+{
+	FreePageReturnerThreadInfo threadInfo;
+	threadInfo.omrVM = extensions->getOmrVM();
+	threadInfo.threadFlags = 0;
+	threadInfo.returner = this;
+
+	omrthread_monitor_enter(_monitor);
+	_request = RETURNER_WAIT;
+	omrthread_t thread = NULL;
+	if (0 == createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN, 0,
+			free_page_returner_thread_proc, (void *)&threadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+		do {
+			omrthread_monitor_wait(_monitor);
+		} while (0 == threadInfo.threadFlags);
+
+		if (FREE_PAGE_RETURNER_INFO_FLAG_OK == threadInfo.threadFlags) {
+			_threadsStarted = 1;
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return (1 == _threadsStarted);
+}
+
+void
+MM_FreePageReturner::shutdownThread(MM_GCExtensionsBase *extensions)
+{
+	omrthread_monitor_enter(_monitor);
+	_request = RETURNER_SHUTDOWN;
+	omrthread_monitor_notify_all(_monitor);
+	while (_threadsShutdownCount < _threadsStarted) {
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_FreePageReturner::threadEntryPoint(OMR_VMThread *omrThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	ReturnerRequest request = RETURNER_WAIT;
+
+	while (RETURNER_SHUTDOWN != request) {
+		omrthread_monitor_enter(_monitor);
+		while (RETURNER_WAIT == (request = _request)) {
+			omrthread_monitor_wait(_monitor);
+		}
+		if (RETURNER_RUN == request) {
+			_request = RETURNER_WAIT;
+		}
+		omrthread_monitor_exit(_monitor);
+
+		if (RETURNER_RUN == request) {
+			/* A collection waits for VM access to be released, so the free lists can not be rebuilt during the pass */
+			env->acquireVMAccess();
+			runPass(env);
+			env->releaseVMAccess();
+		}
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	omrthread_monitor_enter(_monitor);
+	_threadsShutdownCount += 1;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_FreePageReturner::globalCollectionEnd(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (RETURNER_SHUTDOWN != _request) {
+		_request = RETURNER_RUN;
+		omrthread_monitor_notify_all(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+uintptr_t
+MM_FreePageReturner::runPass(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_Heap *heap = _extensions->heap;
+
+	uint64_t startTime = omrtime_hires_clock();
+	uintptr_t releasedBytes = heap->getDefaultMemorySpace()->releaseFreeMemoryPages(env, this);
+	resetUnseenGranules();
+	uint64_t endTime = omrtime_hires_clock();
+
+	if (0 < releasedBytes) {
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			endTime,
+			J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+			HEAP_RELEASE_FREE_PAGES,
+			MEMORY_TYPE_OLD,
+			/* GC Time Ratio not applicable for "release free heap pages" */
+			0,
+			releasedBytes,
+			heap->getActiveMemorySize(),
+			omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			RELEASE_FREE_PAGES_IDLE_FREE_ENTRIES
+			);
+	}
+
+	omrthread_monitor_enter(_monitor);
+	_releasedBytes += releasedBytes;
+	_passCount += 1;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+
+	return releasedBytes;
+}
+
+uintptr_t
+MM_FreePageReturner::releaseIdleFreeEntryPages(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry)
+{
+	uintptr_t releasedBytes = 0;
+
+	if (freeEntry->getSize() >= _extensions->freePageReturnerMinimumSize) {
+		uintptr_t idleCycles = _extensions->freePageReturnerIdleCycles;
+		/* the header of the entry stays committed, it is still linked in the free list */
+		uintptr_t lowAddress = _heapBase + MM_Math::roundToCeiling(_granuleSize, ((uintptr_t)freeEntry + sizeof(MM_HeapLinkedFreeHeader)) - _heapBase);
+		uintptr_t highAddress = _heapBase + MM_Math::roundToFloor(_granuleSize, (uintptr_t)freeEntry->afterEnd() - _heapBase);
+		uintptr_t runBase = 0;
+		uintptr_t runNewBytes = 0;
+
+		for (uintptr_t address = lowAddress; address < highAddress; address += _granuleSize) {
+			uint8_t *age = &_ageMap[(address - _heapBase) >> _granuleShift];
+			/* the age saturates one past the threshold, so each idle period is counted once */
+			uintptr_t count = OMR_MIN((uintptr_t)(*age & FREE_PAGE_RETURNER_AGE_MASK) + 1, idleCycles + 1);
+			*age = (uint8_t)count | FREE_PAGE_RETURNER_SEEN;
+
+			if (count >= idleCycles) {
+				if (0 == runBase) {
+					runBase = address;
+				}
+				if (count == idleCycles) {
+					runNewBytes += _granuleSize;
+				}
+			} else if (0 != runBase) {
+				if (_extensions->heap->decommitMemory((void *)runBase, address - runBase, NULL, freeEntry->afterEnd())) {
+					releasedBytes += runNewBytes;
+				}
+				runBase = 0;
+				runNewBytes = 0;
+			}
+		}
+
+		if (0 != runBase) {
+			if (_extensions->heap->decommitMemory((void *)runBase, highAddress - runBase, NULL, freeEntry->afterEnd())) {
+				releasedBytes += runNewBytes;
+			}
+		}
+	}
+
+	return releasedBytes;
+}
+
+/**
+ * Granules not found free by the pass just completed start over.
+ */
+void
+MM_FreePageReturner::resetUnseenGranules()
+{
+	for (uintptr_t i = 0; i < _granuleCount; i++) {
+		uint8_t age = _ageMap[i];
+		_ageMap[i] = (0 != (age & FREE_PAGE_RETURNER_SEEN)) ? (uint8_t)(age & FREE_PAGE_RETURNER_AGE_MASK) : 0;
+	}
+}
+
+bool
+MM_FreePageReturner::waitForPasses(uintptr_t passCount, int64_t timeoutMillis)
+{
+	intptr_t waitResult = 0;
+
+	omrthread_monitor_enter(_monitor);
+	while ((0 == waitResult) && (_passCount < passCount)) {
+		waitResult = omrthread_monitor_wait_timed(_monitor, timeoutMillis, 0);
+	}
+	bool result = (_passCount >= passCount);
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(FREEPAGERETURNER_HPP_)
+#define FREEPAGERETURNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#define FREE_PAGE_RETURNER_GRANULE_SIZE (64 * 1024) /**< Smallest unit of heap the returner tracks and decommits, rounded up to the heap page size */
+#define FREE_PAGE_RETURNER_MAXIMUM_IDLE_CYCLES 126 /**< Upper bound of -Xgc:freePageReturnerIdleCycles=, ages are kept in seven bits and saturate one past the threshold */
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_HeapLinkedFreeHeader;
+
+/**
+ * Background free page returner. After every global collection a low priority thread walks the
+ * free lists of the old space and ages each granule of heap found inside a large free entry. The
+ * pages of granules which were free at the end of -Xgc:freePageReturnerIdleCycles= consecutive
+ * global collections are decommitted. The free entries stay in their free lists and the OS maps
+ * the pages back in when an allocation next touches them, so the allocation paths are unchanged.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreePageReturner : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	typedef enum {
+		RETURNER_WAIT = 0, /**< no global collection since the last pass */
+		RETURNER_RUN, /**< a global collection completed, the free lists have to be aged */
+		RETURNER_SHUTDOWN /**< the returner thread must exit */
+	} ReturnerRequest;
+
+	MM_GCExtensionsBase *_extensions;
+	uintptr_t _heapBase; /**< Lowest address of the reserved heap, the age map covers the whole reservation */
+	uintptr_t _granuleSize; /**< Power of two, at least one heap page */
+	uintptr_t _granuleShift;
+	uintptr_t _granuleCount;
+	uint8_t *_ageMap; /**< Per granule count of consecutive passes it was found free, with FREE_PAGE_RETURNER_SEEN set by the current pass */
+	uintptr_t _threadsStarted;
+	uintptr_t _threadsShutdownCount;
+	volatile ReturnerRequest _request;
+	uintptr_t _passCount; /**< Number of completed passes */
+	uint64_t _releasedBytes; /**< Total bytes decommitted by the returner since startup */
+protected:
+public:
+	omrthread_monitor_t _monitor; /**< Protects the request and the statistics and wakes the returner thread */
+
+	/*
+	 * Function members
+	 */
+private:
+	void resetUnseenGranules();
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_FreePageReturner(MM_EnvironmentBase *env);
+public:
+	static MM_FreePageReturner *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Attach the returner thread, at minimum priority so it only uses the spare cycles left by the mutators.
+	 * @return true if the thread was started
+	 */
+	bool startupThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Ask the returner thread to terminate and wait for it to do so.
+	 */
+	void shutdownThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Main loop of the returner thread: wait for a global collection to complete, then run a pass.
+	 */
+	void threadEntryPoint(OMR_VMThread *omrThread);
+
+	/**
+	 * Wake the returner thread to run a pass. Called by the global collector before it releases
+	 * exclusive access, the pass starts once the returner thread gets VM access back.
+	 */
+	void globalCollectionEnd(MM_EnvironmentBase *env);
+
+	/**
+	 * Age the free lists of the old space and decommit the granules idle for long enough. The caller
+	 * must hold VM access so no collection rebuilds the free lists during the pass.
+	 * @return bytes decommitted for the first time since their granules became free
+	 */
+	uintptr_t runPass(MM_EnvironmentBase *env);
+
+	/**
+	 * Age the granules entirely contained in a free entry and decommit those which reached the idle
+	 * threshold. Granules decommitted by an earlier pass are advised again, since an allocation may
+	 * have brought their pages back in, but are not counted again.
+	 * @note the caller must hold the lock of the memory pool owning the entry
+	 * @return bytes of the entry decommitted for the first time
+	 */
+	uintptr_t releaseIdleFreeEntryPages(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry);
+
+	/**
+	 * Wait for a pass to complete.
+	 * @param passCount number of completed passes to wait for
+	 * @param timeoutMillis how long to wait before giving up
+	 * @return true if at least passCount passes have completed
+	 */
+	bool waitForPasses(uintptr_t passCount, int64_t timeoutMillis);
+
+	MMINLINE uintptr_t getPassCount() { return _passCount; }
+	MMINLINE uint64_t getReleasedBytes() { return _releasedBytes; }
+	MMINLINE uintptr_t getGranuleSize() { return _granuleSize; }
+};
+
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
+
+#endif /* FREEPAGERETURNER_HPP_ */
@@ -195,6 +195,7 @@ private:
 	void* _guaranteedNurseryEnd; /**< highest address guaranteed to be in the nursery */
 
 	bool _isRememberedSetInOverflow;
+	bool _isRememberedSetInCardState; /**< set if remembered objects have been recorded in the remembered set cards instead of the list */
 
 	volatile BackOutState _backOutState; /**< set if a thread is unable to copy an object due to lack of free space in both Survivor and Tenure */
 	volatile bool _concurrentGlobalGCInProgress; /**< set to true if concurrent Global GC is in progress */
@@ -266,6 +267,16 @@ public:
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
 
+	enum HeapHugePages {
+		HEAP_HUGE_PAGES_NONE = 0,
+		HEAP_HUGE_PAGES_NURSERY = 1,
+		HEAP_HUGE_PAGES_TENURE = 2,
+		HEAP_HUGE_PAGES_ALL = (HEAP_HUGE_PAGES_NURSERY | HEAP_HUGE_PAGES_TENURE),
+	};
+
+	uintptr_t heapHugePages; /**< HeapHugePages mask of the heap areas to back with the largest suitable huge page size when the default page size was requested (set through -Xgc:hugePages[=nursery|tenure]) */
+	bool heapNumaInterleave; /**< if true, the heap reservation is interleaved across NUMA nodes (set through -Xgc:numaInterleave) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
 	uintptr_t oldHeapSizeOnLastGlobalGC;
@@ -328,6 +339,7 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhSizeClassCache; /**< if true, allocates that miss the TLH are served from per thread size class caches refilled in batches from the memory pool */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -383,6 +395,7 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workPacketStealing; /**< if true, stop-the-world marking keeps full output packets in per-thread work-stealing deques instead of the shared packet lists */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -399,6 +412,7 @@ public:
 	bool fvtest_forceScavengerBackout;
 	uintptr_t fvtest_backoutCounter;
 	bool fvtest_forcePoisonEvacuate; /**< if true poison Evacuate space with pattern at the end of scavenge */
+	bool fvtest_forceRememberedSetCards; /**< if true the scavenger fails remembered set fragment refills on every other scavenge, forcing the use of the remembered set cards */
 	bool fvtest_forceNurseryResize;
 	uintptr_t fvtest_nurseryResizeCounter;
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -440,6 +454,7 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreading; /**< if true, the number of threads for parallel scavenge and mark tasks is chosen from the parallel efficiency measured in previous cycles */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
@@ -477,6 +492,10 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerNumaAwareCopy; /**< if true, scavenger threads copy into survivor/tenure memory partitioned to their NUMA node and prefer scanning caches produced on that node */
+	bool scavengerRememberedSetCards; /**< if true, objects which cannot be added to the remembered set list are recorded in remembered set cards rather than overflowing the remembered set */
+	bool scavengerHierarchicalCopy; /**< if true (and scan ordering is hierarchical), the children of a copied object are copied right after it, within its block of cache lines, before scanning moves on */
+	uintptr_t scavengerHierarchicalCopyDepth; /**< number of levels of children copied ahead of the scan by hierarchical copying */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -487,6 +506,7 @@ public:
 	uintptr_t concurrentScavengerSlack; /**< amount of bytes added on top of avearge allocated bytes during concurrent cycle, in calcualtion for survivor size */
 	float concurrentScavengerAllocDeviationBoost; /**< boost factor for allocate rate and its deviation, used for tilt calcuation in Concurrent Scavenger */
 	bool concurrentScavengeExhaustiveTermination; /**< control flag to enable/disable concurrent phase termination optimization using involing async mutator callbacks */
+	uintptr_t concurrentScavengerSlowdownTarget; /**< mutator slowdown (percent) from the read barrier slow path the concurrent phase is tuned to stay under, 0 to disable tuning */
 #endif	/* OMR_GC_CONCURRENT_SCAVENGER */
 	uintptr_t scavengerFailedTenureThreshold;
 	uintptr_t maxScavengeBeforeGlobal;
@@ -514,6 +534,7 @@ public:
 	double dnssMaximumContraction;
 	double dnssMinimumExpansion;
 	double dnssMinimumContraction;
+	uintptr_t scavengerPauseTarget; /**< target scavenge pause in milliseconds, sizing the nursery and adjusting the tenure age from measured copy rates; 0 (default) leaves new space sizing to the dnss time ratios */
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 	double aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited (set through aliasInhibitingThresholdPercentage=) */
 
@@ -550,6 +571,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool incrementalCompaction; /**< if true, compactions triggered by fragmentation evacuate only the most fragmented sub areas, spreading the work over several global collections */
+	uintptr_t incrementalCompactionBudget; /**< Heap bytes a single compaction increment may evacuate, 0 for a quarter of the active heap */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -564,8 +587,10 @@ public:
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
+	bool concurrentMarkPacer; /**< if true, the concurrent kickoff point and allocation tax are paced from the allocation and tracing rates measured in previous cycles */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool cardCleaningSummary; /**< if true, final card cleaning distributes work from a summary of the chunks of the card table which hold dirty cards (off by default, enabled by -Xgc:cardCleaningSummary) */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -668,6 +693,9 @@ public:
 	uintptr_t allocationCacheMaximumSize;
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
+	bool segregatedAllocationMagazines; /**< if true, segregated allocation caches are replenished from per-thread magazines of cell runs backed by per NUMA node depots */
+	bool segregatedLazySweep; /**< if true, small regions are left unswept after mark and are swept on allocation demand or by background threads */
+	uintptr_t segregatedLazySweepThreads; /**< Number of background threads sweeping the small regions left unswept by a lazy sweep */
 	bool nonDeterministicSweep;
 /* OMR_GC_REALTIME (in for all) */
 
@@ -680,6 +708,8 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool verboseBinaryLogging; /**< Enabled by -Xgc:verboseBinaryLogging.  Record verbose:gc output to file as binary events, written out by a background thread */
+	uintptr_t verboseBinaryBufferSize; /**< Size of the buffer holding binary verbose:gc events until they are written out, set by -Xgc:verboseBinaryBufferSize= */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -823,6 +853,9 @@ public:
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
 	bool compactOnIdle; /**< Forces compaction if global GC executed while VM Runtime State set to IDLE, default is false */
 	float gcOnIdleCompactThreshold; /**< Enables compaction when fragmented memory and dark matter exceed this limit. The larger this number, the more memory can be fragmented before compact is triggered **/
+	bool freePageReturner; /**< Enables the background thread decommitting the pages of old space free entries idle for freePageReturnerIdleCycles global GCs, default is false */
+	uintptr_t freePageReturnerMinimumSize; /**< Free entries smaller than this are ignored by the free page returner */
+	uintptr_t freePageReturnerIdleCycles; /**< Number of consecutive global GCs a page must end free before the free page returner decommits it */
 #endif
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -1084,6 +1117,21 @@ public:
 	MMINLINE bool isRememberedSetInOverflowState() { return _isRememberedSetInOverflow; }
 	MMINLINE void setRememberedSetOverflowState() { _isRememberedSetInOverflow = true; }
 	MMINLINE void clearRememberedSetOverflowState() { _isRememberedSetInOverflow = false; }
+
+	MMINLINE bool isRememberedSetInCardState() { return _isRememberedSetInCardState; }
+	MMINLINE void setRememberedSetCardState() { _isRememberedSetInCardState = true; }
+	MMINLINE void clearRememberedSetCardState() { _isRememberedSetInCardState = false; }
+
+	/**
+	 * @return true if the remembered set list does not enumerate every remembered object
+	 */
+	MMINLINE bool isRememberedSetInOverflowOrCardState() { return _isRememberedSetInOverflow || _isRememberedSetInCardState; }
+
+	/**
+	 * The pause target drives new space sizing only for stop-the-world scavenges, since the
+	 * duration of a Concurrent Scavenger cycle says little about the pauses it imposes.
+	 */
+	MMINLINE bool isScavengerPauseTargetEnabled() { return (0 != scavengerPauseTarget) && !isConcurrentScavengerEnabled(); }
 	
 	MMINLINE void setScavengerBackOutState(BackOutState backOutState) { _backOutState = backOutState; }
 	MMINLINE BackOutState getScavengerBackOutState() { return _backOutState; }
@@ -1336,6 +1384,7 @@ public:
 		, _guaranteedNurseryStart(NULL)
 		, _guaranteedNurseryEnd(NULL)
 		, _isRememberedSetInOverflow(false)
+		, _isRememberedSetInCardState(false)
 		, _backOutState(backOutFlagCleared)
 		, _concurrentGlobalGCInProgress(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1390,6 +1439,8 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapHugePages(HEAP_HUGE_PAGES_NONE)
+		, heapNumaInterleave(false)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1437,6 +1488,7 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhSizeClassCache(false)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1478,6 +1530,7 @@ public:
 		, useGCStartupHints(true)	
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workPacketStealing(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1490,6 +1543,7 @@ public:
 		, fvtest_forceScavengerBackout(0)
 		, fvtest_backoutCounter(0)
 		, fvtest_forcePoisonEvacuate(0)
+		, fvtest_forceRememberedSetCards(false)
 		, fvtest_forceNurseryResize(0)
 		, fvtest_nurseryResizeCounter(0)
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -1524,6 +1578,7 @@ public:
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
+		, adaptiveGCThreading(false)
 		, dispatcherHybridNotifyThreadBound(16)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
@@ -1556,6 +1611,10 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerNumaAwareCopy(false)
+		, scavengerRememberedSetCards(false)
+		, scavengerHierarchicalCopy(false)
+		, scavengerHierarchicalCopyDepth(3)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1566,6 +1625,7 @@ public:
 		, concurrentScavengerSlack(0)
 		, concurrentScavengerAllocDeviationBoost(2.0)
 		, concurrentScavengeExhaustiveTermination(true)
+		, concurrentScavengerSlowdownTarget(0)
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 		, scavengerFailedTenureThreshold(0)
 		, maxScavengeBeforeGlobal(0)
@@ -1593,6 +1653,7 @@ public:
 		, dnssMaximumContraction(0.5)
 		, dnssMinimumExpansion(0.0)
 		, dnssMinimumContraction(0.0)
+		, scavengerPauseTarget(0)
 		, enableSplitHeap(false)
 		, aliasInhibitingThresholdPercentage(0.20)
 		, splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
@@ -1617,6 +1678,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, incrementalCompaction(false)
+		, incrementalCompactionBudget(0)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1629,8 +1692,10 @@ public:
 		, concurrentLevel(8)
 		, concurrentBackground(1)
 		, concurrentSlack(0)
+		, concurrentMarkPacer(false)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, cardCleaningSummary(false)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1708,6 +1773,9 @@ public:
 		, allocationCacheMaximumSize(16384)
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
+		, segregatedAllocationMagazines(false)
+		, segregatedLazySweep(false)
+		, segregatedLazySweepThreads(1)
 		, nonDeterministicSweep(false)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
@@ -1715,6 +1783,8 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, verboseBinaryLogging(false)
+		, verboseBinaryBufferSize(1024 * 1024)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1818,6 +1888,9 @@ public:
 		, gcOnIdle(false)
 		, compactOnIdle(false)
 		, gcOnIdleCompactThreshold((float)0.10)
+		, freePageReturner(false)
+		, freePageReturnerMinimumSize(1024 * 1024)
+		, freePageReturnerIdleCycles(3)
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_VALGRIND_MEMCHECK)
 		, valgrindMempoolAddr(0)
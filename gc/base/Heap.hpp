@@ -112,6 +112,18 @@ public:
 	 * Return the page flags describing the pages used for the heap memory.
 	 */
 	virtual uintptr_t getPageFlags() = 0;
+
+	/**
+	 * Return true if the heap memory is backed by default pages advised for transparent huge pages.
+	 * This should only be used for reporting purposes (e.g. In MM_HeapSplit, true is returned only
+	 * if both extents are advised)
+	 */
+	virtual bool isTransparentHugePages() = 0;
+
+	/**
+	 * Return true if the heap memory is interleaved across NUMA nodes.
+	 */
+	virtual bool isNumaInterleaved() = 0;
 	
 	virtual void *getHeapBase() = 0;
 	virtual void *getHeapTop() = 0;
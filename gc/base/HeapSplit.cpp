@@ -183,6 +183,18 @@ MM_HeapSplit::getPageFlags()
 	return (_lowExtent->getPageSize() < _highExtent->getPageSize()) ? _lowExtent->getPageFlags() : _highExtent->getPageFlags();
 }
 
+bool
+MM_HeapSplit::isTransparentHugePages()
+{
+	return _lowExtent->isTransparentHugePages() && _highExtent->isTransparentHugePages();
+}
+
+bool
+MM_HeapSplit::isNumaInterleaved()
+{
+	return _lowExtent->isNumaInterleaved() && _highExtent->isNumaInterleaved();
+}
+
 #if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS)
 void*
 MM_HeapSplit::doubleMapArraylet(MM_EnvironmentBase *env, void* arrayletLeaves[], UDATA arrayletLeafCount, UDATA arrayletLeafSize, UDATA byteAmount, struct J9PortVmemIdentifier *newIdentifier, UDATA pageSize)
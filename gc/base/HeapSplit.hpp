@@ -59,6 +59,8 @@ public:
 	
 	virtual uintptr_t getPageSize();
 	virtual uintptr_t getPageFlags();
+	virtual bool isTransparentHugePages();
+	virtual bool isNumaInterleaved();
 	virtual void *getHeapBase();
 	virtual void *getHeapTop();
 #if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS)
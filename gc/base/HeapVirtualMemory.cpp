@@ -204,6 +204,20 @@ MM_HeapVirtualMemory::getPageFlags()
 	return memoryManager->getPageFlags(&_vmemHandle);
 }
 
+bool
+MM_HeapVirtualMemory::isTransparentHugePages()
+{
+	MM_MemoryManager* memoryManager = MM_GCExtensionsBase::getExtensions(_omrVM)->memoryManager;
+	return memoryManager->isTransparentHugePages(&_vmemHandle);
+}
+
+bool
+MM_HeapVirtualMemory::isNumaInterleaved()
+{
+	MM_MemoryManager* memoryManager = MM_GCExtensionsBase::getExtensions(_omrVM)->memoryManager;
+	return memoryManager->isNumaInterleaved(&_vmemHandle);
+}
+
 /**
  * Answer the largest size the heap will ever consume.
  * The value returned represents the difference between the lowest and highest possible address range
@@ -96,6 +96,13 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	/* Work stealing relies on all marking being done by the threads of a stop-the-world task */
+	if (_extensions->workPacketStealing && !_extensions->isConcurrentMarkEnabled()) {
+		if (!_workPackets->initializePacketDeques(env)) {
+			goto error_no_memory;
+		}
+	}
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -29,6 +29,7 @@
 
 #include "BaseVirtual.hpp"
 
+#include "AdaptiveThreadCount.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "MarkingDelegate.hpp"
@@ -56,6 +57,7 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	MM_AdaptiveThreadCount _adaptiveThreadCount; /**< Thread count recommendation for the mark task, fed by the parallel efficiency of previous marks */
 
 public:
 
@@ -266,6 +268,7 @@ public:
 	
 	bool isMarkedOutline(omrobjectptr_t objectPtr);
 	MM_WorkPackets *getWorkPackets() { return _workPackets; }
+	MM_AdaptiveThreadCount *getAdaptiveThreadCount() { return &_adaptiveThreadCount; }
 	
 	bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
 	bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
@@ -309,6 +312,7 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _adaptiveThreadCount()
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -30,6 +30,9 @@
 #include "MemcheckWrapper.hpp"
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
+/* Smallest number of huge pages a heap area must span to be backed by them */
+#define HEAP_HUGE_PAGES_MINIMUM_COUNT 8
+
 MM_MemoryManager*
 MM_MemoryManager::newInstance(MM_EnvironmentBase* env)
 {
@@ -58,6 +61,38 @@ MM_MemoryManager::initialize(MM_EnvironmentBase* env)
 	return true;
 }
 
+void
+MM_MemoryManager::selectHeapHugePageSize(MM_EnvironmentBase* env, uintptr_t size, uintptr_t* pageSize, uintptr_t* pageFlags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	/* a contiguous heap holds both the nursery and tenure areas in one reservation */
+	uintptr_t areas = MM_GCExtensionsBase::HEAP_HUGE_PAGES_ALL;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (extensions->enableSplitHeap) {
+		if (MM_GCExtensionsBase::HEAP_INITIALIZATION_SPLIT_HEAP_NURSERY == extensions->splitHeapSection) {
+			areas = MM_GCExtensionsBase::HEAP_HUGE_PAGES_NURSERY;
+		} else {
+			areas = MM_GCExtensionsBase::HEAP_HUGE_PAGES_TENURE;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+	/* an explicitly requested large page size takes precedence over the policy */
+	if (OMR_ARE_ANY_BITS_SET(extensions->heapHugePages, areas) && !isLargePage(env, *pageSize)) {
+		uintptr_t* pageSizes = omrvmem_supported_page_sizes();
+		uintptr_t* supportedPageFlags = omrvmem_supported_page_flags();
+
+		for (uintptr_t i = 1; 0 != pageSizes[i]; i++) {
+			if ((pageSizes[i] > *pageSize) && ((size / pageSizes[i]) >= HEAP_HUGE_PAGES_MINIMUM_COUNT)) {
+				*pageSize = pageSizes[i];
+				*pageFlags = supportedPageFlags[i];
+			}
+		}
+	}
+}
+
 bool
 MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size, uintptr_t tailPadding, void* preferredAddress, void* ceiling)
 {
@@ -73,6 +108,10 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	if (MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE != extensions->heapHugePages) {
+		selectHeapHugePageSize(env, size, &pageSize, &pageFlags);
+	}
+
 	uintptr_t allocateSize = size;
 
 	uintptr_t concurrentScavengerPageSize = 0;
@@ -94,6 +94,20 @@ private:
 		return result;
 	}
 
+	/**
+	 * Apply the heap huge page policy to the heap area about to be reserved.
+	 * If the area is selected by -Xgc:hugePages and the default page size was requested
+	 * the largest supported page size that the area spans at least HEAP_HUGE_PAGES_MINIMUM_COUNT times is chosen.
+	 * The port library falls back to default pages (advised for transparent huge pages where supported)
+	 * if the explicit huge pages can not be reserved.
+	 *
+	 * @param env environment
+	 * @param size required memory size
+	 * @param[in/out] pageSize page size to be requested
+	 * @param[in/out] pageFlags page flags to be requested
+	 */
+	void selectHeapHugePageSize(MM_EnvironmentBase* env, uintptr_t size, uintptr_t* pageSize, uintptr_t* pageFlags);
+
 protected:
 	/**
 	 * Provide an initialization for the class
@@ -308,6 +322,30 @@ public:
 		return memory->getPageFlags();
 	};
 
+	/**
+	 * Return true if the virtual memory object is backed by default pages advised for transparent huge pages
+	 *
+	 * @param handle pointer to memory handle
+	 * @return true if the kernel may promote the default pages of this virtual memory instance to huge pages
+	 */
+	MMINLINE bool isTransparentHugePages(MM_MemoryHandle* handle)
+	{
+		MM_VirtualMemory* memory = handle->getVirtualMemory();
+		return memory->isTransparentHugePages();
+	};
+
+	/**
+	 * Return true if the virtual memory object is interleaved across NUMA nodes
+	 *
+	 * @param handle pointer to memory handle
+	 * @return true if the pages of this virtual memory instance are interleaved across NUMA nodes
+	 */
+	MMINLINE bool isNumaInterleaved(MM_MemoryHandle* handle)
+	{
+		MM_VirtualMemory* memory = handle->getVirtualMemory();
+		return memory->isNumaInterleaved();
+	};
+
 	/**
 	 * Return the maximum size of the heap.
 	 *
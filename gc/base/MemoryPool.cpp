@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -157,6 +157,18 @@ MM_MemoryPool::unregisterMemoryPool(MM_MemoryPool *memoryPool)
 		Assert_MM_unreachable();
 		return NULL;
 	}
+
+	void *
+	MM_MemoryPool::allocateSizeClassBatch(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t minimumSizeInBytesRequired, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+	{
+		/* Without a sized search the pool hands out whatever TLH it has, which may be too small to be of use */
+		void *result = allocateTLH(env, allocDescription, maximumSizeInBytesRequired, addrBase, addrTop);
+		if ((NULL != result) && (((uintptr_t)addrTop - (uintptr_t)addrBase) < minimumSizeInBytesRequired)) {
+			abandonTlhHeapChunk(addrBase, addrTop);
+			result = NULL;
+		}
+		return result;
+	}
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
 /**
@@ -513,7 +525,7 @@ MM_MemoryPool::kill(MM_EnvironmentBase *env)
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
-MM_MemoryPool::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPool::releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner)
 {
         /* Should have been implemented */
         Assert_MM_unreachable();
@@ -35,6 +35,7 @@
 #include "HeapStats.hpp"
 #include "MemorySubSpace.hpp"
 
+class MM_FreePageReturner;
 class MM_HeapLinkedFreeHeader;
 class MM_AllocateDescription;
 class MM_HeapRegionDescriptor;
@@ -243,6 +244,12 @@ public:
 	virtual void *collectorAllocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool lockingRequired);
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	virtual void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
+	/**
+	 * Allocate a region to refill a thread local size class cache.
+	 * Like allocateTLH(), except that the region is guaranteed to hold at least minimumSizeInBytesRequired bytes.
+	 * @return base of the region, or NULL if the pool could not provide one
+	 */
+	virtual void *allocateSizeClassBatch(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t minimumSizeInBytesRequired, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
 	virtual void *collectorAllocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired);
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
@@ -348,9 +355,10 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	/**
+	 * @param returner NULL to release every free page, otherwise only the pages the free page returner finds idle for long enough
 	 * @return bytes of free memory in the pool released/decommited back to OS
 	 */
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner);
 #endif
 	/**
 	 * Create a MemoryPool object.
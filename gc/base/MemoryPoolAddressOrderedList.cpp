@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -689,6 +689,146 @@ MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_Allocat
 	return tlhBase;
 }
 
+/**
+ * Carve a size class cache refill out of the first free entry that can hold minimumSizeInBytesRequired bytes.
+ * The entry is searched for like an object allocate (first fit, using the allocate hints), but is consumed like
+ * a TLH: up to maximumSizeInBytesRequired bytes, handing out a remainder too small to be kept on the free list.
+ */
+bool
+MM_MemoryPoolAddressOrderedList::internalAllocateSizeClassBatch(MM_EnvironmentBase *env, uintptr_t minimumSizeInBytesRequired, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	bool const compressed = compressObjectReferences();
+	MM_HeapLinkedFreeHeader *currentFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	J9ModronAllocateHint *allocateHintUsed = NULL;
+	uintptr_t candidateHintSize = 0;
+	uintptr_t walkCount = 0;
+	uintptr_t largestFreeEntry = 0;
+	uintptr_t freeEntrySize = 0;
+	uintptr_t consumedSize = 0;
+	uintptr_t recycleEntrySize = 0;
+
+	_heapLock.acquire();
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+retry:
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+	currentFreeEntry = _heapFreeList;
+	previousFreeEntry = NULL;
+	walkCount = 0;
+	candidateHintSize = 0;
+
+	allocateHintUsed = findHint(minimumSizeInBytesRequired);
+	if (NULL != allocateHintUsed) {
+		currentFreeEntry = allocateHintUsed->heapFreeHeader;
+		candidateHintSize = allocateHintUsed->size;
+	}
+
+	while (NULL != currentFreeEntry) {
+		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+		if (currentFreeEntrySize > largestFreeEntry) {
+			largestFreeEntry = currentFreeEntrySize;
+		}
+
+		if (minimumSizeInBytesRequired <= currentFreeEntrySize) {
+			break;
+		}
+
+		if (candidateHintSize < currentFreeEntrySize) {
+			candidateHintSize = currentFreeEntrySize;
+		}
+
+		walkCount += 1;
+
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext(compressed);
+		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
+	}
+
+	if (NULL == currentFreeEntry) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (_memorySubSpace->replenishPoolForAllocate(env, this, minimumSizeInBytesRequired)) {
+			goto retry;
+		}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+		setLargestFreeEntry(largestFreeEntry);
+		_heapLock.release();
+		return false;
+	}
+
+	freeEntrySize = currentFreeEntry->getSize();
+	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeEntrySize);
+	if ((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && (NULL != allocateHintUsed))) {
+		addHint(previousFreeEntry, candidateHintSize);
+	}
+
+	/* If the leftover chunk is smaller than the minimum size, hand it out */
+	consumedSize = OMR_MIN(maximumSizeInBytesRequired, freeEntrySize);
+	recycleEntrySize = freeEntrySize - consumedSize;
+	if ((0 != recycleEntrySize) && (recycleEntrySize < _minimumFreeEntrySize)) {
+		consumedSize += recycleEntrySize;
+		recycleEntrySize = 0;
+	}
+
+	_freeMemorySize -= consumedSize;
+	_allocCount += 1;
+	_allocBytes += consumedSize;
+	_allocSearchCount += walkCount;
+	_largeObjectAllocateStats->incrementTlhAllocSizeClassStats(consumedSize);
+
+	addrBase = (void *)currentFreeEntry;
+	addrTop = (void *)(((uint8_t *)addrBase) + consumedSize);
+
+	if (0 != recycleEntrySize) {
+		MM_HeapLinkedFreeHeader *recycleEntry = (MM_HeapLinkedFreeHeader *)addrTop;
+		if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext(compressed))) {
+			updateHint(currentFreeEntry, recycleEntry);
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+		} else {
+			_freeMemorySize -= recycleEntrySize;
+			_freeEntryCount -= 1;
+			_allocDiscardedBytes += recycleEntrySize;
+			removeHint(currentFreeEntry);
+		}
+	} else {
+		/* The whole entry is consumed - unlink it */
+		if (NULL != previousFreeEntry) {
+			previousFreeEntry->setNext(currentFreeEntry->getNext(compressed), compressed);
+		} else {
+			_heapFreeList = currentFreeEntry->getNext(compressed);
+		}
+		_freeEntryCount -= 1;
+		removeHint(currentFreeEntry);
+	}
+
+	_heapLock.release();
+
+	return true;
+}
+
+void *
+MM_MemoryPoolAddressOrderedList::allocateSizeClassBatch(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription,
+											uintptr_t minimumSizeInBytesRequired, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	void *batchBase = NULL;
+
+	if (internalAllocateSizeClassBatch(env, minimumSizeInBytesRequired, maximumSizeInBytesRequired, addrBase, addrTop)) {
+		batchBase = addrBase;
+#if defined(OMR_GC_ALLOCATION_TAX)
+		if(env->getExtensions()->payAllocationTax) {
+			allocDescription->setAllocationTaxSize((uint8_t *)addrTop - (uint8_t *)addrBase);
+		}
+#endif  /* OMR_GC_ALLOCATION_TAX */
+
+		allocDescription->setTLHAllocation(true);
+		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
+		allocDescription->setMemoryPool(this);
+	}
+
+	return batchBase;
+}
+
 void *
 MM_MemoryPoolAddressOrderedList::collectorAllocateTLH(MM_EnvironmentBase *env,
 													 MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired,
@@ -1687,11 +1827,11 @@ MM_MemoryPoolAddressOrderedList::appendCollectorLargeAllocateStats()
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
-MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner)
 {
 	uintptr_t releasedBytes = 0;
 	_heapLock.acquire();
-	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList);
+	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList, returner);
 	_heapLock.release();
 	return releasedBytes;
 }
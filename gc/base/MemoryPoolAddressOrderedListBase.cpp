@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -32,6 +32,7 @@
 #include "AllocateDescription.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreePageReturner.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Collector.hpp"
 #include "MemoryPool.hpp"
@@ -188,15 +189,18 @@ MM_MemoryPoolAddressOrderedListBase::abandonMemoryInPool(MM_EnvironmentBase* env
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
-MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry)
+MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, MM_FreePageReturner *returner)
 {
 	bool const compressed = compressObjectReferences();
 	uintptr_t releasedMemory = 0;
 	MM_HeapLinkedFreeHeader* currentFreeEntry = freeEntry;
 	uintptr_t pageSize = env->getExtensions()->heap->getPageSize();
 	while (NULL != currentFreeEntry) {
-		/* skip entry less than page size */
-		if (pageSize <= currentFreeEntry->getSize()) {
+		if (NULL != returner) {
+			/* the returner keeps track of how long the pages of each entry have been free */
+			releasedMemory += returner->releaseIdleFreeEntryPages(env, currentFreeEntry);
+		} else if (pageSize <= currentFreeEntry->getSize()) {
+			/* skip entry less than page size */
 			uintptr_t addressBase = MM_Math::roundToCeiling(pageSize, (uintptr_t)currentFreeEntry + sizeof(MM_HeapLinkedFreeHeader));
 			/* release/decommit memory after Header */
 			uintptr_t totalFreePagesCount = (currentFreeEntry->getSize() - (addressBase - (uintptr_t)currentFreeEntry)) / pageSize;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -244,7 +244,7 @@ public:
 
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase* env)=0;
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry);
+	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, MM_FreePageReturner *returner);
 #endif
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
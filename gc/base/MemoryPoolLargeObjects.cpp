@@ -528,6 +528,13 @@ MM_MemoryPoolLargeObjects::allocateTLH(MM_EnvironmentBase* env, MM_AllocateDescr
 	return _memoryPoolSmallObjects->allocateTLH(env, allocDescription, maximumSizeInBytesRequired, addrBase, addrTop);
 }
 
+void*
+MM_MemoryPoolLargeObjects::allocateSizeClassBatch(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription,
+												  uintptr_t minimumSizeInBytesRequired, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop)
+{
+	return _memoryPoolSmallObjects->allocateSizeClassBatch(env, allocDescription, minimumSizeInBytesRequired, maximumSizeInBytesRequired, addrBase, addrTop);
+}
+
 /**
  * Find the free list entry whos end address matches the parameter.
  *
@@ -1129,10 +1136,10 @@ MM_MemoryPoolLargeObjects::resetLargeObjectAllocateStats()
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
-MM_MemoryPoolLargeObjects::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPoolLargeObjects::releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner)
 {
-	uintptr_t releasedMemory = _memoryPoolSmallObjects->releaseFreeMemoryPages(env);
-	releasedMemory += _memoryPoolLargeObjects->releaseFreeMemoryPages(env);
+	uintptr_t releasedMemory = _memoryPoolSmallObjects->releaseFreeMemoryPages(env, returner);
+	releasedMemory += _memoryPoolLargeObjects->releaseFreeMemoryPages(env, returner);
 	return releasedMemory;
 }
 #endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -190,6 +190,7 @@ public:
 	virtual void* collectorAllocate(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription, bool lockingRequired);
 
 	virtual void* allocateTLH(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop);
+	virtual void* allocateSizeClassBatch(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription, uintptr_t minimumSizeInBytesRequired, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop);
 	virtual void* collectorAllocateTLH(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop, bool lockingRequired);
 
 	virtual void reset(Cause cause = any);
@@ -262,7 +263,7 @@ public:
 	}
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner);
 #endif
 
 	/**
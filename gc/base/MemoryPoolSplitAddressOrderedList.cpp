@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -1298,14 +1298,14 @@ MM_MemoryPoolSplitAddressOrderedList::removeFreeEntriesWithinRange(MM_Environmen
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
-MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner)
 {
 	uintptr_t releasedMemory = 0;
 
 	for (uintptr_t i = 0; i < _heapFreeListCountExtended; i++) {
 		_heapFreeLists[i]._lock.acquire();
 		_heapFreeLists[i]._timesLocked += 1;
-		releasedMemory += releaseFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList);
+		releasedMemory += releaseFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList, returner);
 		_heapFreeLists[i]._lock.release();
 	}
 
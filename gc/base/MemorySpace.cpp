@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -583,12 +583,12 @@ MM_MemorySpace::getAllTypeFlags()
  * iterate through memorysubspace list & free up pages of free entries 
  */
 uintptr_t
-MM_MemorySpace::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemorySpace::releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner)
 {
         uintptr_t releasedMemory = 0;
         MM_MemorySubSpace* memorySubSpace = _memorySubSpaceList;
         while(NULL != memorySubSpace) {
-                releasedMemory += memorySubSpace->releaseFreeMemoryPages(env);
+                releasedMemory += memorySubSpace->releaseFreeMemoryPages(env, returner);
                 memorySubSpace = memorySubSpace->getNext();
         }
         return releasedMemory;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,6 +34,7 @@
 
 class MM_AllocateDescription;
 class MM_EnvironmentBase;
+class MM_FreePageReturner;
 class MM_Heap;
 class MM_HeapStats;
 class MM_MemorySubSpace;
@@ -186,7 +187,7 @@ public:
 	static MM_MemorySpace *getMemorySpace(void *memorySpace) { return (MM_MemorySpace *)memorySpace; }
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner);
 #endif
 	
 	/**
@@ -940,7 +940,7 @@ MM_MemorySubSpace::systemGarbageCollect(MM_EnvironmentBase* env, uint32_t gcCode
 		if ((J9MMCONSTANT_EXPLICIT_GC_IDLE_GC == gcCode) && (_extensions->gcOnIdle)) {
 			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 			uint64_t startTime = omrtime_hires_clock();
-			uintptr_t releasedBytes = _extensions->heap->getDefaultMemorySpace()->releaseFreeMemoryPages(env);
+			uintptr_t releasedBytes = _extensions->heap->getDefaultMemorySpace()->releaseFreeMemoryPages(env, NULL);
 			uint64_t endTime = omrtime_hires_clock();
 			TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
 				_extensions->privateHookInterface,
@@ -954,8 +954,7 @@ MM_MemorySubSpace::systemGarbageCollect(MM_EnvironmentBase* env, uint32_t gcCode
 				releasedBytes,
 				getActiveMemorySize(),
 				omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
-				/* reason enum variable not applicable/used, so passing univeral value 1 = not found*/
-				1 
+				RELEASE_FREE_PAGES_IDLE_GC
 				);
 		}
 #endif
@@ -1958,7 +1957,7 @@ MM_MemorySubSpace::wasContractedThisGC(uintptr_t gcCount)
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
-MM_MemorySubSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemorySubSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner)
 {
 	Assert_MM_unreachable();
         return 0;
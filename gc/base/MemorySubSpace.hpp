@@ -38,6 +38,7 @@ class MM_AllocateDescription;
 class MM_AllocationContext;
 class MM_Collector;
 class MM_EnvironmentBase;
+class MM_FreePageReturner;
 class MM_GCExtensionsBase;
 class MM_HeapRegionDescriptor;
 class MM_HeapStats;
@@ -446,7 +447,7 @@ public:
 	bool wasContractedThisGC(uintptr_t gcCount);
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, MM_FreePageReturner *returner);
 #endif
 
 	/**
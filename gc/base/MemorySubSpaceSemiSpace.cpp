@@ -792,6 +792,20 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBas
 		}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+		if (extensions->isScavengerPauseTargetEnabled() && (0.0 < _averageScavengeCopyRate)) {
+			/* Allocate space beyond what can be scavenged within the pause target is handed to the survivor,
+			 * which shortens the next scavenge when new space cannot contract any further
+			 */
+			double pauseTargetEvacuateSize = (_averageScavengeCopyRate * (double)(extensions->scavengerPauseTarget * 1000)) / _averageScavengeSurvivalRate;
+			double pauseTargetSurvivorSize = (double)currentSize - pauseTargetEvacuateSize;
+			if (desiredSurvivorSize < pauseTargetSurvivorSize) {
+				desiredSurvivorSize = pauseTargetSurvivorSize;
+			}
+			if(debug) {
+				omrtty_printf("\tPause target survivor size: %zu\n", (uintptr_t)desiredSurvivorSize);
+			}
+		}
+
 		_desiredSurvivorSpaceRatio = desiredSurvivorSize / currentSize;
 
 		if(debug) {
@@ -1006,6 +1020,119 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+/**
+ * Adjust the sub space memory (expand or contract) and the tenure age so that scavenges meet the pause target.
+ * The copy rate and survival rate measured over recent scavenges predict how many evacuated bytes can be
+ * scavenged within the target, and new space is resized towards that size.  When new space cannot move
+ * any further in the desired direction, the adaptive tenure age is adjusted instead, so that fewer (or more)
+ * objects are copied back and forth between the semi spaces.
+ */
+void
+MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_ScavengerStats *scavengerStats = &extensions->scavengerStats;
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	bool debug = extensions->debugDynamicNewSpaceSizing;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(debug) {
+		omrtty_printf("New space pause target check:\n");
+	}
+
+	if (scavengerStats->_endTime <= scavengerStats->_startTime) {
+		/* clock has been shifted backwards at the time of the scavenge */
+		if(debug) {
+			omrtty_printf("\tNo measurable scavenge time - ABORTING\n");
+		}
+		return;
+	}
+
+	uint64_t scavengeTime = omrtime_hires_delta(scavengerStats->_startTime, scavengerStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uintptr_t copiedBytes = scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+	/* we have flipped already, so the space just evacuated is the survivor */
+	uintptr_t evacuatedSize = _memorySubSpaceSurvivor->getActiveMemorySize();
+
+	if ((0 == scavengeTime) || (0 == copiedBytes) || (0 == evacuatedSize)) {
+		if(debug) {
+			omrtty_printf("\tNothing copied - ABORTING\n");
+		}
+		return;
+	}
+
+	double copyRate = (double)copiedBytes / (double)((int64_t)scavengeTime);
+	double survivalRate = (double)copiedBytes / (double)evacuatedSize;
+
+	if (0.0 == _averageScavengeCopyRate) {
+		_averageScavengeCopyRate = copyRate;
+		_averageScavengeSurvivalRate = survivalRate;
+		_averageScavengePauseTime = (double)((int64_t)scavengeTime);
+	} else {
+		_averageScavengeCopyRate = MM_Math::weightedAverage((float)_averageScavengeCopyRate, (float)copyRate, MODRON_PAUSE_TARGET_HISTORY_WEIGHT);
+		_averageScavengeSurvivalRate = MM_Math::weightedAverage((float)_averageScavengeSurvivalRate, (float)survivalRate, MODRON_PAUSE_TARGET_HISTORY_WEIGHT);
+		_averageScavengePauseTime = MM_Math::weightedAverage((float)_averageScavengePauseTime, (float)((int64_t)scavengeTime), MODRON_PAUSE_TARGET_HISTORY_WEIGHT);
+	}
+
+	double pauseTarget = (double)(extensions->scavengerPauseTarget * 1000);
+
+	if(debug) {
+		omrtty_printf("\tTime scav:%llu avg:%lf target:%lf\n", scavengeTime, _averageScavengePauseTime, pauseTarget);
+		omrtty_printf("\tCopy rate (bytes/us) current:%lf avg:%lf survival rate current:%lf avg:%lf\n", copyRate, _averageScavengeCopyRate, survivalRate, _averageScavengeSurvivalRate);
+	}
+
+	/* Evacuate size which is expected to be scavenged within the pause target */
+	double desiredEvacuateSize = (_averageScavengeCopyRate * pauseTarget) / _averageScavengeSurvivalRate;
+	double resizeFactor = (desiredEvacuateSize / (double)evacuatedSize) - 1.0;
+	bool nurseryResized = false;
+
+	if(debug) {
+		omrtty_printf("\tEvacuate size current:%zu desired:%zu factor:%lf new space size:%zu\n", evacuatedSize, (uintptr_t)desiredEvacuateSize, resizeFactor, getCurrentSize());
+	}
+
+	if (resizeFactor > MODRON_PAUSE_TARGET_TOLERANCE) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+			double adjustedExpansionFactor = OMR_MIN(resizeFactor, extensions->dnssMaximumExpansion);
+
+			_expansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(getCurrentSize() * adjustedExpansionFactor));
+			_expansionSize = MM_Math::roundToCeiling(2 * regionSize, _expansionSize);
+			nurseryResized = true;
+
+			if(debug) {
+				omrtty_printf("\tExpand decision - expandFactor adjusted: %lf size: %zu\n", adjustedExpansionFactor, _expansionSize);
+			}
+
+			extensions->heap->getResizeStats()->setLastExpandReason(SCAV_PAUSE_BELOW_TARGET);
+		}
+	} else if (resizeFactor < -MODRON_PAUSE_TARGET_TOLERANCE) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (0 != maxContractionInSpace(env))) {
+			double adjustedContractionFactor = OMR_MIN(-resizeFactor, extensions->dnssMaximumContraction);
+
+			_contractionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(getCurrentSize() * adjustedContractionFactor));
+			_contractionSize = MM_Math::roundToCeiling(regionSize, _contractionSize);
+			nurseryResized = true;
+
+			if(debug) {
+				omrtty_printf("\tContract decision - contractFactor adjusted: %lf size: %zu\n", adjustedContractionFactor, _contractionSize);
+			}
+
+			extensions->heap->getResizeStats()->setLastContractReason(SCAV_PAUSE_ABOVE_TARGET);
+		}
+	}
+
+	if (!nurseryResized && extensions->scvTenureStrategyAdaptive) {
+		/* New space could not be resized: tenure earlier to copy fewer bytes, or later to tenure less, instead */
+		if ((_averageScavengePauseTime > (pauseTarget * (1.0 + MODRON_PAUSE_TARGET_TOLERANCE))) && (extensions->scvTenureAdaptiveTenureAge > OBJECT_HEADER_AGE_MIN)) {
+			extensions->scvTenureAdaptiveTenureAge -= 1;
+		} else if ((_averageScavengePauseTime < (pauseTarget * (1.0 - MODRON_PAUSE_TARGET_TOLERANCE))) && (extensions->scvTenureAdaptiveTenureAge < OBJECT_HEADER_AGE_MAX)) {
+			extensions->scvTenureAdaptiveTenureAge += 1;
+		}
+
+		if(debug) {
+			omrtty_printf("\tTenure age: %zu\n", extensions->scvTenureAdaptiveTenureAge);
+		}
+	}
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
@@ -1020,6 +1147,10 @@ MM_MemorySubSpaceSemiSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDesc
 	 * we have to restore tilt (that has been set to 100% to do unified sliding compact of Nursery */
 	if (_extensions->isConcurrentScavengerEnabled() && _extensions->isScavengerBackOutFlagRaised()) {
 		flip(env, MM_MemorySubSpaceSemiSpace::restore_tilt_after_percolate);
+	} else if (_extensions->isScavengerPauseTargetEnabled()) {
+		/* refresh the measured copy rate before it bounds the tilt */
+		checkSubSpaceMemoryPostCollectPauseTarget(env);
+		checkSubSpaceMemoryPostCollectTilt(env);
 	} else {
 		checkSubSpaceMemoryPostCollectTilt(env);
 		checkSubSpaceMemoryPostCollectResize(env);
@@ -40,6 +40,8 @@ class MM_PhysicalSubArena;
 class MM_ObjectAllocationInterface;
 
 #define MODRON_SURVIVOR_SPACE_RATIO_DEFAULT 50
+#define MODRON_PAUSE_TARGET_HISTORY_WEIGHT 0.5f /**< weight of the history when averaging measurements for -Xgc:scavengerPauseTarget= */
+#define MODRON_PAUSE_TARGET_TOLERANCE 0.1 /**< fraction of the pause target within which new space is not resized */
 
 /**
  * @todo Provide class documentation
@@ -77,6 +79,10 @@ private:
 	double _averageScavengeTimeRatio;
 	uint64_t _lastScavengeEndTime;
 
+	double _averageScavengeCopyRate; /**< weighted average of bytes copied (flipped and tenured) per microsecond of scavenge, used with -Xgc:scavengerPauseTarget= */
+	double _averageScavengeSurvivalRate; /**< weighted average of the fraction of evacuated bytes which survived a scavenge, used with -Xgc:scavengerPauseTarget= */
+	double _averageScavengePauseTime; /**< weighted average scavenge pause in microseconds, used with -Xgc:scavengerPauseTarget= */
+
 	double _desiredSurvivorSpaceRatio;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uintptr_t _bytesAllocatedDuringConcurrent;
@@ -102,6 +108,7 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
+	void checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env);
 
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
@@ -188,6 +195,9 @@ public:
 		,_tiltedAverageBytesFlippedDelta(0)
 		,_averageScavengeTimeRatio(0.0)
 		,_lastScavengeEndTime(0)
+		,_averageScavengeCopyRate(0.0)
+		,_averageScavengeSurvivalRate(0.0)
+		,_averageScavengePauseTime(0.0)
 		,_desiredSurvivorSpaceRatio(0.0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)		
 		,_bytesAllocatedDuringConcurrent(0)
@@ -449,6 +449,18 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 		 *     the GC helper threads.
 		 */
 		_activeThreadCount = adjustThreadCount(_threadCount);
+
+		if (_extensions->adaptiveGCThreading) {
+			/* Shrink the active set to what the task measured it can keep busy. The active thread count is
+			 * updated (rather than only the task's count) so that consumers of activeThreadCount() see the
+			 * number of threads actually participating.
+			 */
+			uintptr_t recommendedThreadCount = task->getRecommendedWorkingThreads();
+			if (recommendedThreadCount < _activeThreadCount) {
+				Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_adaptive(env->getLanguageVMThread(), _activeThreadCount, recommendedThreadCount);
+				_activeThreadCount = recommendedThreadCount;
+			}
+		}
 	}
 
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,6 +34,7 @@
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -80,6 +81,48 @@ public:
 	}
 };
 
+/**
+ * Task running a batched object walk on the GC threads.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectBatchDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapWalkerObjectBatchFunc _function;
+	void *_userData;
+	uintptr_t _walkFlags;
+	uintptr_t _batchSize;
+	uintptr_t _chunkSize;
+
+	MM_ParallelHeapWalker *_heapWalker;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelObjectBatchDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, uintptr_t batchSize, uintptr_t chunkSize)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(userData)
+		, _walkFlags(walkFlags)
+		, _batchSize(batchSize)
+		, _chunkSize(chunkSize)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -158,6 +201,101 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+/**
+ * Walk through the objects of the heap handing them to the provided function in batches.
+ * Every thread walks the same sequence of regions and chunks and keeps the ones it claims, so the
+ * chunks of a large region are spread over the threads rather than the region as a whole.
+ */
+void
+MM_ParallelHeapWalker::allObjectsBatchDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, uintptr_t batchSize, uintptr_t chunkSize, bool parallel)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	bool useMarkMap = _markMap->isMarkMapValid();
+
+	batchSize = OMR_MAX(1, OMR_MIN(batchSize, HEAP_WALKER_MAX_BATCH_SIZE));
+	if (0 == chunkSize) {
+		/* same sizing as allObjectsDoParallel, about 8 chunks per thread */
+		uintptr_t threadCount = parallel ? env->_currentTask->getThreadCount() : 1;
+		chunkSize = extensions->heap->getMemorySize() / (threadCount * 8);
+		chunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, chunkSize);
+	}
+	/* chunks start on a mark map word so no two of them share one */
+	chunkSize = MM_Math::roundToCeiling(J9MODRON_HMI_HEAPMAP_ALIGNMENT, OMR_MAX(chunkSize, J9MODRON_HMI_HEAPMAP_ALIGNMENT));
+
+	Trc_MM_ParallelHeapWalker_allObjectsBatchDoParallel_Entry(env->getLanguageVMThread(), batchSize, chunkSize, useMarkMap ? "true" : "false");
+
+	omrobjectptr_t batch[HEAP_WALKER_MAX_BATCH_SIZE];
+	uintptr_t batchCount = 0;
+	uintptr_t objectsWalked = 0;
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+			omrobjectptr_t object = NULL;
+			if (useMarkMap) {
+				MM_HeapMapIterator markedObjectIterator(extensions);
+				uintptr_t *chunkBase = (uintptr_t *)region->getLowAddress();
+				uintptr_t *regionTop = (uintptr_t *)region->getHighAddress();
+				while (chunkBase < regionTop) {
+					uintptr_t *chunkTop = (uintptr_t *)((uintptr_t)chunkBase + OMR_MIN(chunkSize, (uintptr_t)regionTop - (uintptr_t)chunkBase));
+					if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+						markedObjectIterator.reset(_markMap, chunkBase, chunkTop);
+						while (NULL != (object = markedObjectIterator.nextObject())) {
+							batch[batchCount] = object;
+							batchCount += 1;
+							objectsWalked += 1;
+							if (batchSize == batchCount) {
+								flushBatch(omrVMThread, region, function, userData, batch, &batchCount);
+							}
+						}
+					}
+					chunkBase = chunkTop;
+				}
+			} else if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				/* without the mark map there is no way to find an object inside a region, it is walked whole */
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(extensions, region, false);
+				while (NULL != (object = objectIterator.nextObject())) {
+					batch[batchCount] = object;
+					batchCount += 1;
+					objectsWalked += 1;
+					if (batchSize == batchCount) {
+						flushBatch(omrVMThread, region, function, userData, batch, &batchCount);
+					}
+				}
+			}
+			/* a batch never spans regions */
+			flushBatch(omrVMThread, region, function, userData, batch, &batchCount);
+		}
+	}
+	regionManager->unlock();
+	Trc_MM_ParallelHeapWalker_allObjectsBatchDoParallel_Exit(env->getLanguageVMThread(), objectsWalked);
+}
+
+/**
+ * Walk through all objects of the heap and apply the provided function to batches of objects.
+ * If parallel is set to true, task is dispatched to GC threads which claim chunks of the heap,
+ * otherwise the calling thread walks the whole heap.
+ */
+void
+MM_ParallelHeapWalker::allObjectsBatchDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, uintptr_t batchSize, uintptr_t chunkSize, bool parallel, bool prepareHeapForWalk)
+{
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+	}
+
+	if (parallel) {
+		MM_ParallelObjectBatchDoTask objectBatchDoTask(env, this, function, userData, walkFlags, batchSize, chunkSize);
+		env->getExtensions()->dispatcher->run(env, &objectBatchDoTask);
+	} else {
+		allObjectsBatchDoParallel(env, function, userData, walkFlags, batchSize, chunkSize, false);
+	}
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -166,3 +304,12 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+/**
+ * gets the heap walker and calls the batched object walk
+ */
+void
+MM_ParallelObjectBatchDoTask::run(MM_EnvironmentBase *env)
+{
+	_heapWalker->allObjectsBatchDoParallel(env, _function, _userData, _walkFlags, _batchSize, _chunkSize, true);
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -25,10 +25,14 @@
 
 #include "omr.h"
 #include "omrcfg.h"
+#include "omrgcconsts.h"
 
 #include "HeapWalker.hpp"
 
+#define HEAP_WALKER_MAX_BATCH_SIZE 256 /**< Largest number of objects handed to a batch function in one call */
+
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
@@ -47,6 +51,17 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Hand the objects collected so far to the batch function and empty the batch.
+	 */
+	MMINLINE void
+	flushBatch(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, MM_HeapWalkerObjectBatchFunc function, void *userData, omrobjectptr_t *batch, uintptr_t *batchCount)
+	{
+		if (0 != *batchCount) {
+			function(omrVMThread, region, batch, *batchCount, userData);
+			*batchCount = 0;
+		}
+	}
 protected:
 public:	
 	/**
@@ -61,6 +76,24 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk through the objects of the heap handing them to the provided function in batches.
+	 * Called by every thread of the current task when parallel is true, by the caller alone otherwise.
+	 * @see allObjectsBatchDo()
+	 */
+	void allObjectsBatchDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, uintptr_t batchSize, uintptr_t chunkSize, bool parallel);
+
+	/**
+	 * Walk through all objects of the heap and apply the provided function to batches of up to batchSize
+	 * objects, all from the same region. When the mark map is valid only marked objects are reported and
+	 * regions are split into chunks of chunkSize bytes that GC threads claim one at a time, otherwise each
+	 * region is a single unit of work and every object in it is reported.
+	 * @param batchSize largest number of objects per call, clamped to HEAP_WALKER_MAX_BATCH_SIZE
+	 * @param chunkSize bytes of heap per unit of work when the mark map is valid, 0 to size chunks from the heap size and thread count
+	 * @param parallel true to dispatch the walk to the GC threads, false to walk on the calling thread
+	 */
+	void allObjectsBatchDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, uintptr_t batchSize, uintptr_t chunkSize, bool parallel, bool prepareHeapForWalk);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -85,6 +118,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelObjectBatchDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
@@ -31,6 +31,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "MarkingScheme.hpp"
+#include "WorkPackets.hpp"
 #include "WorkStack.hpp"
 
 
@@ -40,6 +41,12 @@ MM_ParallelMarkTask::getVMStateID()
 	return OMRVMSTATE_GC_MARK;
 }
 
+uintptr_t
+MM_ParallelMarkTask::getRecommendedWorkingThreads()
+{
+	return _markingScheme->getAdaptiveThreadCount()->getRecommendedThreadCount();
+}
+
 void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
@@ -90,6 +97,13 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+	if (_markingScheme->getWorkPackets()->isPacketStealingEnabled()) {
+		Trc_MM_ParallelMarkTask_stealStats(
+			env->getLanguageVMThread(),
+			(uint32_t)env->getWorkerID(),
+			env->_workPacketStats.workPacketsStolen,
+			env->_workPacketStats._stealIdleCount);
+	}
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
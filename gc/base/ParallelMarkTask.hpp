@@ -51,6 +51,7 @@ private:
 	
 public:
 	virtual uintptr_t getVMStateID();
+	virtual uintptr_t getRecommendedWorkingThreads();
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2014, 2017 IBM Corp. and others
+ * Copyright (c) 2014, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -27,6 +27,7 @@
 #if defined(OMR_GC)
 #include "GCExtensionsBase.hpp"
 #include "ConfigurationFlat.hpp"
+#include "FreePageReturner.hpp"
 #endif /* OMR_GC */
 
 #define OMR_GC_BUFFER_SIZE 256
@@ -37,6 +38,10 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCINCREMENTAL_COMPACTION_BUDGET "-Xgc:incrementalCompactionBudget="
+#define OMR_XGCINCREMENTAL_COMPACTION_BUDGET_LENGTH 33
+#define OMR_XGCINCREMENTAL_COMPACTION "-Xgc:incrementalCompaction"
+#define OMR_XGCINCREMENTAL_COMPACTION_LENGTH 26
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,8 +53,62 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCVERBOSE_BINARY_LOGGING "-Xgc:verboseBinaryLogging"
+#define OMR_XGCVERBOSE_BINARY_LOGGING_LENGTH 25
+#define OMR_XGCVERBOSE_BINARY_BUFFER_SIZE "-Xgc:verboseBinaryBufferSize="
+#define OMR_XGCVERBOSE_BINARY_BUFFER_SIZE_LENGTH 29
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCWORKPACKET_STEALING "-Xgc:workPacketStealing"
+#define OMR_XGCWORKPACKET_STEALING_LENGTH 23
+#define OMR_XGCSCAVENGER_NUMA_AWARE_COPY "-Xgc:scavengerNumaAwareCopy"
+#define OMR_XGCSCAVENGER_NUMA_AWARE_COPY_LENGTH 27
+#define OMR_XGCSCAVENGER_REMEMBERED_SET_CARDS "-Xgc:scavengerRememberedSetCards"
+#define OMR_XGCSCAVENGER_REMEMBERED_SET_CARDS_LENGTH 32
+#define OMR_XGCSCAVENGER_PAUSE_TARGET "-Xgc:scavengerPauseTarget="
+#define OMR_XGCSCAVENGER_PAUSE_TARGET_LENGTH 26
+#define OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH "-Xgc:scavengerHierarchicalCopyDepth="
+#define OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH_LENGTH 36
+#define OMR_XGCSCAVENGER_HIERARCHICAL_COPY "-Xgc:scavengerHierarchicalCopy"
+#define OMR_XGCSCAVENGER_HIERARCHICAL_COPY_LENGTH 30
+#define OMR_XGCADAPTIVE_GC_THREADING "-Xgc:adaptiveGCThreading"
+#define OMR_XGCADAPTIVE_GC_THREADING_LENGTH 24
+#define OMR_XGCCONCURRENT_SWEEP "-Xgc:concurrentSweep"
+#define OMR_XGCCONCURRENT_SWEEP_LENGTH 20
+#define OMR_XGCCONCURRENT_MARK_PACER "-Xgc:concurrentMarkPacer"
+#define OMR_XGCCONCURRENT_MARK_PACER_LENGTH 24
+#define OMR_XGCCARD_CLEANING_SUMMARY "-Xgc:cardCleaningSummary"
+#define OMR_XGCCARD_CLEANING_SUMMARY_LENGTH 24
+#define OMR_XGCNO_CARD_CLEANING_SUMMARY "-Xgc:noCardCleaningSummary"
+#define OMR_XGCNO_CARD_CLEANING_SUMMARY_LENGTH 26
+#define OMR_XGCTLH_SIZE_CLASS_CACHE "-Xgc:tlhSizeClassCache"
+#define OMR_XGCTLH_SIZE_CLASS_CACHE_LENGTH 22
+#define OMR_XGCHUGE_PAGES_NURSERY "-Xgc:hugePages=nursery"
+#define OMR_XGCHUGE_PAGES_NURSERY_LENGTH 22
+#define OMR_XGCHUGE_PAGES_TENURE "-Xgc:hugePages=tenure"
+#define OMR_XGCHUGE_PAGES_TENURE_LENGTH 21
+#define OMR_XGCHUGE_PAGES "-Xgc:hugePages"
+#define OMR_XGCHUGE_PAGES_LENGTH 14
+#define OMR_XGCNUMA_INTERLEAVE "-Xgc:numaInterleave"
+#define OMR_XGCNUMA_INTERLEAVE_LENGTH 19
+#define OMR_XGCSEGREGATED_ALLOCATION_MAGAZINES "-Xgc:segregatedAllocationMagazines"
+#define OMR_XGCSEGREGATED_ALLOCATION_MAGAZINES_LENGTH 34
+#define OMR_XGCSEGREGATED_LAZY_SWEEP_THREADS "-Xgc:segregatedLazySweepThreads="
+#define OMR_XGCSEGREGATED_LAZY_SWEEP_THREADS_LENGTH 32
+#define OMR_XGCSEGREGATED_LAZY_SWEEP "-Xgc:segregatedLazySweep"
+#define OMR_XGCSEGREGATED_LAZY_SWEEP_LENGTH 24
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#define OMR_XGCCONCURRENT_SCAVENGER_SLOWDOWN_TARGET "-Xgc:concurrentScavengerSlowdownTarget="
+#define OMR_XGCCONCURRENT_SCAVENGER_SLOWDOWN_TARGET_LENGTH 39
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#define OMR_XGCFREE_PAGE_RETURNER_MINIMUM_SIZE "-Xgc:freePageReturnerMinimumSize="
+#define OMR_XGCFREE_PAGE_RETURNER_MINIMUM_SIZE_LENGTH 33
+#define OMR_XGCFREE_PAGE_RETURNER_IDLE_CYCLES "-Xgc:freePageReturnerIdleCycles="
+#define OMR_XGCFREE_PAGE_RETURNER_IDLE_CYCLES_LENGTH 32
+#define OMR_XGCFREE_PAGE_RETURNER "-Xgc:freePageReturner"
+#define OMR_XGCFREE_PAGE_RETURNER_LENGTH 21
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +323,20 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCINCREMENTAL_COMPACTION_BUDGET, OMR_XGCINCREMENTAL_COMPACTION_BUDGET_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCINCREMENTAL_COMPACTION_BUDGET_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->incrementalCompactionBudget = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCINCREMENTAL_COMPACTION, OMR_XGCINCREMENTAL_COMPACTION_LENGTH)) {
+		/* compaction is disabled by default, so the incremental mode also enables the compaction triggers */
+		extensions->incrementalCompaction = true;
+		extensions->noCompactOnGlobalGC = 0;
+		extensions->nocompactOnSystemGC = 0;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +349,129 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSE_BINARY_LOGGING, OMR_XGCVERBOSE_BINARY_LOGGING_LENGTH)) {
+		extensions->verboseBinaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSE_BINARY_BUFFER_SIZE, OMR_XGCVERBOSE_BINARY_BUFFER_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCVERBOSE_BINARY_BUFFER_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->verboseBinaryBufferSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKPACKET_STEALING, OMR_XGCWORKPACKET_STEALING_LENGTH)) {
+		extensions->workPacketStealing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_GC_THREADING, OMR_XGCADAPTIVE_GC_THREADING_LENGTH)) {
+		extensions->adaptiveGCThreading = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_SIZE_CLASS_CACHE, OMR_XGCTLH_SIZE_CLASS_CACHE_LENGTH)) {
+		extensions->tlhSizeClassCache = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHUGE_PAGES_NURSERY, OMR_XGCHUGE_PAGES_NURSERY_LENGTH)) {
+		extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_NURSERY;
+	}
+	else if (0 == strncmp(option, OMR_XGCHUGE_PAGES_TENURE, OMR_XGCHUGE_PAGES_TENURE_LENGTH)) {
+		extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_TENURE;
+	}
+	else if (0 == strncmp(option, OMR_XGCHUGE_PAGES, OMR_XGCHUGE_PAGES_LENGTH)) {
+		extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_ALL;
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMA_INTERLEAVE, OMR_XGCNUMA_INTERLEAVE_LENGTH)) {
+		extensions->heapNumaInterleave = true;
+	}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_ALLOCATION_MAGAZINES, OMR_XGCSEGREGATED_ALLOCATION_MAGAZINES_LENGTH)) {
+		extensions->segregatedAllocationMagazines = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_LAZY_SWEEP_THREADS, OMR_XGCSEGREGATED_LAZY_SWEEP_THREADS_LENGTH)) {
+		uintptr_t threads = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSEGREGATED_LAZY_SWEEP_THREADS_LENGTH, &threads)) {
+			result = false;
+		} else {
+			extensions->segregatedLazySweep = true;
+			extensions->segregatedLazySweepThreads = threads;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_LAZY_SWEEP, OMR_XGCSEGREGATED_LAZY_SWEEP_LENGTH)) {
+		extensions->segregatedLazySweep = true;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	else if (0 == strncmp(option, OMR_XGCFREE_PAGE_RETURNER_MINIMUM_SIZE, OMR_XGCFREE_PAGE_RETURNER_MINIMUM_SIZE_LENGTH)) {
+		uintptr_t minimumSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCFREE_PAGE_RETURNER_MINIMUM_SIZE_LENGTH, &minimumSize)) {
+			result = false;
+		} else {
+			extensions->freePageReturnerMinimumSize = minimumSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCFREE_PAGE_RETURNER_IDLE_CYCLES, OMR_XGCFREE_PAGE_RETURNER_IDLE_CYCLES_LENGTH)) {
+		uintptr_t idleCycles = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCFREE_PAGE_RETURNER_IDLE_CYCLES_LENGTH, &idleCycles)) || (0 == idleCycles) || (FREE_PAGE_RETURNER_MAXIMUM_IDLE_CYCLES < idleCycles)) {
+			result = false;
+		} else {
+			extensions->freePageReturnerIdleCycles = idleCycles;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCFREE_PAGE_RETURNER, OMR_XGCFREE_PAGE_RETURNER_LENGTH)) {
+		extensions->freePageReturner = true;
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_NUMA_AWARE_COPY, OMR_XGCSCAVENGER_NUMA_AWARE_COPY_LENGTH)) {
+		extensions->scavengerNumaAwareCopy = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_REMEMBERED_SET_CARDS, OMR_XGCSCAVENGER_REMEMBERED_SET_CARDS_LENGTH)) {
+		extensions->scavengerRememberedSetCards = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_PAUSE_TARGET, OMR_XGCSCAVENGER_PAUSE_TARGET_LENGTH)) {
+		uintptr_t pauseTarget = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGER_PAUSE_TARGET_LENGTH, &pauseTarget)) {
+			result = false;
+		} else {
+			extensions->scavengerPauseTarget = pauseTarget;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH, OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH_LENGTH)) {
+		uintptr_t depth = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAVENGER_HIERARCHICAL_COPY_DEPTH_LENGTH, &depth)) || (0 == depth)) {
+			result = false;
+		} else {
+			extensions->scavengerHierarchicalCopyDepth = depth;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_HIERARCHICAL_COPY, OMR_XGCSCAVENGER_HIERARCHICAL_COPY_LENGTH)) {
+		extensions->scavengerHierarchicalCopy = true;
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SCAVENGER_SLOWDOWN_TARGET, OMR_XGCCONCURRENT_SCAVENGER_SLOWDOWN_TARGET_LENGTH)) {
+		uintptr_t slowdownTarget = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCONCURRENT_SCAVENGER_SLOWDOWN_TARGET_LENGTH, &slowdownTarget)) || (100 < slowdownTarget)) {
+			result = false;
+		} else {
+			extensions->concurrentScavengerSlowdownTarget = slowdownTarget;
+		}
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SWEEP, OMR_XGCCONCURRENT_SWEEP_LENGTH)) {
+		extensions->concurrentSweep = true;
+	}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_MARK_PACER, OMR_XGCCONCURRENT_MARK_PACER_LENGTH)) {
+		extensions->concurrentMarkPacer = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCARD_CLEANING_SUMMARY, OMR_XGCCARD_CLEANING_SUMMARY_LENGTH)) {
+		extensions->cardCleaningSummary = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_CARD_CLEANING_SUMMARY, OMR_XGCNO_CARD_CLEANING_SUMMARY_LENGTH)) {
+		extensions->cardCleaningSummary = false;
+	}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -132,6 +132,9 @@ MM_TLHAllocationInterface::kill(MM_EnvironmentBase *env)
 	}
 	
 	_tlhAllocationSupport.reconnect(env, shouldFlush);
+	if (shouldFlush) {
+		_sizeClassCache.flushCache(env);
+	}
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.reconnect(env, shouldFlush);
@@ -190,6 +193,11 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	} else {
 		result = allocateFromTLH(env, allocDescription, shouldCollectOnFailure);
 
+		if ((NULL == result) && (NULL == ac) && env->getExtensions()->tlhSizeClassCache) {
+			/* too large for a TLH refresh, try a size class cache before taking the pool lock for a single object */
+			result = _sizeClassCache.allocateObject(env, allocDescription, memorySpace, shouldCollectOnFailure);
+		}
+
 		if (NULL == result) {
 			if (NULL != ac) {
 				result = ac->allocateObject(env, allocDescription, shouldCollectOnFailure);
@@ -264,6 +272,9 @@ MM_TLHAllocationInterface::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescr
 {
 	void *result = NULL;
 
+	if (_sizeClassCache.isRefilling()) {
+		result = _sizeClassCache.allocateTLH(env, allocDescription, memorySubSpace, memoryPool);
+	} else
 #if defined(OMR_GC_NON_ZERO_TLH)
 	if (allocDescription->getNonZeroTLHFlag()) {
 		result = _tlhAllocationSupportNonZero.allocateTLH(env, allocDescription, memorySubSpace, memoryPool);
@@ -302,6 +313,8 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	_sizeClassCache.flushCache(env);
 }
 
 void
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,6 +34,7 @@
 
 #include "ObjectAllocationInterface.hpp"
 #include "TLHAllocationSupport.hpp"
+#include "TLHSizeClassCache.hpp"
 
 class MM_AllocateDescription;
 class MM_EnvironmentBase;
@@ -61,6 +62,8 @@ private:
 	MM_TLHAllocationSupport _tlhAllocationSupportNonZero; /**< TLH Allocation sub interface class */
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 
+	MM_TLHSizeClassCache _sizeClassCache; /**< Per size class caches for allocates that miss the TLH (used if tlhSizeClassCache is enabled) */
+
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
 
@@ -101,11 +104,13 @@ private:
 #if defined(OMR_GC_NON_ZERO_TLH)
 		_tlhAllocationSupportNonZero(env, false),
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+		_sizeClassCache(),
 		_cachedAllocationsEnabled(true),
 		_bytesAllocatedBase(0)
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
+		_sizeClassCache._objectAllocationInterface = this;
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 		_tlhAllocationSupportNonZero._objectAllocationInterface = this;
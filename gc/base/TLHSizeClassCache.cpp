@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+
+#include "TLHSizeClassCache.hpp"
+
+#include "ModronAssertions.h"
+#include "mmprivatehook_internal.h"
+#include "ut_j9mm.h"
+
+#include "AllocateDescription.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "ObjectAllocationInterface.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+uintptr_t
+MM_TLHSizeClassCache::getSizeClass(uintptr_t sizeInBytes)
+{
+	uintptr_t sizeClass = 0;
+	if (sizeInBytes > ((uintptr_t)1 << minimumSizeClassShift)) {
+		/* round up to the next power of two */
+		sizeClass = MM_Math::floorLog2(sizeInBytes - 1) + 1 - minimumSizeClassShift;
+	}
+	return OMR_MIN(sizeClass, (uintptr_t)sizeClassCount);
+}
+
+uintptr_t
+MM_TLHSizeClassCache::getRefillSize(MM_EnvironmentBase *env, uintptr_t sizeClass)
+{
+	uintptr_t sizeClassSize = (uintptr_t)1 << (minimumSizeClassShift + sizeClass);
+	/* batches of small classes are bounded by the TLH maximum, but every refill serves at least two objects */
+	uintptr_t batchSize = OMR_MAX(env->getExtensions()->tlhMaximumSize, 2 * sizeClassSize);
+	return OMR_MIN(batchObjectCount * sizeClassSize, batchSize);
+}
+
+void *
+MM_TLHSizeClassCache::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
+{
+	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+	uintptr_t sizeClass = getSizeClass(sizeInBytesRequired);
+	if (sizeClassCount == sizeClass) {
+		return NULL;
+	}
+
+	SizeClassRegion *region = &_regions[sizeClass];
+	if (sizeInBytesRequired > (uintptr_t)(region->top - region->alloc)) {
+		if (!refill(env, allocDescription, memorySpace, sizeClass, shouldCollectOnFailure)) {
+			return NULL;
+		}
+	}
+
+	/* a collection during the refill may have flushed the region again */
+	if (sizeInBytesRequired > (uintptr_t)(region->top - region->alloc)) {
+		return NULL;
+	}
+
+	void *result = (void *)region->alloc;
+	region->alloc += sizeInBytesRequired;
+
+	/* the allocate is reported as an ordinary out of line allocate; the refill already paid the tax for the region */
+	allocDescription->setTLHAllocation(false);
+	allocDescription->setMemorySubSpace(region->memorySubSpace);
+	allocDescription->setMemoryPool(region->memoryPool);
+	allocDescription->setObjectFlags(region->memorySubSpace->getObjectFlags());
+
+	return result;
+}
+
+bool
+MM_TLHSizeClassCache::refill(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace, uintptr_t sizeClass, bool shouldCollectOnFailure)
+{
+	flushRegion(env, &_regions[sizeClass]);
+
+	/* the subspace calls back through the owning allocation interface, which hands the request to allocateTLH() */
+	_refillSizeClass = sizeClass;
+	MM_MemorySubSpace *subspace = memorySpace->getDefaultMemorySubSpace();
+	bool result = (NULL != subspace->allocateTLH(env, allocDescription, _objectAllocationInterface, NULL, NULL, shouldCollectOnFailure));
+	_refillSizeClass = UDATA_MAX;
+
+	return result;
+}
+
+void *
+MM_TLHSizeClassCache::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
+{
+	Assert_MM_true(isRefilling());
+
+	SizeClassRegion *region = &_regions[_refillSizeClass];
+	uintptr_t refillSize = getRefillSize(env, _refillSizeClass);
+	void *addrBase = NULL;
+	void *addrTop = NULL;
+
+	if (NULL == memoryPool->allocateSizeClassBatch(env, allocDescription, allocDescription->getContiguousBytes(), refillSize, addrBase, addrTop)) {
+		Trc_MM_TLHSizeClassCache_refillFailed(env->getLanguageVMThread(), _refillSizeClass, allocDescription->getContiguousBytes());
+		return NULL;
+	}
+
+	region->base = (uint8_t *)addrBase;
+	region->alloc = (uint8_t *)addrBase;
+	region->top = (uint8_t *)addrTop;
+	region->memorySubSpace = memorySubSpace;
+	region->memoryPool = memoryPool;
+
+	allocDescription->setMemorySubSpace(memorySubSpace);
+	allocDescription->setObjectFlags(memorySubSpace->getObjectFlags());
+
+	TRIGGER_J9HOOK_MM_PRIVATE_CACHE_REFRESHED(env->getExtensions()->privateHookInterface, env->getOmrVMThread(), env->getMemorySpace()->getDefaultMemorySubSpace(), addrBase, addrTop);
+	Trc_MM_TLHSizeClassCache_refill(env->getLanguageVMThread(), _refillSizeClass, (uintptr_t)addrTop - (uintptr_t)addrBase);
+
+	return addrBase;
+}
+
+void
+MM_TLHSizeClassCache::flushRegion(MM_EnvironmentBase *env, SizeClassRegion *region)
+{
+	if (NULL != region->memoryPool) {
+		region->memoryPool->abandonTlhHeapChunk(region->alloc, region->top);
+
+		MM_EnvironmentBase *owningEnv = _objectAllocationInterface->getOwningEnv();
+		TRIGGER_J9HOOK_MM_PRIVATE_CACHE_CLEARED(env->getExtensions()->privateHookInterface, owningEnv->getOmrVMThread(), owningEnv->getMemorySpace()->getDefaultMemorySubSpace(), region->base, region->alloc, region->top);
+	}
+	clearRegion(region);
+}
+
+void
+MM_TLHSizeClassCache::flushCache(MM_EnvironmentBase *env)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < sizeClassCount; sizeClass++) {
+		flushRegion(env, &_regions[sizeClass]);
+	}
+}
+
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(TLHSIZECLASSCACHE_HPP_)
+#define TLHSIZECLASSCACHE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+class MM_AllocateDescription;
+class MM_EnvironmentBase;
+class MM_MemoryPool;
+class MM_MemorySpace;
+class MM_MemorySubSpace;
+class MM_ObjectAllocationInterface;
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+/**
+ * Per-thread segregated cache for objects that miss the TLH.
+ *
+ * Objects too large to be worth a TLH refresh would otherwise go to the memory pool one at a time,
+ * each allocate taking the pool lock and walking the free list. Instead, requests are binned by
+ * power of two size classes; each class owns a small bump allocation region that is refilled from
+ * the pool with one TLH style allocate sized for a batch of objects of that class. The regions are
+ * treated like TLHs by the rest of the collector: they are reported as cache refreshes and clears,
+ * and are returned to the pool whenever the TLHs are flushed.
+ * @ingroup GC_Base
+ */
+class MM_TLHSizeClassCache
+{
+/* Data members / types */
+public:
+	enum {
+		minimumSizeClassShift = 10, /**< log2 of the smallest size class (1KB) */
+		sizeClassCount = 8, /**< Number of size classes (1KB to 128KB) */
+		batchObjectCount = 16 /**< Number of objects of a class a refill aims to provide for */
+	};
+
+protected:
+private:
+	/**
+	 * Bump allocation region of a size class.
+	 */
+	struct SizeClassRegion {
+		uint8_t *base; /**< Base of the region, NULL if the class has no region */
+		uint8_t *alloc; /**< Next free byte */
+		uint8_t *top; /**< Top of the region */
+		MM_MemorySubSpace *memorySubSpace; /**< Subspace the region was allocated from */
+		MM_MemoryPool *memoryPool; /**< Pool the region was allocated from */
+	};
+
+	MM_ObjectAllocationInterface *_objectAllocationInterface; /**< Owning allocation interface */
+	SizeClassRegion _regions[sizeClassCount]; /**< Current region of each size class */
+	uintptr_t _refillSizeClass; /**< Size class being refilled from the pool, UDATA_MAX if there is no refill in progress */
+
+/* Methods */
+public:
+	/**
+	 * Attempt to allocate an object from the cache, refilling the region of its size class if needed.
+	 * @param memorySpace[in] The memory space to refill from
+	 * @param shouldCollectOnFailure[in] true if a refill may trigger a collection
+	 * @return the allocated object, or NULL if the size is not cached or the region could not be refilled
+	 */
+	void *allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure);
+
+	/**
+	 * Provide the pool memory for a refill in progress.
+	 * Called back from the memory subspace through the owning allocation interface.
+	 * @return base of the new region, or NULL if the pool could not provide one
+	 */
+	void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+
+	/**
+	 * Return the unused part of all regions to their pools, leaving the heap walkable.
+	 * @note The calling environment may not be the receivers owning environment.
+	 */
+	void flushCache(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the owning thread is refilling a size class, and TLH requests are meant for the receiver
+	 */
+	MMINLINE bool isRefilling() { return UDATA_MAX != _refillSizeClass; }
+
+	/**
+	 * Create a TLHSizeClassCache object.
+	 */
+	MM_TLHSizeClassCache() :
+		_objectAllocationInterface(NULL),
+		_refillSizeClass(UDATA_MAX)
+	{
+		for (uintptr_t sizeClass = 0; sizeClass < sizeClassCount; sizeClass++) {
+			clearRegion(&_regions[sizeClass]);
+		}
+	};
+
+protected:
+private:
+	/**
+	 * @return the size class for the given object size, or sizeClassCount if the size is too large to be cached
+	 */
+	static uintptr_t getSizeClass(uintptr_t sizeInBytes);
+
+	/**
+	 * @return the number of bytes requested from the pool when refilling the given size class
+	 */
+	static uintptr_t getRefillSize(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	bool refill(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace, uintptr_t sizeClass, bool shouldCollectOnFailure);
+	void flushRegion(MM_EnvironmentBase *env, SizeClassRegion *region);
+
+	MMINLINE static void
+	clearRegion(SizeClassRegion *region)
+	{
+		region->base = NULL;
+		region->alloc = NULL;
+		region->top = NULL;
+		region->memorySubSpace = NULL;
+		region->memoryPool = NULL;
+	}
+
+	/*
+	 * friends
+	 */
+	friend class MM_TLHAllocationInterface;
+};
+
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#endif /* TLHSIZECLASSCACHE_HPP_ */
@@ -144,6 +144,14 @@ public:
 	 * @note All tasks must implement this method - the IDs are defined in @ref j9modron.h
 	 */
 	virtual uintptr_t getVMStateID(void) = 0;
+
+	/**
+	 * Return the number of threads the task would like to run with, as learned from previous runs.
+	 * Only consulted by the dispatcher when adaptive GC threading is enabled, and never used to exceed
+	 * the thread count the dispatcher would otherwise pick.
+	 * @return the recommended thread count, or UDATA_MAX if the task has no preference
+	 */
+	virtual uintptr_t getRecommendedWorkingThreads() { return UDATA_MAX; }
 	
 	/**
 	 * Return true if threads are currently synchronized, false otherwise
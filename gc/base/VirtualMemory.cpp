@@ -149,6 +149,14 @@ MM_VirtualMemory::reserveMemory(J9PortVmemParams* params)
 	_reserveSize = MM_Math::roundToCeiling(_pageSize, params->byteAmount);
 	params->byteAmount = _reserveSize;
 
+	/* interleave the heap only, leaving the port library policy in place for all other reservations */
+	bool interleave = _extensions->heapNumaInterleave
+			&& (OMRMEM_CATEGORY_MM_RUNTIME_HEAP == params->category)
+			&& (0 == omrport_control(OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_IN_USE, 0));
+	if (interleave) {
+		omrport_control(OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_MEM, 1);
+	}
+
 	memset(&_identifier, 0, sizeof(J9PortVmemIdentifier));
 	_baseAddress = omrvmem_reserve_memory_ex(&_identifier, params);
 
@@ -156,8 +164,18 @@ MM_VirtualMemory::reserveMemory(J9PortVmemParams* params)
 		_pageSize = omrvmem_get_page_size(&_identifier);
 		_pageFlags = omrvmem_get_page_flags(&_identifier);
 		Assert_MM_true(0 != _pageSize);
+		/* the port advises mmap reservations of default pages for transparent huge pages and interleaves any reservation while these are in use */
+		_transparentHugePages = (omrvmem_supported_page_sizes()[0] == _pageSize)
+				&& OMR_ARE_NO_BITS_SET(_mode, OMRPORT_VMEM_MEMORY_MODE_MMAP_HUGE_PAGES)
+				&& (1 == omrport_control(OMRPORT_CTLDATA_VMEM_ADVISE_HUGEPAGE_IN_USE, 0));
+		_numaInterleaved = (1 == omrport_control(OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_IN_USE, 0));
+		Trc_MM_VirtualMemory_reserveMemory_backing(_baseAddress, _reserveSize, _pageSize, _transparentHugePages ? "true" : "false", _numaInterleaved ? "true" : "false");
 		addressToReturn = (void*)MM_Math::roundToCeiling(_heapAlignment, (uintptr_t)_baseAddress);
 	}
+
+	if (interleave) {
+		omrport_control(OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_MEM, 0);
+	}
 	return addressToReturn;
 }
 
@@ -57,6 +57,8 @@ private:
 	uintptr_t _reserveSize; /**< The total number of bytes reserved, starting from _baseAddress */
 	uintptr_t _mode; /**< requested memory mode (memory flags combination) */
 	uintptr_t _consumerCount; /**< number of memory consumers attached to this virtual memory instance */
+	bool _transparentHugePages; /**< true if the reservation was backed by default pages and advised for transparent huge pages */
+	bool _numaInterleaved; /**< true if the reservation was interleaved across NUMA nodes */
 	J9PortVmemIdentifier _identifier;
 
 protected:
@@ -96,6 +98,8 @@ protected:
 		, _reserveSize(0)
 		, _mode(mode)
 		, _consumerCount(0)
+		, _transparentHugePages(false)
+		, _numaInterleaved(false)
 		, _identifier()
 		, _extensions(env->getExtensions())
 		, _baseAddress(NULL)
@@ -153,6 +157,22 @@ protected:
 		return _pageFlags;
 	}
 
+	/**
+	 * Return true if the virtual memory object is backed by default pages advised for transparent huge pages
+	 */
+	MMINLINE bool isTransparentHugePages()
+	{
+		return _transparentHugePages;
+	}
+
+	/**
+	 * Return true if the virtual memory object is interleaved across NUMA nodes
+	 */
+	MMINLINE bool isNumaInterleaved()
+	{
+		return _numaInterleaved;
+	}
+
 	/**
 	 * Return number of memory consumers attached to this virtual memory object
 	 * @return consumers number
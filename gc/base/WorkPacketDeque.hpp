@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKPACKETDEQUE_HPP_)
+#define WORKPACKETDEQUE_HPP_
+
+#include "omr.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_Packet;
+
+/**
+ * Bounded Chase-Lev work-stealing deque of work packets.
+ *
+ * The owning GC thread pushes and pops packets at the bottom end without taking any lock;
+ * other GC threads steal from the top end with a single compare-and-swap. The deque has a
+ * fixed capacity - when it is full the owner is expected to fall back to the shared packet lists.
+ * @ingroup GC_Base
+ */
+class MM_WorkPacketDeque : public MM_BaseNonVirtual
+{
+/* Data members / types */
+public:
+	enum {
+		_capacity = 64, /**< Maximum number of packets held by a deque (must be a power of 2) */
+		_capacityMask = _capacity - 1
+	};
+
+protected:
+private:
+	volatile uintptr_t _top; /**< Index of the oldest packet, advanced by thieves (and by the owner when taking the last packet) */
+	volatile uintptr_t _bottom; /**< Index one past the newest packet, only written by the owner */
+	MM_Packet * volatile _slots[_capacity]; /**< Circular buffer of packets */
+	uintptr_t _randomSeed; /**< State of the owner's victim selection generator */
+
+/* Methods */
+public:
+	/**
+	 * Push a packet at the bottom of the deque. Must only be called by the owning thread.
+	 * @param packet[in] The packet to push
+	 * @return true if the packet was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	pushBottom(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((bottom - top) >= (uintptr_t)_capacity) {
+			return false;
+		}
+		_slots[bottom & _capacityMask] = packet;
+		/* the slot must be visible before thieves can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed packet. Must only be called by the owning thread.
+	 * @return the packet, or NULL if the deque is empty (or the last packet was stolen concurrently)
+	 */
+	MMINLINE MM_Packet *
+	popBottom()
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if (bottom == top) {
+			return NULL;
+		}
+
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation of the bottom slot before re-reading top (store-load ordering) */
+		MM_AtomicOperations::sync();
+		top = _top;
+
+		MM_Packet *packet = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			/* more than one packet left, no race with thieves is possible */
+			packet = _slots[bottom & _capacityMask];
+		} else if (bottom == top) {
+			/* last packet - race any thieves for it */
+			packet = _slots[bottom & _capacityMask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+			_bottom = top + 1;
+		} else {
+			/* a thief took the last packet */
+			_bottom = top;
+		}
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet from the deque. May be called by any thread.
+	 * @return the stolen packet, or NULL if the deque was empty or another thread won the race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readBarrier();
+		uintptr_t bottom = _bottom;
+
+		MM_Packet *packet = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			packet = _slots[top & _capacityMask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+		}
+		return packet;
+	}
+
+	/**
+	 * @return true if the deque appears to be empty (the answer may be stale if other threads are active)
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	/**
+	 * Pick the next victim to steal from, using a xorshift generator local to the owner.
+	 * @param bound[in] Number of candidate victims
+	 * @return an index in the range [0, bound)
+	 */
+	MMINLINE uintptr_t
+	nextVictim(uintptr_t bound)
+	{
+		uintptr_t x = _randomSeed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		_randomSeed = x;
+		return x % bound;
+	}
+
+	/**
+	 * Reset the deque to the empty state. Must only be called while no thread is accessing the deque.
+	 * @param seed[in] Seed for victim selection (must not be 0)
+	 */
+	void
+	reset(uintptr_t seed)
+	{
+		_top = 0;
+		_bottom = 0;
+		_randomSeed = seed;
+	}
+
+	/**
+	 * Create a WorkPacketDeque object.
+	 */
+	MM_WorkPacketDeque() :
+		MM_BaseNonVirtual(),
+		_top(0),
+		_bottom(0),
+		_randomSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKPACKETDEQUE_HPP_ */
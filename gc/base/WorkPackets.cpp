@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -241,6 +241,12 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_allocatingPackets = NULL;
 	}
 
+	if (NULL != _packetDeques) {
+		env->getForge()->free(_packetDeques);
+		_packetDeques = NULL;
+		_packetDequeCount = 0;
+	}
+
 	_emptyPacketList.tearDown(env);
 	_fullPacketList.tearDown(env);
 	_nonEmptyPacketList.tearDown(env);
@@ -249,10 +255,43 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 	_deferredFullPacketList.tearDown(env);
 }
 
+/**
+ * Allocate a work-stealing deque for each GC thread
+ * @return true on success, false on allocation failure
+ */
+bool
+MM_WorkPackets::initializePacketDeques(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(NULL == _packetDeques);
+
+	uintptr_t dequeCount = _extensions->gcThreadCount;
+	_packetDeques = (MM_WorkPacketDeque *)env->getForge()->allocate(sizeof(MM_WorkPacketDeque) * dequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _packetDeques) {
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < dequeCount; i++) {
+		new(&_packetDeques[i]) MM_WorkPacketDeque();
+		_packetDeques[i].reset(i + 1);
+	}
+	_packetDequeCount = dequeCount;
+	_dequedPacketCount = 0;
+
+	return true;
+}
+
 void
 MM_WorkPackets::reset(MM_EnvironmentBase *env)
 {
 	_overflowHandler->reset(env);
+
+	if (NULL != _packetDeques) {
+		/* all deques are flushed at the end of every task */
+		Assert_MM_true(0 == _dequedPacketCount);
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			_packetDeques[i].reset(i + 1);
+		}
+	}
 }
 
 /**
@@ -263,6 +302,14 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
 	MM_Packet *packet;
 	
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		while (NULL != (packet = _packetDeques[i].steal())) {
+			MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+			packet->resetData(env);
+			putPacket(env, packet);
+		}
+	}
+
 	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
 		putPacket(env, packet);
@@ -332,6 +379,7 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
+				|| (0 != _dequedPacketCount)
 				|| (!_overflowHandler->isEmpty()));
 				
 	return res;
@@ -386,6 +434,14 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet;
 
+	/* Work pushed by this thread is preferred as it needs no synchronization with other threads */
+	if (NULL != (packet = getPacketFromDeque(env))) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		return packet;
+	}
+
 	if (!inputPacketAvailable(env)) {
 		return NULL;
 	}
@@ -404,6 +460,10 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 		}
 	}
 
+	if(NULL == packet) {
+		packet = stealPacket(env);
+	}
+
 	if(NULL == packet) {
 		packet = getInputPacketFromOverflow(env);
 	}
@@ -762,7 +822,98 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-	putPacket(env, packet);
+	if (!putPacketToDeque(env, packet)) {
+		putPacket(env, packet);
+	}
+}
+
+bool
+MM_WorkPackets::isPacketDequeAvailable(MM_EnvironmentBase *env)
+{
+	/* Deques are only owned by threads participating in a task, where worker IDs are unique */
+	return (NULL != _packetDeques) && (NULL != env->_currentTask) && (env->getWorkerID() < _packetDequeCount);
+}
+
+bool
+MM_WorkPackets::putPacketToDeque(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	if (packet->isEmpty() || !isPacketDequeAvailable(env)) {
+		return false;
+	}
+
+	/* Count the packet before it becomes visible to thieves so the count never underflows */
+	uintptr_t dequedPacketCount = MM_AtomicOperations::add(&_dequedPacketCount, 1);
+	packet->resetOwner();
+	if (!_packetDeques[env->getWorkerID()].pushBottom(packet)) {
+		/* Deque is full - caller will use the shared lists */
+		packet->setOwner(env);
+		MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+		return false;
+	}
+
+	if ((1 == dequedPacketCount) && (_inputListWaitCount > 0)) {
+		notifyWaitingThreads(env);
+	}
+
+	return true;
+}
+
+MM_Packet *
+MM_WorkPackets::getPacketFromDeque(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+
+	if (isPacketDequeAvailable(env)) {
+		packet = _packetDeques[env->getWorkerID()].popBottom();
+		if (NULL != packet) {
+			MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+			packet->setOwner(env);
+		}
+	}
+
+	return packet;
+}
+
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+
+	if ((NULL != _packetDeques) && (0 != _dequedPacketCount)) {
+		uintptr_t victim = env->getWorkerID() % _packetDequeCount;
+		if (isPacketDequeAvailable(env)) {
+			victim = _packetDeques[env->getWorkerID()].nextVictim(_packetDequeCount);
+		}
+
+		/* Start from a random victim and visit every deque once so that a packet is found if one is available */
+		for (uintptr_t i = 0; (i < _packetDequeCount) && (NULL == packet); i++) {
+			packet = _packetDeques[victim].steal();
+			victim += 1;
+			if (victim == _packetDequeCount) {
+				victim = 0;
+			}
+		}
+
+		if (NULL != packet) {
+			MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+			packet->setOwner(env);
+		}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.addStealAttempt(NULL != packet);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+
+	return packet;
+}
+
+void
+MM_WorkPackets::flushPacketDeque(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+
+	while (NULL != (packet = getPacketFromDeque(env))) {
+		putPacket(env, packet);
+	}
 }
 
 /**
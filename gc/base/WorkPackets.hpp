@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -37,6 +37,7 @@
 #include "BaseVirtual.hpp"
 #include "Packet.hpp"
 #include "PacketList.hpp"
+#include "WorkPacketDeque.hpp"
 #include "WorkPacketOverflow.hpp"
 
 class MM_EnvironmentBase;
@@ -89,6 +90,10 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_WorkPacketDeque *_packetDeques; /**< Per-thread work-stealing deques, indexed by worker ID (NULL if work stealing is disabled) */
+	uintptr_t _packetDequeCount; /**< Number of entries in _packetDeques */
+	volatile uintptr_t _dequedPacketCount; /**< Number of packets currently held in all deques */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
@@ -96,6 +101,35 @@ protected:
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
+	/**
+	 * Determine whether the given thread owns a work-stealing deque for the current task.
+	 * @param env[in] the current thread
+	 * @return true if packets can be pushed to and popped from the thread's deque
+	 */
+	bool isPacketDequeAvailable(MM_EnvironmentBase *env);
+
+	/**
+	 * Push a packet to the current thread's deque rather than to the shared lists.
+	 * @param env[in] the current thread
+	 * @param packet[in] the packet to push
+	 * @return true if the packet was pushed, false if the caller must put it on the shared lists
+	 */
+	bool putPacketToDeque(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Pop the most recently pushed packet from the current thread's deque.
+	 * @param env[in] the current thread
+	 * @return a packet, or NULL if the deque is empty or not available
+	 */
+	MM_Packet *getPacketFromDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Steal a packet from another thread's deque, starting from a randomly selected victim.
+	 * @param env[in] the current thread
+	 * @return a packet, or NULL if no packet could be stolen
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env);
+
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	
@@ -111,6 +145,21 @@ public:
 	void reuseDeferredPackets(MM_EnvironmentBase *env);
 
 	static uintptr_t getSlotsInPacket() { return _slotsInPacket; }
+
+	/**
+	 * Allocate a work-stealing deque for every GC thread. Once this succeeds full output packets are kept
+	 * in the producing thread's deque and idle threads steal from other deques before waiting on the shared lists.
+	 * @param env[in] the current thread
+	 * @return true on success, false on allocation failure
+	 */
+	bool initializePacketDeques(MM_EnvironmentBase *env);
+
+	/**
+	 * Return any packets left in the current thread's deque to the shared lists.
+	 * @param env[in] the current thread
+	 */
+	void flushPacketDeque(MM_EnvironmentBase *env);
+
 	MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
 	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
@@ -216,6 +265,11 @@ public:
 	 */
 	bool handleWorkPacketOverflow(MM_EnvironmentBase *env);
 
+	/**
+	 * Returns true if work stealing deques are in use.
+	 */
+	MMINLINE bool isPacketStealingEnabled() { return NULL != _packetDeques; }
+
 	/**
 	 * Create a WorkPackets object.
 	 */
@@ -235,7 +289,10 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_packetDeques(NULL),
+		_packetDequeCount(0),
+		_dequedPacketCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
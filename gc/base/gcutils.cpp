@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -87,6 +87,8 @@ getCompactionReasonAsString(CompactReason reason)
 			return "page granularity fragmentation";	
 		case COMPACT_MICRO_FRAG:
 			return "micro fragmentation";	
+		case COMPACT_INCREMENTAL:
+			return "continue incremental compaction";
 		default:
 			return "unknown";
 	}
@@ -190,6 +192,8 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case SCAV_PAUSE_ABOVE_TARGET:
+		return "scavenge pause above target";
 	default:
 		return "unknown";
 	}
@@ -217,6 +221,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case SCAV_PAUSE_BELOW_TARGET:
+		return "scavenge pause below target";
 	default:
 		return "unknown";
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -287,35 +287,88 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 			}
 		}
 
-		smallAllocationLock();
-
-		/* Either we did not have a region or we failed to preAllocate from the ACL. Retry if this is no
-		 * longer true */
-		region = _smallRegions[sizeClass];
-		if ((NULL == region) || !region->getMemoryPoolACL()->hasCell()) {
+		if (!refreshSmallRegion(env, sizeClass, &sweepCount, &sweepStartTime)) {
+			/* Really out of regions */
+			done = true;
+		}
+	}
+	return result;
 
-			/* This may cause the start of a GC */
-			signalSmallRegionDepleted(env, sizeClass);
+}
 
-			flushSmall(env, sizeClass);
+/*
+ * Pre allocate several runs of cells from the current region of the size class, holding the region lock once.
+ * Used to fill allocation magazines, each run is premarked and walkable.
+ * @return the number of runs written to runBases and runSizes, 0 if out of regions
+ */
+uintptr_t
+MM_AllocationContextSegregated::preAllocateSmallRuns(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, uintptr_t replenishSize, uintptr_t **runBases, uintptr_t *runSizes, uintptr_t maxRuns)
+{
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	uintptr_t sizeClass = sizeClasses->getSizeClassSmall(sizeInBytesRequired);
+	uintptr_t sweepCount = 0;
+	uint64_t sweepStartTime = 0;
+	uintptr_t runCount = 0;
+	bool done = false;
 
-			/* Attempt to get a region of this size class which may already have some allocated cells */
-			if (!tryAllocateRegionFromSmallSizeClass(env, sizeClass)) {
-				/* Attempt to get a region by sweeping */
-				if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, &sweepCount, &sweepStartTime)) {
-					/* Attempt to get an unused region */
-					if (!tryAllocateFromRegionPool(env, sizeClass)) {
-						/* Really out of regions */
-						done = true;
+	while (!done) {
+		MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
+		if (NULL != region) {
+			runCount = region->getMemoryPoolACL()->preAllocateCellRuns(env, sizeClasses->getCellSize(sizeClass), replenishSize, runBases, runSizes, maxRuns);
+			if (0 != runCount) {
+				if (shouldPreMarkSmallCells(env)) {
+					for (uintptr_t i = 0; i < runCount; i++) {
+						_markingScheme->preMarkSmallCells(env, region, runBases[i], runSizes[i]);
 					}
 				}
+				done = true;
 			}
 		}
 
-		smallAllocationUnlock();
+		if (!done && !refreshSmallRegion(env, sizeClass, &sweepCount, &sweepStartTime)) {
+			/* Really out of regions */
+			done = true;
+		}
 	}
-	return result;
+	return runCount;
+}
+
+/*
+ * Install a new current region for the size class unless another thread already did.
+ * @return false if no region could be found
+ */
+bool
+MM_AllocationContextSegregated::refreshSmallRegion(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *sweepCount, uint64_t *sweepStartTime)
+{
+	bool result = true;
+
+	smallAllocationLock();
+
+	/* Either we did not have a region or we failed to preAllocate from the ACL. Retry if this is no
+	 * longer true */
+	MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
+	if ((NULL == region) || !region->getMemoryPoolACL()->hasCell()) {
+
+		/* This may cause the start of a GC */
+		signalSmallRegionDepleted(env, sizeClass);
 
+		flushSmall(env, sizeClass);
+
+		/* Attempt to get a region of this size class which may already have some allocated cells */
+		if (!tryAllocateRegionFromSmallSizeClass(env, sizeClass)) {
+			/* Attempt to get a region by sweeping */
+			if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, sweepCount, sweepStartTime)) {
+				/* Attempt to get an unused region */
+				if (!tryAllocateFromRegionPool(env, sizeClass)) {
+					result = false;
+				}
+			}
+		}
+	}
+
+	smallAllocationUnlock();
+
+	return result;
 }
 
 uintptr_t *
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -102,6 +102,7 @@ public:
 	}
 
 	uintptr_t *preAllocateSmall(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
+	uintptr_t preAllocateSmallRuns(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, uintptr_t replenishSize, uintptr_t **runBases, uintptr_t *runSizes, uintptr_t maxRuns);
 
 	virtual uintptr_t *allocateLarge(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
 
@@ -207,6 +208,7 @@ protected:
 	bool tryAllocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t sizeClass);
 
 private:
+	bool refreshSmallRegion(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *sweepCount, uint64_t *sweepStartTime);
 
 };
 
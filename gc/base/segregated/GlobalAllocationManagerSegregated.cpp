@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -26,6 +26,7 @@
 #include "AllocationContextSegregated.hpp"
 #include "EnvironmentBase.hpp"
 #include "RegionPoolSegregated.hpp"
+#include "SegregatedMagazineDepot.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #include "GlobalAllocationManagerSegregated.hpp"
@@ -72,12 +73,22 @@ MM_GlobalAllocationManagerSegregated::initialize(MM_EnvironmentBase *env, MM_Reg
 		result = initializeAllocationContexts(env, regionPool);
 	}
 
+	if (result && _extensions->segregatedAllocationMagazines) {
+		_magazineDepot = MM_SegregatedMagazineDepot::newInstance(env, 0);
+		result = (NULL != _magazineDepot);
+	}
+
 	return result;
 }
 
 void
 MM_GlobalAllocationManagerSegregated::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _magazineDepot) {
+		_magazineDepot->kill(env);
+		_magazineDepot = NULL;
+	}
+
 	if (NULL != _managedAllocationContexts) {
 		for (uintptr_t i = 0; i < _managedAllocationContextCount; i++) {
 			if (NULL != _managedAllocationContexts[i]) {
@@ -168,4 +179,12 @@ MM_GlobalAllocationManagerSegregated::flushCachedFullRegions(MM_EnvironmentBase
 	}
 }
 
+void
+MM_GlobalAllocationManagerSegregated::flushMagazineDepot(MM_EnvironmentBase *env)
+{
+	if (NULL != _magazineDepot) {
+		_magazineDepot->flush(env);
+	}
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -32,6 +32,7 @@
 class MM_AllocationContextSegregated;
 class MM_EnvironmentBase;
 class MM_RegionPoolSegregated;
+class MM_SegregatedMagazineDepot;
 class MM_SegregatedMarkingScheme;
 class MM_SweepSchemeSegregated;
 
@@ -42,6 +43,7 @@ class MM_GlobalAllocationManagerSegregated : public MM_GlobalAllocationManager
 	 */
 private:
 	MM_RegionPoolSegregated *_regionPool;
+	MM_SegregatedMagazineDepot *_magazineDepot; /**< Per NUMA node depots of full allocation magazines, NULL unless segregatedAllocationMagazines is set */
 protected:
 public:
 
@@ -55,6 +57,7 @@ protected:
 	MM_GlobalAllocationManagerSegregated(MM_EnvironmentBase *env)
 		: MM_GlobalAllocationManager(env)
 		, _regionPool(NULL)
+		, _magazineDepot(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -93,7 +96,13 @@ public:
 	 */
 	void flushCachedFullRegions(MM_EnvironmentBase *env);
 
+	/**
+	 * Drop the full magazines held by the depots, called when a collection starts
+	 */
+	void flushMagazineDepot(MM_EnvironmentBase *env);
+
 	MM_RegionPoolSegregated *getRegionPool() { return _regionPool; }
+	MM_SegregatedMagazineDepot *getMagazineDepot() { return _magazineDepot; }
 
 };
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -40,6 +40,14 @@ class MM_HeapRegionDescriptorSegregated : public MM_HeapRegionDescriptor
 	 * Data members
 	 */
 public:
+	/**
+	 * Sweep state of an in use region relative to the most recent mark, see getSweepState().
+	 */
+	enum SweepState {
+		SWEPT = 0, /**< the free cells of the region reflect the most recent mark */
+		UNSWEPT, /**< the region was marked but still holds the free cells of the previous cycle */
+		SWEEPING /**< the region is being swept by a GC, allocating or background thread */
+	};
 protected:
 	uintptr_t **_arrayletBackPointers;
 
@@ -51,6 +59,8 @@ private:
 	MM_HeapRegionManager *_regionManager;
 	OMR_SizeClasses *_segregatedSizeClasses;
 	uintptr_t _nextArrayletIndex; /**< next arraylet to use for allocation */
+	volatile uintptr_t _sweepEpoch; /**< sweep epoch of the region pool when the region was last swept or handed out free */
+	volatile bool _sweeping; /**< true while a thread sweeps the region */
 	
 	/*
 	 * Function members
@@ -65,6 +75,8 @@ public:
 		,_regionManager(NULL)
 		,_segregatedSizeClasses(env->getOmrVM()->_sizeClasses)
 		,_nextArrayletIndex(0)
+		,_sweepEpoch(0)
+		,_sweeping(false)
 	{
 		_arrayletBackPointers = ((uintptr_t **)(this + 1));
 		_typeId = __FUNCTION__;
@@ -132,6 +144,21 @@ public:
 	void addBytesFreedToArrayletBackout(MM_EnvironmentBase* env);
 	void addBytesFreedToSmallSpineBackout(MM_EnvironmentBase* env);
 
+	/**
+	 * @param sweepEpoch the current sweep epoch of the region pool, which advances each time the in use
+	 * regions are queued for sweeping after a mark
+	 */
+	MMINLINE SweepState
+	getSweepState(uintptr_t sweepEpoch)
+	{
+		if (_sweeping) {
+			return SWEEPING;
+		}
+		return (sweepEpoch == _sweepEpoch) ? SWEPT : UNSWEPT;
+	}
+	MMINLINE void setSweeping() { _sweeping = true; }
+	MMINLINE void setSwept(uintptr_t sweepEpoch) { _sweepEpoch = sweepEpoch; _sweeping = false; }
+
 	void setLarge(uintptr_t range) { setRange(SEGREGATED_LARGE, range); }
 	void setSmall(uintptr_t sizeClass);
 	void setFree(uintptr_t range);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -93,6 +93,71 @@ MM_MemoryPoolAggregatedCellList::preAllocateCells(MM_EnvironmentBase* env, uintp
 	return allocatedCellList;
 }
 
+/**
+ * Pre allocates several runs of cells within the region while holding the region lock once.
+ * Each run is made walkable so it can be held outside of an allocation cache.
+ * @param desiredBytes the desired amount of bytes in each run
+ * @param runBases where the first cell of each run will be written to
+ * @param runSizes where the amount of bytes of each run will be written to
+ * @param maxRuns the capacity of runBases and runSizes
+ * @return the number of runs pre-allocated, 0 if the region has no free cells left
+ */
+uintptr_t
+MM_MemoryPoolAggregatedCellList::preAllocateCellRuns(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t **runBases, uintptr_t *runSizes, uintptr_t maxRuns)
+{
+	uintptr_t desiredCellCount = desiredBytes / cellSize;
+	uintptr_t adjustedDesiredBytes = desiredBytes;
+	uintptr_t preAllocatedBytes = 0;
+	uintptr_t runCount = 0;
+	bool const compressed = compressObjectReferences();
+
+	if (0 == desiredCellCount) {
+		desiredCellCount = 1;
+		adjustedDesiredBytes = cellSize;
+	}
+
+	_lock.acquire();
+
+	while (runCount < maxRuns) {
+		if (_heapCurrent == _heapTop) {
+			/* The current chunk is empty, get the next one */
+			refreshCurrentEntry();
+			if (NULL == _heapCurrent) {
+				break;
+			}
+		}
+
+		uintptr_t *run = _heapCurrent;
+		uintptr_t runSize = 0;
+		if ((uintptr_t)_heapTop - (uintptr_t)_heapCurrent > adjustedDesiredBytes) {
+			/* Carve off the desired part */
+			runSize = desiredCellCount * cellSize;
+			_heapCurrent = (uintptr_t *)((uintptr_t)_heapCurrent + runSize);
+		} else {
+			/* Take the whole free chunk */
+			runSize = (uintptr_t)_heapTop - (uintptr_t)_heapCurrent;
+			refreshCurrentEntry();
+		}
+		MM_HeapLinkedFreeHeader::fillWithHoles(run, runSize, compressed);
+		runBases[runCount] = run;
+		runSizes[runCount] = runSize;
+		preAllocatedBytes += runSize;
+		runCount += 1;
+	}
+
+	if (_heapCurrent < _heapTop) {
+		/* Make the remainder walkable */
+		MM_HeapLinkedFreeHeader::fillWithHoles(_heapCurrent, (uintptr_t)_heapTop - (uintptr_t)_heapCurrent, compressed);
+	}
+
+	if (0 != preAllocatedBytes) {
+		addBytesAllocated(env, preAllocatedBytes);
+	}
+	_lock.release();
+
+	return runCount;
+}
+
 /**
  * @todo Provide function documentation
  */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -122,6 +122,7 @@ public:
 	void returnCell(MM_EnvironmentBase *env, uintptr_t *cell);
 	MMINLINE bool hasCell() { return (_freeListHead != NULL) || (_heapCurrent < _heapTop); }
 	uintptr_t* preAllocateCells(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t* preAllocatedBytesOutput);
+	uintptr_t preAllocateCellRuns(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t **runBases, uintptr_t *runSizes, uintptr_t maxRuns);
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	uintptr_t debugCountFreeBytes();
 	
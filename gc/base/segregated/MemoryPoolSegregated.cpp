@@ -109,6 +109,12 @@ MM_MemoryPoolSegregated::flushCachedFullRegions(MM_EnvironmentBase *env)
 	_globalAllocationManager->flushCachedFullRegions(env);
 }
 
+void
+MM_MemoryPoolSegregated::flushMagazineDepot(MM_EnvironmentBase *env)
+{
+	_globalAllocationManager->flushMagazineDepot(env);
+}
+
 void
 MM_MemoryPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 {
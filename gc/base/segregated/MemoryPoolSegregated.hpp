@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -108,6 +108,7 @@ public:
 
 	void moveInUseToSweep(MM_EnvironmentBase *env);
 	void flushCachedFullRegions(MM_EnvironmentBase *env);
+	void flushMagazineDepot(MM_EnvironmentBase *env);
 	
 	uintptr_t getUsedAndLiveObjectsSize(MM_EnvironmentBase *env, bool unmark_objects, bool unmark_live_alloc, 
 	uintptr_t *allocGarbage, uintptr_t *live, uintptr_t *allocLive);
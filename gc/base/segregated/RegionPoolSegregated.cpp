@@ -78,6 +78,8 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 		}
 		_smallFullRegions[szClass] = NULL;
 		_smallSweepRegions[szClass] = NULL;
+		_initialCountOfSweepRegions[szClass] = 0;
+		_currentCountOfSweepRegions[szClass] = 0;
 	}
 
 	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
@@ -216,6 +218,8 @@ MM_RegionPoolSegregated::addSingleFree(MM_EnvironmentBase *env, MM_HeapRegionQue
 void
 MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 {
+	/* every in use region is unswept from now on until sweepRegion() stamps it with the new epoch */
+	_sweepEpoch += 1;
 	_currentTotalCountOfSweepRegions = 0;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_darkMatterCellCount[sizeClass] = 0;
@@ -316,6 +320,7 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 		 * in the case of large region allocation.
 		 */
 		region->emptyRegionAllocated(env);
+		region->setSwept(_sweepEpoch);
 	}
 	
 	return region;
@@ -417,6 +422,33 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::sweepAndReleaseRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass)
+{
+	MM_HeapRegionDescriptorSegregated *region = _smallSweepRegions[sizeClass]->dequeue();
+
+	if (region != NULL) {
+		_sweepScheme->sweepRegion(env, region);
+		decrementCurrentCountOfSweepRegions(sizeClass, 1);
+		decrementCurrentTotalCountOfSweepRegions(1);
+
+		MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+		uintptr_t numCells = region->getNumCells();
+		if (memoryPoolACL->getFreeCount() < numCells) {
+			uintptr_t occupancy = (memoryPoolACL->getMarkCount() * 100) / numCells;
+			if (memoryPoolACL->getMarkCount() == numCells) {
+				_smallFullRegions[sizeClass]->enqueue(region);
+			} else {
+				enqueueAvailable(region, sizeClass, occupancy, env->getEnvironmentId() % _splitAvailableListSplitCount);
+			}
+		} else {
+			region->emptyRegionReturned(env);
+			addFreeRegion(env, region);
+		}
+	}
+	return (region != NULL);
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -136,6 +136,7 @@ private:
 	volatile uintptr_t _currentTotalCountOfSweepRegions;
 	
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
+	volatile uintptr_t _sweepEpoch; /**< advanced each time the in use regions are queued for sweeping, see MM_HeapRegionDescriptorSegregated::getSweepState() */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
 	uint8_t _skipAvailableRegionForAllocation[OMR_SIZECLASSES_NUM_SMALL+1]; /* per size class flag to indicate if there is any available regions left for allocation for that size class */
 
@@ -174,6 +175,13 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Sweep one region of the given size class left unswept by a lazy sweep and return it to the
+	 * available, full or free lists as the GC sweep would.
+	 * @return true if a region was swept
+	 */
+	bool sweepAndReleaseRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -238,6 +246,14 @@ public:
 	MMINLINE uintptr_t getSplitAvailableListSplitCount() { return _splitAvailableListSplitCount; }
 
 	void setSweepSmallPages(bool sweepSmall) { _isSweepingSmall = sweepSmall; }
+
+	MMINLINE uintptr_t getSweepEpoch() { return _sweepEpoch; }
+	MMINLINE MM_HeapRegionDescriptorSegregated::SweepState getSweepState(MM_HeapRegionDescriptorSegregated *region) { return region->getSweepState(_sweepEpoch); }
+
+	/**
+	 * @return true if small regions queued for sweeping by the last mark are still waiting for a lazy sweep
+	 */
+	MMINLINE bool hasUnsweptSmallRegions() { return 0 != _currentTotalCountOfSweepRegions; }
 	void resetSkipAvailableRegionForAllocation() { memset(&_skipAvailableRegionForAllocation[0], 0, sizeof(_skipAvailableRegionForAllocation)); }
 
 	void updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy);
@@ -276,7 +292,10 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _initialTotalCountOfSweepRegions(0)
+		, _currentTotalCountOfSweepRegions(0)
 		, _isSweepingSmall(false)
+		, _sweepEpoch(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,6 +34,7 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
 
 #include "SegregatedAllocationInterface.hpp"
@@ -157,10 +158,7 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		if (memorySpace == env->getExtensions()->heap->getDefaultMemorySpace() && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
 			cell = allocateFromCache(env, sizeInBytes);
 			if (NULL == cell) {
-				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
-				if (ac != NULL) {
-					cell = ac->preAllocateSmall(env, sizeInBytes);
-				}
+				cell = replenishAndAllocate(env, sizeInBytes);
 			}
 		}
 		
@@ -175,10 +173,7 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		} else if (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) {
 			cell = allocateFromCache(env, sizeInBytes);
 			if (NULL == cell) {
-				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
-				if (ac != NULL) {
-					cell = ac->preAllocateSmall(env, sizeInBytes);
-				}
+				cell = replenishAndAllocate(env, sizeInBytes);
 			}
 		}
 	}
@@ -191,6 +186,83 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 	return cell;
 }
 
+/**
+ * Replenish the cache of the size class of sizeInBytes, which must be empty, and allocate a cell from it.
+ * @return The allocated cell or NULL if the allocation context is out of regions.
+ */
+void*
+MM_SegregatedAllocationInterface::replenishAndAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytes)
+{
+	void *cell = NULL;
+	MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
+	if (ac != NULL) {
+		if (_cachedAllocationsEnabled && env->getExtensions()->segregatedAllocationMagazines) {
+			cell = replenishFromMagazine(env, ac, sizeInBytes);
+		} else {
+			cell = ac->preAllocateSmall(env, sizeInBytes);
+		}
+	}
+	return cell;
+}
+
+/**
+ * Replenish the cache from the thread's magazine for the size class. An empty magazine is swapped for
+ * a full one from the depot of the thread's NUMA node, and only when the depot is dry as well are
+ * new runs carved from the allocation context.
+ * @return The allocated cell or NULL if the allocation context is out of regions.
+ */
+void*
+MM_SegregatedAllocationInterface::replenishFromMagazine(MM_EnvironmentBase *env, MM_AllocationContextSegregated *ac, uintptr_t sizeInBytes)
+{
+	MM_SegregatedMagazine *magazine = &_magazines[_sizeClasses->getSizeClass(sizeInBytes)];
+	void *cell = NULL;
+
+	if (magazine->isEmpty()) {
+		MM_SegregatedMagazineDepot *depot = ((MM_GlobalAllocationManagerSegregated *)env->getExtensions()->globalAllocationManager)->getMagazineDepot();
+		refillMagazine(env, ac, depot, sizeInBytes);
+	}
+
+	if (!magazine->isEmpty()) {
+		uintptr_t runSize = 0;
+		uintptr_t *run = magazine->pop(&runSize);
+		replenishCache(env, sizeInBytes, run, runSize);
+		cell = allocateFromCache(env, sizeInBytes);
+	}
+	return cell;
+}
+
+/**
+ * Fill the empty magazine of the size class of sizeInBytes, from the depot if possible. Otherwise runs are
+ * batch allocated from the allocation context, with a second magazine worth left in the depot if it has room.
+ */
+void
+MM_SegregatedAllocationInterface::refillMagazine(MM_EnvironmentBase *env, MM_AllocationContextSegregated *ac, MM_SegregatedMagazineDepot *depot, uintptr_t sizeInBytes)
+{
+	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+	MM_SegregatedMagazine *magazine = &_magazines[sizeClass];
+	uintptr_t node = depot->getNode(env);
+
+	if (!depot->popMagazine(node, sizeClass, magazine)) {
+		uintptr_t *runBases[2 * SEGREGATED_MAGAZINE_CAPACITY];
+		uintptr_t runSizes[2 * SEGREGATED_MAGAZINE_CAPACITY];
+		uintptr_t maxRuns = depot->wantsMagazine(node, sizeClass) ? (2 * SEGREGATED_MAGAZINE_CAPACITY) : SEGREGATED_MAGAZINE_CAPACITY;
+		uintptr_t runCount = ac->preAllocateSmallRuns(env, sizeInBytes, getReplenishSize(env, sizeInBytes), runBases, runSizes, maxRuns);
+
+		uintptr_t run = 0;
+		for (; (run < runCount) && !magazine->isFull(); run++) {
+			magazine->push(runBases[run], runSizes[run]);
+		}
+		if (run < runCount) {
+			MM_SegregatedMagazine surplus;
+			for (; run < runCount; run++) {
+				surplus.push(runBases[run], runSizes[run]);
+			}
+			/* Another thread may have filled the depot meanwhile, the surplus is then left to the next sweep */
+			depot->pushMagazine(node, sizeClass, &surplus);
+		}
+	}
+}
+
 void*
 MM_SegregatedAllocationInterface::allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
@@ -262,6 +334,10 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 		}
 	}
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
+	/* the runs left in the magazines are already walkable, they are reclaimed by the next sweep */
+	for (uintptr_t sizeClass = 0; sizeClass < OMR_SIZECLASSES_NUM_SMALL+1; sizeClass++) {
+		_magazines[sizeClass].clear();
+	}
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -29,9 +29,11 @@
 #include "LanguageSegregatedAllocationCache.hpp"
 
 #include "ObjectAllocationInterface.hpp"
+#include "SegregatedMagazineDepot.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+class MM_AllocationContextSegregated;
 class MM_SizeClasses;
 
 typedef struct SegregatedAllocationCacheStats {
@@ -58,6 +60,7 @@ private:
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
+	MM_SegregatedMagazine _magazines[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< Pre-allocated runs used to replenish the cache when segregatedAllocationMagazines is set (per size class). */
 
 	/*
 	 * Function members
@@ -110,6 +113,9 @@ protected:
 	
 private:
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env, uintptr_t sizeClass);
+	void *replenishAndAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytes);
+	void *replenishFromMagazine(MM_EnvironmentBase *env, MM_AllocationContextSegregated *ac, uintptr_t sizeInBytes);
+	void refillMagazine(MM_EnvironmentBase *env, MM_AllocationContextSegregated *ac, MM_SegregatedMagazineDepot *depot, uintptr_t sizeInBytes);
 	
 };
 
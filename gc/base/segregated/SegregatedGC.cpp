@@ -20,6 +20,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "omr.h"
+#include "omrutil.h"
+
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
@@ -30,6 +33,7 @@
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
@@ -48,6 +52,41 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+typedef struct LazySweepThreadInfo {
+	OMR_VM *omrVM;
+	uintptr_t threadFlags;
+	MM_SegregatedGC *collector;
+} LazySweepThreadInfo;
+
+#define LAZY_SWEEP_INFO_FLAG_OK 1
+
+extern "C" {
+
+/**
+ * Background sweep thread procedure
+ *
+ * @parm info Address of LazySweepThreadInfo structure
+ */
+static int J9THREAD_PROC
+lazy_sweep_thread_proc(void *info)
+{
+	LazySweepThreadInfo *lazySweepThreadInfo = (LazySweepThreadInfo *)info;
+	MM_SegregatedGC *collector = lazySweepThreadInfo->collector;
+	OMR_VM *omrVM = lazySweepThreadInfo->omrVM;
+
+	/* Signal that the background sweep thread has started */
+	omrthread_monitor_enter(collector->_lazySweepMonitor);
+	lazySweepThreadInfo->threadFlags = LAZY_SWEEP_INFO_FLAG_OK;
+	omrthread_monitor_notify_all(collector->_lazySweepMonitor);
+	omrthread_monitor_exit(collector->_lazySweepMonitor);
+
+	collector->lazySweepThreadEntryPoint(omrVM);
+
+	return 0;
+}
+
+} /* extern "C" */
+
 /**
  * Initialization
  */
@@ -129,12 +168,159 @@ MM_SegregatedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *sub
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
-	return true;
+	bool result = true;
+	if (extensions->segregatedLazySweep && (0 < extensions->segregatedLazySweepThreads)) {
+		result = initializeLazySweepThreads(extensions);
+	}
+	return result;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	shutdownLazySweepThreads(extensions);
+}
+
+/**
+ * Attach the background sweep threads, at minimum priority so they only use the spare cycles
+ * left by the mutators.
+ * @return true if every thread requested was started
+ */
+bool
+MM_SegregatedGC::initializeLazySweepThreads(MM_GCExtensionsBase *extensions)
+{
+	if (0 != omrthread_monitor_init_with_name(&_lazySweepMonitor, 0, "MM_SegregatedGC::lazySweep")) {
+		return false;
+	}
+
+	LazySweepThreadInfo lazySweepThreadInfo;
+	lazySweepThreadInfo.omrVM = extensions->getOmrVM();
+	lazySweepThreadInfo.collector = this;
+
+	omrthread_monitor_enter(_lazySweepMonitor);
+	_lazySweepRequest = LAZY_SWEEP_WAIT;
+	uintptr_t threadCount = 0;
+	for (; threadCount < extensions->segregatedLazySweepThreads; threadCount++) {
+		omrthread_t thread = NULL;
+		lazySweepThreadInfo.threadFlags = 0;
+		if (0 != createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN, 0,
+				lazy_sweep_thread_proc, (void *)&lazySweepThreadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+			break;
+		}
+
+		do {
+			omrthread_monitor_wait(_lazySweepMonitor);
+		} while (0 == lazySweepThreadInfo.threadFlags);
+
+		if (LAZY_SWEEP_INFO_FLAG_OK != lazySweepThreadInfo.threadFlags) {
+			break;
+		}
+	}
+	_lazySweepThreadsStarted = threadCount;
+	omrthread_monitor_exit(_lazySweepMonitor);
+
+	return (threadCount == extensions->segregatedLazySweepThreads);
+}
+
+/**
+ * Ask all background sweep threads to terminate and wait for them to do so.
+ */
+void
+MM_SegregatedGC::shutdownLazySweepThreads(MM_GCExtensionsBase *extensions)
+{
+	if (NULL != _lazySweepMonitor) {
+		omrthread_monitor_enter(_lazySweepMonitor);
+		_lazySweepRequest = LAZY_SWEEP_SHUTDOWN;
+		omrthread_monitor_notify_all(_lazySweepMonitor);
+		while (_lazySweepThreadsShutdownCount < _lazySweepThreadsStarted) {
+			omrthread_monitor_wait(_lazySweepMonitor);
+		}
+		omrthread_monitor_exit(_lazySweepMonitor);
+
+		omrthread_monitor_destroy(_lazySweepMonitor);
+		_lazySweepMonitor = NULL;
+	}
+}
+
+void
+MM_SegregatedGC::lazySweepThreadEntryPoint(OMR_VM *omrVM)
+{
+	OMR_VMThread *omrThread = NULL;
+	MM_EnvironmentBase *env = NULL;
+	MM_RegionPoolSegregated *regionPool = NULL;
+	LazySweepRequest request = LAZY_SWEEP_WAIT;
+
+	while (LAZY_SWEEP_SHUTDOWN != request) {
+		omrthread_monitor_enter(_lazySweepMonitor);
+		while (LAZY_SWEEP_WAIT == (request = _lazySweepRequest)) {
+			omrthread_monitor_wait(_lazySweepMonitor);
+		}
+		omrthread_monitor_exit(_lazySweepMonitor);
+
+		if (LAZY_SWEEP_SHUTDOWN == request) {
+			continue;
+		}
+
+		/* The threads are started with the collector, before the memory pool and allocation contexts an
+		 * environment needs exist, so each one attaches when it is first asked to sweep.
+		 */
+		if (NULL == omrThread) {
+			omrThread = MM_EnvironmentBase::attachVMThread(omrVM, "Lazy Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+			if (NULL == omrThread) {
+				break;
+			}
+			env = MM_EnvironmentBase::getEnvironment(omrThread);
+			regionPool = ((MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool();
+		}
+
+		/* A GC waits for VM access to be released, so no region is left half swept when it completes the sweep */
+		env->acquireVMAccess();
+		bool swept = true;
+		while (swept && regionPool->hasUnsweptSmallRegions() && !env->isExclusiveAccessRequestWaiting()) {
+			swept = false;
+			for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+				swept = regionPool->sweepAndReleaseRegionFromSmallSizeClass(env, sizeClass) || swept;
+			}
+		}
+		if (!swept || !regionPool->hasUnsweptSmallRegions()) {
+			/* nothing left to sweep, wait for the next lazy sweep */
+			omrthread_monitor_enter(_lazySweepMonitor);
+			if (LAZY_SWEEP_RUN == _lazySweepRequest) {
+				_lazySweepRequest = LAZY_SWEEP_WAIT;
+			}
+			omrthread_monitor_exit(_lazySweepMonitor);
+		}
+		env->releaseVMAccess();
+	}
+
+	if (NULL != omrThread) {
+		MM_EnvironmentBase::detachVMThread(omrVM, omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	}
+	omrthread_monitor_enter(_lazySweepMonitor);
+	_lazySweepThreadsShutdownCount += 1;
+	omrthread_monitor_notify_all(_lazySweepMonitor);
+	omrthread_exit(_lazySweepMonitor);
+}
+
+/**
+ * Sweep the small regions the previous lazy sweep left unswept, before marking resets the mark map.
+ * Background sweep threads do not hold VM access while the collection has exclusive access.
+ */
+void
+MM_SegregatedGC::completeLazySweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	if (NULL != _lazySweepMonitor) {
+		omrthread_monitor_enter(_lazySweepMonitor);
+		if (LAZY_SWEEP_RUN == _lazySweepRequest) {
+			_lazySweepRequest = LAZY_SWEEP_WAIT;
+		}
+		omrthread_monitor_exit(_lazySweepMonitor);
+	}
+
+	if (memoryPool->getRegionPool()->hasUnsweptSmallRegions()) {
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool, true);
+		_dispatcher->run(env, &sweepTask);
+	}
 }
 
 void *
@@ -244,6 +430,14 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
 	}
 
+	/* Hand the small regions left unswept by a lazy sweep to the background sweep threads */
+	if ((NULL != _lazySweepMonitor) && ((MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool()->hasUnsweptSmallRegions()) {
+		omrthread_monitor_enter(_lazySweepMonitor);
+		_lazySweepRequest = LAZY_SWEEP_RUN;
+		omrthread_monitor_notify_all(_lazySweepMonitor);
+		omrthread_monitor_exit(_lazySweepMonitor);
+	}
+
 	return true;
 }
 
@@ -271,8 +465,14 @@ MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 
 	/* OMRTODO we should check if we should fix the heap for walk here */
 
+	if (_extensions->segregatedLazySweep) {
+		completeLazySweep(env, memoryPool);
+	}
+
 	/* Flush the caches for gc */
 	GC_OMRVMInterface::flushCachesForGC(env);
+	/* Magazines left in the depots hold cells premarked for the previous cycle */
+	memoryPool->flushMagazineDepot(env);
 
 	reportGCCycleStart(env);
 	reportGCStart(env);
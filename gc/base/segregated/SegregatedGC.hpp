@@ -23,6 +23,8 @@
 #if !defined(SEGREGATEDGC_HPP_)
 #define SEGREGATEDGC_HPP_
 
+#include "omrthread.h"
+
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 
@@ -49,7 +51,17 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 private:
+	typedef enum {
+		LAZY_SWEEP_WAIT = 0, /**< no small regions left to sweep in the background */
+		LAZY_SWEEP_RUN, /**< a lazy sweep left small regions unswept */
+		LAZY_SWEEP_SHUTDOWN /**< background sweep threads must exit */
+	} LazySweepRequest;
+
+	uintptr_t _lazySweepThreadsStarted; /**< Number of background sweep threads attached */
+	uintptr_t _lazySweepThreadsShutdownCount; /**< Number of background sweep threads which have exited */
+	volatile LazySweepRequest _lazySweepRequest;
 public:
+	omrthread_monitor_t _lazySweepMonitor; /**< Protects the lazy sweep request and wakes the background sweep threads */
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
 	uintptr_t _scanBytes;
 	uintptr_t _objectsMarked;
@@ -73,6 +85,10 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	bool initializeLazySweepThreads(MM_GCExtensionsBase *extensions);
+	void shutdownLazySweepThreads(MM_GCExtensionsBase *extensions);
+	void completeLazySweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -97,6 +113,12 @@ public:
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
 	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
 
+	/**
+	 * Main loop of a background sweep thread: while a lazy sweep left small regions unswept, sweep them
+	 * one at a time with VM access, backing off whenever exclusive access is requested.
+	 */
+	void lazySweepThreadEntryPoint(OMR_VM *omrVM);
+
 	virtual bool isMarked(void *objectPtr) { return _markingScheme->isMarked(static_cast<omrobjectptr_t>(objectPtr)); }
 
 	/**
@@ -119,6 +141,10 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _lazySweepThreadsStarted(0)
+		, _lazySweepThreadsShutdownCount(0)
+		, _lazySweepRequest(LAZY_SWEEP_WAIT)
+		, _lazySweepMonitor(NULL)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "NUMAManager.hpp"
+
+#include "SegregatedMagazineDepot.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_SegregatedMagazineDepot *
+MM_SegregatedMagazineDepot::newInstance(MM_EnvironmentBase *env, uintptr_t nodeCount)
+{
+	if (0 == nodeCount) {
+		nodeCount = env->getExtensions()->_numaManager.getMaximumNodeNumber() + 1;
+	}
+
+	MM_SegregatedMagazineDepot *depot = (MM_SegregatedMagazineDepot *)env->getForge()->allocate(sizeof(MM_SegregatedMagazineDepot), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != depot) {
+		new(depot) MM_SegregatedMagazineDepot(nodeCount);
+		if (!depot->initialize(env)) {
+			depot->kill(env);
+			depot = NULL;
+		}
+	}
+	return depot;
+}
+
+void
+MM_SegregatedMagazineDepot::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_SegregatedMagazineDepot::initialize(MM_EnvironmentBase *env)
+{
+	uintptr_t depotCount = _nodeCount * (OMR_SIZECLASSES_NUM_SMALL + 1);
+	_depots = (Depot *)env->getForge()->allocate(sizeof(Depot) * depotCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _depots) {
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < depotCount; i++) {
+		new(&_depots[i]) Depot();
+		_depots[i].count = 0;
+	}
+	for (uintptr_t i = 0; i < depotCount; i++) {
+		if (!_depots[i].lock.initialize(env, &env->getExtensions()->lnrlOptions, "MM_SegregatedMagazineDepot:lock")) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_SegregatedMagazineDepot::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _depots) {
+		uintptr_t depotCount = _nodeCount * (OMR_SIZECLASSES_NUM_SMALL + 1);
+		for (uintptr_t i = 0; i < depotCount; i++) {
+			_depots[i].lock.tearDown();
+		}
+		env->getForge()->free(_depots);
+		_depots = NULL;
+	}
+}
+
+uintptr_t
+MM_SegregatedMagazineDepot::getNode(MM_EnvironmentBase *env)
+{
+	uintptr_t node = 0;
+	if (1 < _nodeCount) {
+		/* j9 node numbers start at 1, 0 means no affinity and shares the first depot */
+		node = env->getNumaAffinity();
+		if (node >= _nodeCount) {
+			node = 0;
+		}
+	}
+	return node;
+}
+
+bool
+MM_SegregatedMagazineDepot::popMagazine(uintptr_t node, uintptr_t sizeClass, MM_SegregatedMagazine *magazine)
+{
+	Depot *depot = getDepot(node, sizeClass);
+	bool result = false;
+
+	/* peek first so a dry depot does not cost a lock */
+	if (0 != depot->count) {
+		depot->lock.acquire();
+		if (0 != depot->count) {
+			depot->count -= 1;
+			*magazine = depot->magazines[depot->count];
+			result = true;
+		}
+		depot->lock.release();
+	}
+
+	return result;
+}
+
+bool
+MM_SegregatedMagazineDepot::pushMagazine(uintptr_t node, uintptr_t sizeClass, MM_SegregatedMagazine *magazine)
+{
+	Depot *depot = getDepot(node, sizeClass);
+	bool result = false;
+
+	depot->lock.acquire();
+	if (SEGREGATED_MAGAZINE_DEPOT_CAPACITY > depot->count) {
+		depot->magazines[depot->count] = *magazine;
+		depot->count += 1;
+		result = true;
+	}
+	depot->lock.release();
+
+	return result;
+}
+
+void
+MM_SegregatedMagazineDepot::flush(MM_EnvironmentBase *env)
+{
+	uintptr_t depotCount = _nodeCount * (OMR_SIZECLASSES_NUM_SMALL + 1);
+	for (uintptr_t i = 0; i < depotCount; i++) {
+		_depots[i].count = 0;
+	}
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
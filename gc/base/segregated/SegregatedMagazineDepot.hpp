@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDMAGAZINEDEPOT_HPP_)
+#define SEGREGATEDMAGAZINEDEPOT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "sizeclasses.h"
+
+#include "BaseVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#define SEGREGATED_MAGAZINE_CAPACITY 4 /**< Number of cell runs held by a single magazine */
+#define SEGREGATED_MAGAZINE_DEPOT_CAPACITY 4 /**< Number of full magazines a depot keeps per node and size class */
+
+class MM_EnvironmentBase;
+
+/**
+ * A fixed size stack of pre-allocated cell runs of a single size class. Every run held by a
+ * magazine has already been carved from its region, premarked and made walkable, so it can be
+ * handed to an allocation cache as is.
+ * @ingroup GC_Modron_Metronome
+ */
+class MM_SegregatedMagazine
+{
+private:
+	uintptr_t _count; /**< Number of runs currently held */
+	uintptr_t *_runBases[SEGREGATED_MAGAZINE_CAPACITY]; /**< First cell of each run */
+	uintptr_t _runSizes[SEGREGATED_MAGAZINE_CAPACITY]; /**< Size in bytes of each run */
+
+public:
+	MMINLINE bool isEmpty() { return 0 == _count; }
+	MMINLINE bool isFull() { return SEGREGATED_MAGAZINE_CAPACITY == _count; }
+	MMINLINE uintptr_t getCount() { return _count; }
+
+	/**
+	 * Add a run to the magazine, which must not be full.
+	 */
+	MMINLINE void
+	push(uintptr_t *runBase, uintptr_t runSize)
+	{
+		_runBases[_count] = runBase;
+		_runSizes[_count] = runSize;
+		_count += 1;
+	}
+
+	/**
+	 * Take the most recently added run from the magazine, which must not be empty.
+	 * @return the first cell of the run
+	 */
+	MMINLINE uintptr_t *
+	pop(uintptr_t *runSize)
+	{
+		_count -= 1;
+		*runSize = _runSizes[_count];
+		return _runBases[_count];
+	}
+
+	/**
+	 * Forget every run held. The runs are walkable holes and are reclaimed by the next sweep.
+	 */
+	MMINLINE void clear() { _count = 0; }
+
+	MM_SegregatedMagazine()
+		: _count(0)
+	{
+	}
+};
+
+/**
+ * Second level of the segregated small allocation path: a lock protected stack of full magazines
+ * per NUMA node and size class. A thread whose own magazine runs dry takes a full one from the
+ * depot of its node before falling back to the allocation context and the region pool, and the
+ * surplus of a batched refill is left in the depot for the other threads of the node.
+ * @ingroup GC_Modron_Metronome
+ */
+class MM_SegregatedMagazineDepot : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct Depot {
+		MM_LightweightNonReentrantLock lock; /**< Protects the magazines of the depot */
+		volatile uintptr_t count; /**< Number of full magazines held */
+		MM_SegregatedMagazine magazines[SEGREGATED_MAGAZINE_DEPOT_CAPACITY];
+	};
+
+	uintptr_t _nodeCount; /**< Number of NUMA nodes with a depot, node 0 is shared by threads without affinity */
+	Depot *_depots; /**< _nodeCount * (OMR_SIZECLASSES_NUM_SMALL + 1) depots, indexed by node then size class */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE Depot *getDepot(uintptr_t node, uintptr_t sizeClass) { return &_depots[(node * (OMR_SIZECLASSES_NUM_SMALL + 1)) + sizeClass]; }
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_SegregatedMagazineDepot(uintptr_t nodeCount)
+		: MM_BaseVirtual()
+		, _nodeCount(nodeCount)
+		, _depots(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+public:
+	/**
+	 * @param nodeCount number of depots per size class, 0 to create one for every NUMA node known to the GC
+	 */
+	static MM_SegregatedMagazineDepot *newInstance(MM_EnvironmentBase *env, uintptr_t nodeCount);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the node whose depots the thread of env should use
+	 */
+	uintptr_t getNode(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the depot for the node and size class has room for another full magazine.
+	 * @note the answer is racy and only meant to decide whether a refill should produce a surplus
+	 */
+	MMINLINE bool wantsMagazine(uintptr_t node, uintptr_t sizeClass) { return SEGREGATED_MAGAZINE_DEPOT_CAPACITY > getDepot(node, sizeClass)->count; }
+
+	/**
+	 * Copy a full magazine out of the depot.
+	 * @param[out] magazine the empty magazine of the caller, filled on success
+	 * @return true if a full magazine was available
+	 */
+	bool popMagazine(uintptr_t node, uintptr_t sizeClass, MM_SegregatedMagazine *magazine);
+
+	/**
+	 * Copy a full magazine into the depot.
+	 * @return false if the depot was already at capacity, in which case the caller still owns the runs
+	 */
+	bool pushMagazine(uintptr_t node, uintptr_t sizeClass, MM_SegregatedMagazine *magazine);
+
+	/**
+	 * Drop every magazine held by the depots. Must be called when a collection starts since cells
+	 * premarked for the previous cycle must not be allocated once marking state is reset.
+	 * @note assumes exclusive access
+	 */
+	void flush(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDMAGAZINEDEPOT_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -30,7 +30,11 @@
 void
 MM_SegregatedSweepTask::run(MM_EnvironmentBase *env)
 {
-	_sweepScheme->sweep(env, _memoryPool, false);
+	if (_completeLazySweep) {
+		_sweepScheme->completeSweep(env);
+	} else {
+		_sweepScheme->sweep(env, _memoryPool, false);
+	}
 }
 
 void
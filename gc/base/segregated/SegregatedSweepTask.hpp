@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -37,6 +37,7 @@ protected:
 private:
 	MM_SweepSchemeSegregated *_sweepScheme;
 	MM_MemoryPoolSegregated *_memoryPool;
+	bool _completeLazySweep; /**< if true, only sweep the small regions left unswept by the previous lazy sweep */
 
 /* Methods */
 public:
@@ -47,10 +48,11 @@ public:
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
 	
-	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool)
+	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool, bool completeLazySweep = false)
 		: MM_ParallelTask(env, dispatcher)
 		, _sweepScheme(sweepScheme)
 		, _memoryPool(memoryPool)
+		, _completeLazySweep(completeLazySweep)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -118,6 +118,20 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
+	/* A lazy sweep leaves the small regions on the sweep lists, to be swept by allocating threads through
+	 * sweepAndAllocateRegionFromSmallSizeClass() or by the background sweep threads, so the pause does not
+	 * grow with the heap. A heap about to be walked must be fully swept.
+	 */
+	if (!_extensions->segregatedLazySweep || isFixHeapForWalk) {
+		completeSweep(env);
+	}
+}
+
+void
+MM_SweepSchemeSegregated::completeSweep(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+
 	incrementalSweepSmall(env);
 	regionPool->joinBucketListsForSplitIndex(env);
 
@@ -143,6 +157,7 @@ MM_SweepSchemeSegregated::postSweep(MM_EnvironmentBase *env)
 void
 MM_SweepSchemeSegregated::sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region)
 {
+	region->setSweeping();
 	region->getMemoryPoolACL()->resetCounts();
 
 	switch (region->getRegionType()) {
@@ -167,6 +182,8 @@ MM_SweepSchemeSegregated::sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDesc
 	default:
 		Assert_MM_unreachable();
 	}
+
+	region->setSwept(_memoryPool->getRegionPool()->getSweepEpoch());
 }
 
 void
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -65,6 +65,12 @@ public:
 	MM_MarkMap *getMarkMap(MM_EnvironmentBase * env);
 
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
+
+	/**
+	 * Sweep every small region still queued for sweeping and coalesce the free regions. Completes
+	 * sweep(), and must run before the next mark when a lazy sweep left regions unswept.
+	 */
+	void completeSweep(MM_EnvironmentBase *env);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
@@ -340,11 +340,18 @@ MM_CompactScheme::setFreeChunk(omrobjectptr_t from, omrobjectptr_t to)
 }
 
 void
-MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded)
+MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool incremental)
 {
-	createSubAreaTable(env, singleThreaded);
+	createSubAreaTable(env, singleThreaded, incremental);
 	setRealLimitsSubAreas(env);
 	removeNullSubAreas(env);
+	if (incremental) {
+		measureSubAreaFragmentation(env);
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			selectIncrementSubAreas(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
 	completeSubAreaTable(env);
 }
 
@@ -373,7 +380,7 @@ MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
  *  Create sub areas table for regions.
  */
 void
-MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded)
+MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded, bool incremental)
 {
 	/* finding whether there are memory limitations */
 	uintptr_t max_subarea_num = _subAreaTableSize / sizeof(_subAreaTable[0]);
@@ -398,7 +405,9 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 	} else {
 		min_subarea_size = _heap->getMaximumPhysicalRange();
 	}
-	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+	/* increments are made of whole sub areas, so smaller sub areas bound the work of an increment more closely */
+	uintptr_t desired_subarea_size = incremental ? INCREMENTAL_COMPACTION_SUBAREA_SIZE : DESIRED_SUBAREA_SIZE;
+	uintptr_t size = (desired_subarea_size >= min_subarea_size) ?  desired_subarea_size : min_subarea_size;
 
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
@@ -417,7 +426,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
 			intptr_t state = SubAreaEntry::init;
 
-			if (singleThreaded) {
+			if (singleThreaded && !incremental) {
 				size = areaSize;
 			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
@@ -501,6 +510,141 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 	}
 }
 
+/**
+ *  Measure the free bytes each sub area would give back if it was compacted.
+ */
+void
+MM_CompactScheme::measureSubAreaFragmentation(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	/* multi threaded pass over the swept heap; free space trailing the last live object of a sub area is not counted since it is already contiguous */
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::measuring_fragmentation)) {
+				uintptr_t reclaimableBytes = 0;
+				uintptr_t freeBytes = 0;
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, true);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					if (objectIterator.isDeadObject()) {
+						freeBytes += getFreeChunkSize(objectPtr);
+					} else {
+						reclaimableBytes += freeBytes;
+						freeBytes = 0;
+					}
+				}
+				subAreaTable[i].reclaimableBytes = reclaimableBytes;
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+/**
+ *  Select the sub areas evacuated by this increment.
+ */
+void
+MM_CompactScheme::selectIncrementSubAreas(MM_EnvironmentStandard *env)
+{
+	uintptr_t budget = _extensions->incrementalCompactionBudget;
+	if (0 == budget) {
+		budget = _heap->getActiveMemorySize() / 4;
+	}
+	/* a sub area is only worth evacuating if it gives back at least a TLH worth of memory */
+	uintptr_t minimumReclaimableBytes = _extensions->tlhMinimumSize;
+	uintptr_t bucketBytes[fragmentationBuckets];
+	for (uintptr_t bucket = 0; bucket < fragmentationBuckets; bucket++) {
+		bucketBytes[bucket] = 0;
+	}
+
+	/* Rank the candidates by the ratio of reclaimable bytes to sub area size */
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	GC_HeapRegionIteratorStandard rankingIterator(_rootManager);
+	SubAreaEntry *subAreaTable = _subAreaTable;
+	while (NULL != (region = rankingIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (subAreaTable[i].reclaimableBytes >= minimumReclaimableBytes) {
+				uintptr_t size = (uintptr_t)subAreaTable[i+1].firstObject - (uintptr_t)subAreaTable[i].firstObject;
+				bucketBytes[subAreaTable[i].reclaimableBytes / ((size / fragmentationBuckets) + 1)] += size;
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	/* Buckets above the threshold are evacuated entirely, the threshold bucket as far as the remaining budget allows */
+	intptr_t threshold = fragmentationBuckets - 1;
+	uintptr_t bytesAboveThreshold = 0;
+	while ((threshold >= 0) && ((bytesAboveThreshold + bucketBytes[threshold]) <= budget)) {
+		bytesAboveThreshold += bucketBytes[threshold];
+		threshold -= 1;
+	}
+	uintptr_t thresholdBudget = budget - bytesAboveThreshold;
+
+	uintptr_t selectedSubAreas = 0;
+	uintptr_t selectedBytes = 0;
+	uintptr_t pendingSubAreas = 0;
+	GC_HeapRegionIteratorStandard selectionIterator(_rootManager);
+	subAreaTable = _subAreaTable;
+	while (NULL != (region = selectionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			bool selected = false;
+			if (subAreaTable[i].reclaimableBytes >= minimumReclaimableBytes) {
+				uintptr_t size = (uintptr_t)subAreaTable[i+1].firstObject - (uintptr_t)subAreaTable[i].firstObject;
+				intptr_t bucket = (intptr_t)(subAreaTable[i].reclaimableBytes / ((size / fragmentationBuckets) + 1));
+				if (bucket > threshold) {
+					selected = true;
+				} else if (bucket == threshold) {
+					/* always make progress, even if the most fragmented sub area alone exceeds the budget */
+					if ((size <= thresholdBudget) || ((0 == bytesAboveThreshold) && (0 == selectedSubAreas))) {
+						selected = true;
+						thresholdBudget -= OMR_MIN(size, thresholdBudget);
+					}
+				}
+
+				if (selected) {
+					selectedSubAreas += 1;
+					selectedBytes += size;
+				} else {
+					pendingSubAreas += 1;
+				}
+			}
+
+			if (!selected) {
+				/* objects outside of the increment stay in place; they are only fixed up */
+				subAreaTable[i].state = SubAreaEntry::fixup_only;
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	_incrementalCompactionPending = (0 != pendingSubAreas);
+
+	MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+	compactStats->_incremental = true;
+	compactStats->_incrementSubAreas = selectedSubAreas;
+	compactStats->_incrementBytes = selectedBytes;
+	compactStats->_incrementPendingSubAreas = pendingSubAreas;
+
+	Trc_MM_CompactScheme_selectIncrementSubAreas(env->getLanguageVMThread(), selectedSubAreas, selectedBytes, pendingSubAreas, budget);
+}
+
 /**
  *  Complete setup for each sub area.
  */
@@ -528,7 +672,7 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 }
 
 void
-MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive)
+MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive, bool incremental)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -551,6 +695,9 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* An increment selects the sub areas left for later increments again; a full compaction leaves none */
+		_incrementalCompactionPending = false;
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -565,7 +712,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
+	workerSetupForGC(env, singleThreaded, incremental);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
 	/* If a single threaded compaction force compact to run on main thread. Required
@@ -667,7 +814,10 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 		poolState->_memoryPool = subAreaTable[i].memoryPool;
 
 		do {
-			if (NULL != subAreaTable[i].freeChunk) {
+			if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* Objects in the sub area were not moved, so the holes left by the sweep are still there */
+				addFreeEntriesInFixupOnlySubArea(env, memorySubSpace, poolState, &subAreaTable[i], currentFreeBase);
+			} else if (NULL != subAreaTable[i].freeChunk) {
 				if (subAreaTable[i].freeChunk == subAreaTable[i].firstObject) {
 					/* The entire sub area is free */
 					if (NULL == currentFreeBase) {
@@ -687,9 +837,7 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
 			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
-				 */
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -715,6 +863,23 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_CompactScheme::addFreeEntriesInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, SubAreaEntry *subArea, void *&currentFreeBase)
+{
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, subArea[0].firstObject, subArea[1].firstObject, true);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		if (objectIterator.isDeadObject()) {
+			if (NULL == currentFreeBase) {
+				currentFreeBase = (void *)objectPtr;
+			}
+		} else if (NULL != currentFreeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+			currentFreeBase = NULL;
+		}
+	}
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1412,7 +1577,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1477,7 +1642,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i+1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
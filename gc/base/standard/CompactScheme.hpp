@@ -93,11 +93,13 @@ private:
 		omrobjectptr_t freeChunk;
         volatile uintptr_t state;
         volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		uintptr_t reclaimableBytes; /**< Free bytes below the last live object of the sub area, measured for incremental compaction */
         
     	/* legal values for currentAction */
     	enum {
     		none = 0,
     		setting_real_limits,
+    		measuring_fragmentation,
     		evacuating,
     		fixing_up,
     		rebuilding_mark_bits,
@@ -139,6 +141,12 @@ protected:
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
     MM_CompactDelegate _delegate;
+	bool _incrementalCompactionPending; /**< True if the last increment left fragmented sub areas that were not evacuated */
+
+	/**
+	 * Number of buckets sub areas are ranked by when selecting the sub areas of a compaction increment
+	 */
+	enum { fragmentationBuckets = 16 };
 
 public:
 
@@ -159,7 +167,7 @@ protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
-    void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded);
+    void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded, bool incremental);
     /**
      * Set the real limits for a specific subArea
      *
@@ -169,6 +177,22 @@ protected:
     void removeNullSubAreas(MM_EnvironmentStandard *env);
     void completeSubAreaTable(MM_EnvironmentStandard *env);
 
+    /**
+     * Measure the free bytes each sub area would give back if it was compacted.
+     * Relies on the sweep that precedes the compaction having left the heap walkable.
+     *
+     * @param env[in] the current thread
+     */
+    void measureSubAreaFragmentation(MM_EnvironmentStandard *env);
+
+    /**
+     * Select the most fragmented sub areas that fit in the increment budget for evacuation.
+     * All other sub areas are only fixed up.
+     *
+     * @param env[in] the current thread
+     */
+    void selectIncrementSubAreas(MM_EnvironmentStandard *env);
+
     void saveForwardingPtr(class CompactTableEntry&,
                             omrobjectptr_t objectPtr,
                             omrobjectptr_t forwardingPtr,
@@ -219,6 +243,21 @@ protected:
 
     void rebuildFreelist(MM_EnvironmentStandard *env);
 
+    /**
+     * Return the free entries of a sub area that was not evacuated to its pool.
+     * A hole reaching the end of the sub area is left open in currentFreeBase so that it
+     * can be joined with free space at the start of the next sub area.
+     *
+     * @param env[in] the current thread
+     * @param subArea[in] the fixup only sub area, followed by the entry of the next sub area
+     * @param currentFreeBase[in/out] base of the free range being accumulated, or NULL
+     */
+    void addFreeEntriesInFixupOnlySubArea(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					SubAreaEntry *subArea,
+					void *&currentFreeBase);
+
     void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
 					MM_CompactMemoryPoolState *poolState,
@@ -306,9 +345,14 @@ public:
 	
 	void kill(MM_EnvironmentBase *env);
 
-    void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded);
+    void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool incremental);
 	void mainSetupForGC(MM_EnvironmentStandard *env);
-    virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive);
+    virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive, bool incremental);
+
+	/**
+	 * @return true if the last compaction was an increment that left fragmented sub areas to a later one
+	 */
+	MMINLINE bool isIncrementalCompactionPending() { return _incrementalCompactionPending; }
     omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
 	void flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolState *freeListState);
 	void fixHeapForWalk(MM_EnvironmentBase *env);
@@ -335,6 +379,7 @@ public:
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
     	, _delegate()
+    	, _incrementalCompactionPending(false)
     {
     	_typeId = __FUNCTION__;
     }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 
 #include "AtomicOperations.hpp"
+#include "Bits.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
@@ -41,6 +42,7 @@
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "Task.hpp"
 #include "WorkStack.hpp"
 #include "WorkPacketsStandard.hpp"
 #include "MarkingScheme.hpp"
@@ -505,6 +507,23 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			assume0(0);
 			break;
 		}
+
+		/* The card table summary has one bit per chunk of cards covering the maximum heap size, and
+		 * is small enough (one bit per 256K of heap with the default card size) to allocate up front.
+		 */
+		if (_extensions->cardCleaningSummary) {
+			uintptr_t cardTableSizeRequired = calculateCardTableSize(env, heap->getMaximumPhysicalRange());
+			_cardSummarySlots = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_SLOT, cardTableSizeRequired) / CARD_SUMMARY_CARDS_PER_SLOT;
+			_cardSummaryIndexSlots = MM_Math::roundToCeiling(CARD_SUMMARY_BITS_PER_SLOT, _cardSummarySlots) / CARD_SUMMARY_BITS_PER_SLOT;
+
+			uintptr_t summarySize = (_cardSummarySlots + _cardSummaryIndexSlots) * sizeof(uintptr_t);
+			_cardSummary = (uintptr_t *)env->getForge()->allocate(summarySize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _cardSummary) {
+				return false;
+			}
+			memset(_cardSummary, 0, summarySize);
+			_cardSummaryIndex = _cardSummary + _cardSummarySlots;
+		}
 	}
 	return initialized;
 }
@@ -525,6 +544,12 @@ MM_ConcurrentCardTable::tearDown(MM_EnvironmentBase *env)
 		env->getForge()->free(_cleaningRanges);
 		_cleaningRanges = NULL;
 	}
+
+	if (NULL != _cardSummary) {
+		env->getForge()->free(_cardSummary);
+		_cardSummary = NULL;
+		_cardSummaryIndex = NULL;
+	}
 	MM_CardTable::tearDown(env);
 }
 
@@ -993,12 +1018,12 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	/* Update callers counter with amount cleaned for this card */
 	*totalBytesCleaned += sizeDone;
 
-	/* If we found any RS objects and RS overflow flag is ON the re-dirty the card
+	/* If we found any RS objects and RS overflow (or card) flag is ON the re-dirty the card
 	 * so we re-visit any such objects later to trace nursery references. This will
 	 * mean we re-trace objects not in the RS but RS overflow is assumed to be
 	 * an exceptional circumstance.
 	 */
-	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
+	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowOrCardState())) {
 		*card = (Card)CARD_DIRTY;
 	}
 
@@ -1023,6 +1048,75 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 												(uintptr_t)_cleaningRanges);
 	/* We process all cards in one go */
 	_lastCardInPhase = _lastCard;
+
+	if (NULL != _cardSummary) {
+		/* The summary slots are rebuilt by summarizeFinalCardCleaning(), the index records which of them are in use */
+		memset(_cardSummaryIndex, 0, _cardSummaryIndexSlots * sizeof(uintptr_t));
+		_cardSummaryClaimSlot = 0;
+	}
+}
+
+/**
+ * Build the card table summary for final card cleaning.
+ *
+ * Each GC thread takes summary slots as work units and sets the bit of every chunk of cards,
+ * within the cleaning ranges, which holds at least one card final card cleaning must process.
+ * Mutators are stopped so the card table can not be dirtied behind the scan; cards dirtied by
+ * work stack overflow whilst cleaning are picked up by the next round of final card cleaning.
+ *
+ * @return TRUE if the summary is in use; FALSE if cards are to be found by getNextDirtyCard()
+ */
+bool
+MM_ConcurrentCardTable::summarizeFinalCardCleaning(MM_EnvironmentBase *env)
+{
+	MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+	envStandard->_cardCleaningCursor = NULL;
+	envStandard->_cardCleaningTop = NULL;
+
+	if (NULL == _cardSummary) {
+		return false;
+	}
+
+	Card *cardTableStart = getCardTableStart();
+	uintptr_t topSlot = 0;
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		uintptr_t rangeTopSlot = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_SLOT, (uintptr_t)(range->topCard - cardTableStart)) / CARD_SUMMARY_CARDS_PER_SLOT;
+		topSlot = OMR_MAX(topSlot, rangeTopSlot);
+	}
+	assume0(topSlot <= _cardSummarySlots);
+
+	for (uintptr_t slot = 0; slot < topSlot; slot++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			Card *slotBase = cardTableStart + (slot * CARD_SUMMARY_CARDS_PER_SLOT);
+			Card *slotTop = slotBase + CARD_SUMMARY_CARDS_PER_SLOT;
+			uintptr_t summary = 0;
+
+			for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+				Card *baseCard = OMR_MAX(range->baseCard, slotBase);
+				Card *topCard = OMR_MIN(range->topCard, slotTop);
+				while (baseCard < topCard) {
+					uintptr_t chunk = (uintptr_t)(baseCard - slotBase) >> CARD_SUMMARY_CARDS_PER_CHUNK_SHIFT;
+					Card *chunkTop = OMR_MIN(topCard, slotBase + ((chunk + 1) << CARD_SUMMARY_CARDS_PER_CHUNK_SHIFT));
+					if (summarizeCards(env, baseCard, chunkTop, _finalCardCleanMask)) {
+						summary |= ((uintptr_t)1 << chunk);
+					}
+					baseCard = chunkTop;
+				}
+			}
+
+			_cardSummary[slot] = summary;
+			if (0 != summary) {
+				volatile uintptr_t *indexSlot = &_cardSummaryIndex[slot / CARD_SUMMARY_BITS_PER_SLOT];
+				uintptr_t indexBit = (uintptr_t)1 << (slot % CARD_SUMMARY_BITS_PER_SLOT);
+				uintptr_t oldValue = *indexSlot;
+				while (oldValue != MM_AtomicOperations::lockCompareExchange(indexSlot, oldValue, oldValue | indexBit)) {
+					oldValue = *indexSlot;
+				}
+			}
+		}
+	}
+
+	return true;
 }
 
 /**
@@ -1047,7 +1141,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	omrobjectptr_t objectPtr;
 	uintptr_t objects;
 	uintptr_t cards = 0;
-	bool phase2 = false;
+	uintptr_t phase2Cards = 0;
 
 	/* Set upper limit of refs we push before returning to one packets worth */
 	uintptr_t maxPushes = _markingScheme->getWorkPackets()->getSlotsInPacket();
@@ -1057,23 +1151,25 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	
+	/* With a card table summary dirty cards are handed out a chunk at a time, in no particular order */
+	bool useSummary = (NULL != _cardSummary);
+
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard = (useSummary ? getNextDirtyCardFromSummary(env, _finalCardCleanMask) : getNextDirtyCard(env, _finalCardCleanMask, false))) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
 		assume0(nextDirtyCard != (Card *)EXCLUSIVE_VMACCESS_REQUESTED);
 
-		/* Reset counters if we are now cleaning phase 2 cards */
-		if(!phase2 && nextDirtyCard >= _firstCardInPhase2) {
-			incFinalCleanedCards(cards, phase2);
-			cards = 0;
-			phase2 = true;
+		/* Count phase 1 and phase 2 cards separately */
+		if (nextDirtyCard >= _firstCardInPhase2) {
+			phase2Cards += 1;
+		} else {
+			cards += 1;
 		}
 
 		/* Clean the card before we trace into it */
 		finalCleanCard(nextDirtyCard);
-		cards += 1;
 
 		/* Calculate address of first slot heap for the card to be cleaned... */
 		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
@@ -1099,7 +1195,8 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	 *
 	 * First update number of dirty cards cleaned
 	 */
-	incFinalCleanedCards(cards, phase2);
+	incFinalCleanedCards(cards, false);
+	incFinalCleanedCards(phase2Cards, true);
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1726,6 +1823,196 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 	return NULL;
 }
 
+/**
+ * Check a run of cards for a card of interest.
+ *
+ * The run is scanned a few slots at a time whilst the cards are aligned, on the premise that
+ * most of the card table is clean.
+ *
+ * @param baseCard - first card of the run
+ * @param topCard - card after the last card of the run
+ * @param cardMask - mask to apply to cards to identify those cards the caller is interested in
+ *
+ * @return TRUE if any card in the run matches the mask; FALSE otherwise
+ */
+bool
+MM_ConcurrentCardTable::summarizeCards(MM_EnvironmentBase *env, Card *baseCard, Card *topCard, Card cardMask)
+{
+	Card *card = baseCard;
+	while (card < topCard) {
+		if (0 == ((uintptr_t)card % sizeof(uintptr_t))) {
+			uintptr_t *slot = (uintptr_t *)card;
+			uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+			while (((slot + 4) <= lastSlot) && (SLOT_ALL_CLEAN == (slot[0] | slot[1] | slot[2] | slot[3]))) {
+				slot += 4;
+			}
+			while ((slot < lastSlot) && (SLOT_ALL_CLEAN == *slot)) {
+				slot += 1;
+			}
+			card = (Card *)slot;
+			if (card >= topCard) {
+				break;
+			}
+		}
+
+		if (0 != (*card & cardMask)) {
+			return true;
+		}
+		card += 1;
+	}
+
+	return false;
+}
+
+/**
+ * Find the lowest part of a card table summary chunk which lies in a cleaning range, and
+ * make it the next run of cards for this thread to check.
+ *
+ * @param lowCard - lowest card of the chunk still to be checked
+ * @param chunkTopCard - card after the last card of the chunk
+ *
+ * @return TRUE if a run was found; FALSE if no cleaning range covers the rest of the chunk
+ */
+bool
+MM_ConcurrentCardTable::findCleaningRangeInChunk(MM_EnvironmentBase *env, Card *lowCard, Card *chunkTopCard)
+{
+	MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+	Card *baseCard = chunkTopCard;
+	Card *topCard = chunkTopCard;
+
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		if ((range->topCard > lowCard) && (OMR_MAX(range->baseCard, lowCard) < baseCard)) {
+			baseCard = OMR_MAX(range->baseCard, lowCard);
+			topCard = OMR_MIN(range->topCard, chunkTopCard);
+		}
+	}
+
+	envStandard->_cardCleaningCursor = baseCard;
+	envStandard->_cardCleaningTop = topCard;
+	return baseCard < topCard;
+}
+
+/**
+ * Claim the next chunk of the card table summary which holds cards to be cleaned.
+ *
+ * The chunk bit is cleared atomically so each chunk is processed by a single thread, and the
+ * summary index is used to skip whole summary slots with no chunks left.
+ *
+ * @return TRUE if a chunk was claimed and its first run of cards set up; FALSE if none left
+ */
+bool
+MM_ConcurrentCardTable::claimSummaryChunk(MM_EnvironmentBase *env)
+{
+	Card *cardTableStart = getCardTableStart();
+	uintptr_t slot = _cardSummaryClaimSlot;
+
+	while (slot < _cardSummarySlots) {
+		uintptr_t indexSlot = slot / CARD_SUMMARY_BITS_PER_SLOT;
+		uintptr_t indexBits = _cardSummaryIndex[indexSlot] >> (slot % CARD_SUMMARY_BITS_PER_SLOT);
+		if (0 == indexBits) {
+			/* No more summary slots with chunks left under this index slot */
+			slot = (indexSlot + 1) * CARD_SUMMARY_BITS_PER_SLOT;
+			continue;
+		}
+		slot += MM_Bits::leadingZeroes(indexBits);
+
+		volatile uintptr_t *summarySlot = &_cardSummary[slot];
+		uintptr_t summary = *summarySlot;
+		while (0 != summary) {
+			uintptr_t chunk = MM_Bits::leadingZeroes(summary);
+			uintptr_t newSummary = summary & ~((uintptr_t)1 << chunk);
+			uintptr_t oldSummary = MM_AtomicOperations::lockCompareExchange(summarySlot, summary, newSummary);
+			if (oldSummary != summary) {
+				/* Another thread claimed a chunk from this slot; retry with its update */
+				summary = oldSummary;
+				continue;
+			}
+
+			if (0 == newSummary) {
+				/* Last chunk of the slot so remove the slot from the index */
+				volatile uintptr_t *index = &_cardSummaryIndex[indexSlot];
+				uintptr_t indexBit = (uintptr_t)1 << (slot % CARD_SUMMARY_BITS_PER_SLOT);
+				uintptr_t oldIndex = *index;
+				while (oldIndex != MM_AtomicOperations::lockCompareExchange(index, oldIndex, oldIndex & ~indexBit)) {
+					oldIndex = *index;
+				}
+			}
+
+			Card *chunkBase = cardTableStart + (slot * CARD_SUMMARY_CARDS_PER_SLOT) + (chunk << CARD_SUMMARY_CARDS_PER_CHUNK_SHIFT);
+			if (findCleaningRangeInChunk(env, chunkBase, chunkBase + CARD_SUMMARY_CARDS_PER_CHUNK)) {
+				return true;
+			}
+			summary = newSummary;
+		}
+
+		/* The slot is exhausted and never refilled, so later callers can start their search after it */
+		slot += 1;
+		uintptr_t claimSlot = _cardSummaryClaimSlot;
+		while ((claimSlot < slot) && (claimSlot != MM_AtomicOperations::lockCompareExchange(&_cardSummaryClaimSlot, claimSlot, slot))) {
+			claimSlot = _cardSummaryClaimSlot;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Get the next dirty card using the card table summary.
+ *
+ * Cards are taken from the chunk this thread has claimed until it is exhausted, then the next
+ * chunk is claimed. Only final card cleaning uses the summary, when no cards are being dirtied.
+ *
+ * @param cardMask - mask to apply to cards to identify those cards the caller
+ * 					 is interested in
+ *
+ * @return address of next dirty card, or NULL if no more dirty cards
+ */
+Card*
+MM_ConcurrentCardTable::getNextDirtyCardFromSummary(MM_EnvironmentBase *env, Card cardMask)
+{
+	MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+	Card *cardTableStart = getCardTableStart();
+
+	while (true) {
+		Card *card = envStandard->_cardCleaningCursor;
+		Card *topCard = envStandard->_cardCleaningTop;
+
+		while (card < topCard) {
+			if (((Card)CARD_CLEAN == *card) && (0 == ((uintptr_t)card % sizeof(uintptr_t)))) {
+				uintptr_t *nextSlot = (uintptr_t *)card;
+				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
+					nextSlot += 1;
+				}
+				card = (Card *)nextSlot;
+				if (card >= topCard) {
+					break;
+				}
+			}
+
+			if (0 != (*card & cardMask)) {
+				envStandard->_cardCleaningCursor = card + 1;
+				return card;
+			}
+			card += 1;
+		}
+
+		/* The rest of the chunk may lie in another cleaning range */
+		if (NULL != topCard) {
+			Card *chunkTopCard = cardTableStart + MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_CHUNK, (uintptr_t)(topCard - cardTableStart));
+			if ((topCard < chunkTopCard) && findCleaningRangeInChunk(env, topCard, chunkTopCard)) {
+				continue;
+			}
+		}
+
+		if (!claimSummaryChunk(env)) {
+			envStandard->_cardCleaningCursor = NULL;
+			envStandard->_cardCleaningTop = NULL;
+			return NULL;
+		}
+	}
+}
+
 /**
  * Set TLH mark bits
  *
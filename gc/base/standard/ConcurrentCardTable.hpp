@@ -68,6 +68,20 @@
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
  
+/**
+ * @}
+ */
+
+/**
+ * @ingroup GC_Modron_Standard
+ * @name Card table summary definitions
+ * @{
+ */
+#define CARD_SUMMARY_CARDS_PER_CHUNK_SHIFT 9
+#define CARD_SUMMARY_CARDS_PER_CHUNK ((uintptr_t)1 << CARD_SUMMARY_CARDS_PER_CHUNK_SHIFT)
+#define CARD_SUMMARY_BITS_PER_SLOT (sizeof(uintptr_t) * BITS_IN_BYTE)
+#define CARD_SUMMARY_CARDS_PER_SLOT (CARD_SUMMARY_CARDS_PER_CHUNK * CARD_SUMMARY_BITS_PER_SLOT)
+
 /**
  * @}
  */
@@ -174,6 +188,12 @@ protected:
 	Card *_firstCardInPhase;
 	Card * volatile _lastCardInPhase;
 	Card *_firstCardInPhase2;
+
+	uintptr_t *_cardSummary; /**< One bit per CARD_SUMMARY_CARDS_PER_CHUNK cards, set while the chunk holds unprocessed cards of interest to final card cleaning */
+	uintptr_t *_cardSummaryIndex; /**< One bit per _cardSummary slot, set while the slot is non-zero */
+	uintptr_t _cardSummarySlots; /**< Number of slots in _cardSummary, covering the maximum heap size */
+	uintptr_t _cardSummaryIndexSlots; /**< Number of slots in _cardSummaryIndex */
+	volatile uintptr_t _cardSummaryClaimSlot; /**< Lowest _cardSummary slot which may still hold unclaimed chunks */
 public:
 	
 	/*
@@ -193,6 +213,11 @@ private:
 	
 	void determineCleaningRanges(MM_EnvironmentBase *env);
 	void resetCleaningRanges(MM_EnvironmentBase *env);
+
+	bool summarizeCards(MM_EnvironmentBase *env, Card *baseCard, Card *topCard, Card cardMask);
+	bool claimSummaryChunk(MM_EnvironmentBase *env);
+	bool findCleaningRangeInChunk(MM_EnvironmentBase *env, Card *lowCard, Card *chunkTopCard);
+	Card *getNextDirtyCardFromSummary(MM_EnvironmentBase *env, Card cardMask);
 	bool isCardInActiveTLH(MM_EnvironmentBase *env, Card *card);
 	
 	void reportCardCleanPass2Start(MM_EnvironmentBase *env);
@@ -380,6 +405,16 @@ public:
 	 * Called by STW to do any necessary initialization prior to final card cleaning.
 	 */
 	virtual void initializeFinalCardCleaning(MM_EnvironmentBase *env);
+	/**
+	 * Build the summary of the card table chunks which hold cards to be cleaned by final card cleaning.
+	 *
+	 * To be called by every thread of the STW parallel task before it starts calling finalCleanCards(). The
+	 * card table is scanned a slot at a time, in parallel, and the summary is then used to hand out only the
+	 * chunks holding dirty cards. The caller must synchronize the GC threads before cleaning any card.
+	 *
+	 * @return TRUE if the summary is in use for this round of final card cleaning; FALSE otherwise
+	 */
+	bool summarizeFinalCardCleaning(MM_EnvironmentBase *env);
 	/**
 	 * Do final card cleaning.
 	 *
@@ -490,7 +525,12 @@ public:
 		_lastCard(NULL),
 		_firstCardInPhase(NULL),
 		_lastCardInPhase(NULL),
-		_firstCardInPhase2(NULL)
+		_firstCardInPhase2(NULL),
+		_cardSummary(NULL),
+		_cardSummaryIndex(NULL),
+		_cardSummarySlots(0),
+		_cardSummaryIndexSlots(0),
+		_cardSummaryClaimSlot(0)
 	{
 		_typeId = __FUNCTION__;
 	}
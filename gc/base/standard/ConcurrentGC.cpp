@@ -1409,9 +1409,19 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 	 * initialization and marking phases we need to allow for that when calculating
 	 * the KO point.
 	 */
-	kickoffThreshold = (_stats.getInitWorkRequired() / _allocToInitRate) +
-					   (_traceTargetPass1 / _allocToTraceRateNormal) +
-					   (_traceTargetPass2 / (_allocToTraceRateNormal * _allocToTraceRateCardCleanPass2Boost));
+	if (_extensions->concurrentMarkPacer) {
+		/* The pacer expects the concurrent helpers to keep tracing at the rate they achieved in previous
+		 * cycles, so kickoff only needs to leave room for the mutators and helpers tracing together.
+		 */
+		float traceRate = getAllocToTraceRateNormal() + _pacerConHelperTraceRate;
+		kickoffThreshold = (_stats.getInitWorkRequired() / _allocToInitRate) +
+						   (uintptr_t)((float)_traceTargetPass1 / traceRate) +
+						   (uintptr_t)((float)_traceTargetPass2 / (traceRate * _allocToTraceRateCardCleanPass2Boost));
+	} else {
+		kickoffThreshold = (_stats.getInitWorkRequired() / _allocToInitRate) +
+						   (_traceTargetPass1 / _allocToTraceRateNormal) +
+						   (_traceTargetPass2 / (_allocToTraceRateNormal * _allocToTraceRateCardCleanPass2Boost));
+	}
 
 	/* Determine card cleaning thresholds */
 	cardCleaningThreshold = ((uintptr_t)((float)kickoffThreshold / _cardCleaningThresholdFactor));
@@ -1431,8 +1441,15 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 	 *  2) the kickoff slack will be 100M
 	 *  3) the cardcleaning slack will be 20M (100M * (10M / 2M))
 	 *  resulting in a final kickoffThreshold = 111M and a cardCleaningThreshold = 23M
+	 *
+	 * With the pacer enabled, the boost factor is the one it learned from previous cycles.
 	 */
-	float boost = ((float)kickoffThreshold * CONCURRENT_KICKOFF_THRESHOLD_BOOST) - (float)kickoffThreshold;
+	float kickoffBoost = CONCURRENT_KICKOFF_THRESHOLD_BOOST;
+	if (_extensions->concurrentMarkPacer) {
+		kickoffBoost = _pacerKickoffBoost;
+		_stats.setPacerKickoffBoost(kickoffBoost);
+	}
+	float boost = ((float)kickoffThreshold * kickoffBoost) - (float)kickoffThreshold;
 	float kickoffProportion = 1.0;
 	float cardCleaningProportion = (float)cardCleaningThreshold / (float)kickoffThreshold;
 
@@ -1464,8 +1481,10 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 	_totalCleanedAtPass2KO = HIGH_VALUES;
 	_pass2Started = false;
 
-	_alloc2ConHelperTraceRate = 0;
+	/* The pacer starts the cycle assuming helpers trace as they did before, rather than taxing mutators for all of the work */
+	_alloc2ConHelperTraceRate = _extensions->concurrentMarkPacer ? _pacerConHelperTraceRate : 0;
 	_lastConHelperTraceSizeCount = 0;
+	_pacerFreeAtExhaustion = 0;
 	_lastAverageAlloc2TraceRate = 0;
 	_maxAverageAlloc2TraceRate = 0;
     _lastFreeSize = LAST_FREE_SIZE_NEEDS_INITIALIZING;
@@ -1499,6 +1518,48 @@ MM_ConcurrentGC::adjustTraceTarget()
 	_stats.setTraceSizeTarget(newTraceTarget);
 }
 
+/**
+ * Update the concurrent mark pacer at the end of a concurrent cycle.
+ *
+ * The kickoff boost is raised if free space ran out before tracing completed,
+ * and lowered if tracing completed while much more free space remained than
+ * the kickoff buffer intended to leave. The concurrent helper trace rate is
+ * carried over so the next cycle can account for it from kickoff.
+ */
+void
+MM_ConcurrentGC::updatePacer(MM_EnvironmentBase *env)
+{
+	/* An explicit or externally forced collection says nothing about how well the cycle was paced */
+	if ((NULL == env->_cycleState) || env->_cycleState->_gcCode.isExplicitGC() || _forcedKickoff) {
+		return;
+	}
+
+	uintptr_t executionModeAtGC = _stats.getExecutionModeAtGC();
+	if (CONCURRENT_EXHAUSTED > executionModeAtGC) {
+		/* Free space ran out before tracing completed so kick off earlier */
+		_pacerKickoffBoost = OMR_MIN(_pacerKickoffBoost * CONCURRENT_PACER_KICKOFF_BOOST_INCREASE, CONCURRENT_PACER_KICKOFF_BOOST_MAX);
+	} else if (_pacerFreeAtExhaustion > (2 * _kickoffThresholdBuffer)) {
+		/* Tracing completed well ahead of the buffer so kick off later */
+		_pacerKickoffBoost = OMR_MAX(_pacerKickoffBoost - ((_pacerKickoffBoost - (float)1.0) * CONCURRENT_PACER_KICKOFF_BOOST_DECAY), CONCURRENT_PACER_KICKOFF_BOOST_MIN);
+	}
+
+	_pacerConHelperTraceRate = MM_Math::weightedAverage(_pacerConHelperTraceRate, _alloc2ConHelperTraceRate, CONCURRENT_HELPER_HISTORY_WEIGHT);
+
+	_stats.setPacerKickoffBoost(_pacerKickoffBoost);
+	_stats.setPacerConHelperTraceRate(_pacerConHelperTraceRate);
+	_stats.setPacerFreeAtExhaustion(_pacerFreeAtExhaustion);
+
+	Trc_MM_ConcurrentGC_updatePacer(env->getLanguageVMThread(), executionModeAtGC, _pacerFreeAtExhaustion, _kickoffThresholdBuffer, (double)_pacerKickoffBoost, (double)_pacerConHelperTraceRate);
+
+	if (_extensions->debugConcurrentMark) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrtty_printf("Update pacer : Execution mode at GC=\"%zu\" Free at exhaustion=\"%zu\" KO threshold buffer=\"%zu\"\n",
+							executionModeAtGC, _pacerFreeAtExhaustion, _kickoffThresholdBuffer);
+		omrtty_printf("               KO boost=\"%.3f\" Helper trace rate=\"%.3f\"\n",
+							_pacerKickoffBoost, _pacerConHelperTraceRate);
+	}
+}
+
 /**
  * Update tuning statistics at end of a concurrent cycle.
  *
@@ -1725,8 +1786,12 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 	    /* The "over tracing" should not only adjust to the current ratio between
 	     * free space and estimated remaining tracing, but also try to do even more tracing, in
 	     * order to correct the ratio back to the required alloc to trace rate.
+	     * The pacer recomputes the required rate on every allocation instead, so it only
+	     * asks for what is needed to complete just as free space reaches the buffer.
 	     */
-	    	thisTraceRate += ((thisTraceRate - _allocToTraceRate) * OVER_TRACING_BOOST_FACTOR);
+			if (!_extensions->concurrentMarkPacer) {
+				thisTraceRate += ((thisTraceRate - _allocToTraceRate) * OVER_TRACING_BOOST_FACTOR);
+			}
 			/* Make sure its not now greater than max */
 			if(thisTraceRate > getAllocToTraceRateMax()) {
 				thisTraceRate = getAllocToTraceRateMax();
@@ -1915,6 +1980,12 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
         _lastFreeSize =  freeSize;
         _tuningUpdateInterval= (uintptr_t)((float)freeSize  * TUNING_HEAP_SIZE_FACTOR);
 
+		if (_extensions->concurrentMarkPacer) {
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			_pacerKickoffFree = freeSize;
+			_pacerKickoffTime = omrtime_hires_clock();
+		}
+
         if (_tuningUpdateInterval > _maxTraceSize) {
             _tuningUpdateInterval = _maxTraceSize;
         }
@@ -1949,6 +2020,22 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 			_maxAverageAlloc2TraceRate =  _lastAverageAlloc2TraceRate;
 		}
 
+		if (_extensions->concurrentMarkPacer) {
+			/* Export the pacer's view of the cycle: allocation rate since kickoff, helper throughput and the
+			 * tracing rate still required to complete the remaining work before free space reaches the buffer
+			 */
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			uint64_t elapsedMillis = omrtime_hires_delta(_pacerKickoffTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+			if (0 != elapsedMillis) {
+				_stats.setPacerAllocationRate((uintptr_t)(MM_Math::saturatingSubtract(_pacerKickoffFree, freeSize) / elapsedMillis));
+			}
+			uintptr_t traceTarget = _pass2Started ? _traceTargetPass1 + _traceTargetPass2 : _traceTargetPass1;
+			uintptr_t remainingWork = MM_Math::saturatingSubtract(traceTarget, totalTraced);
+			uintptr_t remainingFree = MM_Math::saturatingSubtract(freeSize, _kickoffThresholdBuffer);
+			_stats.setPacerTraceRate((0 == remainingFree) ? getAllocToTraceRateMax() : ((float)remainingWork / (float)remainingFree));
+			_stats.setPacerConHelperTraceRate(_alloc2ConHelperTraceRate);
+		}
+
 		/* Set for next interval */
 		_lastFreeSize = freeSize;
 	}
@@ -2680,6 +2767,7 @@ MM_ConcurrentGC::doConcurrentTrace(MM_EnvironmentBase *env,
 			_concurrentDelegate.isConcurrentScanningComplete(env)) {
 
 			if(_stats.switchExecutionMode(CONCURRENT_CLEAN_TRACE, CONCURRENT_EXHAUSTED)) {
+				_pacerFreeAtExhaustion = remainingFree;
 				/* Tell all MSS to use slow path allocate and so get to a safe
 				* point before paying allocation tax.
 				*/
@@ -2950,8 +3038,8 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 		MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
 	} else
 #endif /* OMR_GC_IDLE_HEAP_MANAGER */
-	if (_extensions->isRememberedSetInOverflowState() || ((CONCURRENT_OFF < executionModeAtGC) && (CONCURRENT_TRACE_ONLY > executionModeAtGC))) {
-		CollectionAbortReason reason = (_extensions->isRememberedSetInOverflowState() ? ABORT_COLLECTION_REMEMBERSET_OVERFLOW : ABORT_COLLECTION_INSUFFICENT_PROGRESS);
+	if (_extensions->isRememberedSetInOverflowOrCardState() || ((CONCURRENT_OFF < executionModeAtGC) && (CONCURRENT_TRACE_ONLY > executionModeAtGC))) {
+		CollectionAbortReason reason = (_extensions->isRememberedSetInOverflowOrCardState() ? ABORT_COLLECTION_REMEMBERSET_OVERFLOW : ABORT_COLLECTION_INSUFFICENT_PROGRESS);
 		abortCollection(env, reason);
 		/* concurrent cycle was aborted so we need to kick off a new cycle and set up the cycle state */
 		MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
@@ -3127,6 +3215,10 @@ MM_ConcurrentGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace
 	 */
 	assume(_cardTable->isTLHMarkBitsEmpty(env),"TLH mark map not empty");
 
+	if (_extensions->concurrentMarkPacer && (CONCURRENT_OFF < _stats.getExecutionModeAtGC())) {
+		updatePacer(env);
+	}
+
 	/* Re tune for next concurrent cycle if we have had a heap resize or we got far enough
 	 * last time. We only re-tune on a system GC in the event of a heap resize.
 	 */
@@ -3418,6 +3510,11 @@ MM_ConcurrentGC::finalCleanCards(MM_EnvironmentBase *env)
 
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
 
+	/* Summarize the card table, in parallel, before any thread starts cleaning cards from the summary */
+	if (((MM_ConcurrentCardTable *)_cardTable)->summarizeFinalCardCleaning(env)) {
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+	}
+
 	/* Until no more refs to process */
 	while (moreRefs) {
 		/* Process any available refs. We may have some refs left from concurrent
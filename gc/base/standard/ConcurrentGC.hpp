@@ -121,6 +121,11 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define LAST_FREE_SIZE_NEEDS_INITIALIZING ((uintptr_t)-1)
 #define ALL_BYTES_TRACED_IN_PASS_1 ((float)1.0)
 
+#define CONCURRENT_PACER_KICKOFF_BOOST_MIN ((float)1.02)
+#define CONCURRENT_PACER_KICKOFF_BOOST_MAX ((float)2.0)
+#define CONCURRENT_PACER_KICKOFF_BOOST_INCREASE ((float)1.25)
+#define CONCURRENT_PACER_KICKOFF_BOOST_DECAY ((float)0.25)
+
 /**
  * @}
  */
@@ -248,6 +253,13 @@ private:
 	float _maxCardCleaningFactorPass2;
 	float _cardCleaningThresholdFactor;
 
+	/* Concurrent mark pacer statistics */
+	float _pacerKickoffBoost; /**< factor applied to the kickoff threshold, adjusted from the outcome of each cycle */
+	float _pacerConHelperTraceRate; /**< bytes traced by concurrent helpers per byte allocated, averaged over cycles */
+	uintptr_t _pacerKickoffFree; /**< free space at the first tuning point of the current cycle */
+	uint64_t _pacerKickoffTime; /**< time of the first tuning point of the current cycle */
+	uintptr_t _pacerFreeAtExhaustion; /**< free space when tracing was exhausted in the current cycle, 0 if it was not */
+
 	bool _forcedKickoff;	/**< Kickoff forced externally flag */
 
 	uintptr_t _languageKickoffReason;
@@ -303,6 +315,7 @@ private:
 	
 	void adjustTraceTarget();
 	void updateTuningStatistics(MM_EnvironmentBase *env);
+	void updatePacer(MM_EnvironmentBase *env);
 	void tuneToHeap(MM_EnvironmentBase *env);
 
 	void conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID);
@@ -508,6 +521,11 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_pacerKickoffBoost(CONCURRENT_KICKOFF_THRESHOLD_BOOST)
+		,_pacerConHelperTraceRate(0)
+		,_pacerKickoffFree(0)
+		,_pacerKickoffTime(0)
+		,_pacerFreeAtExhaustion(0)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_conHelpersRequest(CONCURRENT_HELPER_WAIT)
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTSCAVENGERTUNER_HPP_)
+#define CONCURRENTSCAVENGERTUNER_HPP_
+
+#include "omr.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+#define CONCURRENT_SCAVENGER_TUNER_RELAX_RATIO ((float)0.5) /**< Fraction of the target below which the concurrent phase backs off */
+
+/**
+ * Feedback model keeping the mutator slowdown caused by the Concurrent Scavenger read barrier under a target.
+ *
+ * After each cycle the collector reports the slowdown measured for the concurrent phase: the share of the
+ * phase the most affected mutator thread spent in the read barrier slow path. The model walks a ladder with
+ * one step per cycle. Above the target it first stops the background threads from yielding the CPU to
+ * mutators, then adds a background thread, so that objects get copied before mutators reach them. Well under
+ * the target it first removes a background thread, then lets the remaining one yield the CPU to mutators
+ * between copy caches.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentScavengerTuner : public MM_BaseNonVirtual
+{
+/* Data members / types */
+public:
+protected:
+private:
+	uintptr_t _recommendedThreadCount; /**< Background thread count recommended for the next concurrent phase (UDATA_MAX until first measurement) */
+	bool _yieldToMutators; /**< true if background threads should yield the CPU to mutators between copy caches */
+
+/* Methods */
+public:
+	/**
+	 * Record the slowdown of a concurrent phase and step the ladder.
+	 * @param slowdown[in] Measured mutator slowdown of the phase, in percent
+	 * @param slowdownTarget[in] Slowdown to stay under, in percent
+	 * @param threadCount[in] Number of background threads the phase ran with
+	 * @param minThreadCount[in] Lower bound for the recommendation
+	 * @param maxThreadCount[in] Upper bound for the recommendation
+	 */
+	void
+	update(float slowdown, float slowdownTarget, uintptr_t threadCount, uintptr_t minThreadCount, uintptr_t maxThreadCount)
+	{
+		uintptr_t recommended = threadCount;
+
+		if (slowdown > slowdownTarget) {
+			if (_yieldToMutators) {
+				_yieldToMutators = false;
+			} else if (recommended < maxThreadCount) {
+				recommended += 1;
+			}
+		} else if (slowdown < (slowdownTarget * CONCURRENT_SCAVENGER_TUNER_RELAX_RATIO)) {
+			if (recommended > minThreadCount) {
+				recommended -= 1;
+			} else {
+				_yieldToMutators = true;
+			}
+		}
+
+		_recommendedThreadCount = OMR_MAX(minThreadCount, OMR_MIN(recommended, maxThreadCount));
+	}
+
+	/**
+	 * @return the number of background threads recommended for the next concurrent phase, or UDATA_MAX if there is no history yet
+	 */
+	MMINLINE uintptr_t getRecommendedThreadCount() { return _recommendedThreadCount; }
+
+	/**
+	 * @return true if background threads should yield the CPU to mutators between copy caches
+	 */
+	MMINLINE bool shouldYieldToMutators() { return _yieldToMutators; }
+
+	/**
+	 * Create a ConcurrentScavengerTuner object.
+	 */
+	MM_ConcurrentScavengerTuner() :
+		MM_BaseNonVirtual(),
+		_recommendedThreadCount(UDATA_MAX),
+		_yieldToMutators(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* CONCURRENTSCAVENGERTUNER_HPP_ */
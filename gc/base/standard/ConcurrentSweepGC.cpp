@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "modronopt.h"
+#include "ModronAssertions.h"
+#include "omrmodroncore.h"
+#include "ut_j9mm.h"
+
+#include "ConcurrentSweepGC.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/**
+ * Create new instance of ConcurrentSweepGC object.
+ *
+ * @return Reference to new MM_ConcurrentSweepGC object or NULL
+ */
+MM_ConcurrentSweepGC *
+MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepGC *globalGC = (MM_ConcurrentSweepGC *)env->getForge()->allocate(sizeof(MM_ConcurrentSweepGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_ConcurrentSweepGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+/**
+ * Destroy instance of a ConcurrentSweepGC object.
+ */
+void
+MM_ConcurrentSweepGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+/**
+ * Initialize the collector's internal structures and values.
+ * @return true if initialization completed, false otherwise
+ */
+bool
+MM_ConcurrentSweepGC::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+
+	/* STW collections run on the requesting thread; the main GC thread only completes the sweep, with VM access */
+	if (!_mainGCThread.initialize(this, true, true, false)) {
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Teardown the collector's internal structures and values.
+ */
+void
+MM_ConcurrentSweepGC::tearDown(MM_EnvironmentBase *env)
+{
+	_mainGCThread.tearDown(env);
+
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+/**
+ * Start the background main GC thread.
+ */
+bool
+MM_ConcurrentSweepGC::collectorStartup(MM_GCExtensionsBase* extensions)
+{
+	if (!MM_ParallelGlobalGC::collectorStartup(extensions)) {
+		return false;
+	}
+	return _mainGCThread.startup();
+}
+
+/**
+ * Stop the background main GC thread.
+ */
+void
+MM_ConcurrentSweepGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+	_mainGCThread.shutdown();
+	MM_ParallelGlobalGC::collectorShutdown(extensions);
+}
+
+/**
+ * Run the collection through the main GC thread helper so that it can schedule the background
+ * completion of the sweep once the mutators are released.
+ */
+bool
+MM_ConcurrentSweepGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription)
+{
+	if (_disableGC) {
+		return MM_ParallelGlobalGC::internalGarbageCollect(env, subSpace, allocDescription);
+	}
+
+	_extensions->globalGCStats.gcCount += 1;
+	_mainGCThread.garbageCollect(env, allocDescription);
+	return true;
+}
+
+/**
+ * Entry point from the main GC thread helper, which uses the generic collector signature.
+ * A flat collection always starts from a cleared mark map (see MM_ParallelGlobalGC::internalGarbageCollect).
+ */
+void
+MM_ConcurrentSweepGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits)
+{
+	MM_ParallelGlobalGC::mainThreadGarbageCollect(env, allocDescription, true, rebuildMarkBits);
+}
+
+void
+MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	/**
+	 * Finish off any sweep work still pending before the GC.  We do this to make sure the
+	 * heap is walkable (the sweep could have connected part of an entry that spans many chunks,
+	 * thus creating an unwalkable portion of the heap).
+	 */
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
+}
+
+/**
+ * The walk rebuilds the mark map, so any sweep still relying on the current one has to finish first.
+ */
+void
+MM_ConcurrentSweepGC::prepareHeapForWalk(MM_EnvironmentBase *env)
+{
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::prepareHeapForWalk(env);
+}
+
+void
+MM_ConcurrentSweepGC::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepScheme *concurrentSweep = getConcurrentSweepScheme();
+
+	/* If concurrent sweep was not on this cycle, or has already been completed, do nothing */
+	if (!concurrentSweep->isConcurrentSweepActive()) {
+		return;
+	}
+
+	concurrentSweep->completeSweep(env, ABOUT_TO_GC);
+}
+
+/**
+ * Pay the allocation tax for the mutator by sweeping chunks in proportion to the allocation.
+ */
+void
+MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+	getConcurrentSweepScheme()->payAllocationTax(env, baseSubSpace, allocDescription);
+	env->popVMstate(oldVMstate);
+}
+
+/**
+ * Replenish a pools free lists to satisfy a given allocate by sweeping and connecting the
+ * next chunks of the pool.
+ * @note This call is made under the pools allocation lock (or equivalent)
+ * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return getConcurrentSweepScheme()->replenishPoolForAllocate(env, memoryPool, size);
+}
+
+bool
+MM_ConcurrentSweepGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
+{
+	return getConcurrentSweepScheme()->isConcurrentSweepActive();
+}
+
+void
+MM_ConcurrentSweepGC::preConcurrentInitializeStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats)
+{
+	stats->_cycleID = _extensions->globalGCStats.gcCount;
+	Trc_MM_ConcurrentSweepGC_backgroundSweep_Entry(env->getLanguageVMThread(), stats->_cycleID);
+}
+
+/**
+ * Sweep all remaining chunks from the main GC thread.
+ * Chunks are connected later by allocating threads or by the completion of the sweep at the next collection.
+ * @return the number of bytes swept concurrently (by all participating threads)
+ */
+uintptr_t
+MM_ConcurrentSweepGC::mainThreadConcurrentCollect(MM_EnvironmentBase *env)
+{
+	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+	MM_ConcurrentSweepScheme *concurrentSweep = getConcurrentSweepScheme();
+	concurrentSweep->completeSweepingConcurrently(env);
+	env->popVMstate(oldVMstate);
+
+	return concurrentSweep->getConcurrentSweepStats()->_concurrentCompleteSweepBytesSwept;
+}
+
+void
+MM_ConcurrentSweepGC::postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned)
+{
+	stats->_bytesScanned = bytesConcurrentlyScanned;
+	Trc_MM_ConcurrentSweepGC_backgroundSweep_Exit(env->getLanguageVMThread(), stats->_cycleID, bytesConcurrentlyScanned);
+}
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
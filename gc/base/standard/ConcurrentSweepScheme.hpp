@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -156,6 +156,7 @@ public:
 	virtual void *createSweepPoolState(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
 
 	bool isConcurrentSweepActive() { return _stats.isConcurrentSweepActive(); }
+	MM_ConcurrentSweepStats *getConcurrentSweepStats() { return &_stats; }
 
 	virtual void sweep(MM_EnvironmentBase *env);
 	virtual void completeSweep(MM_EnvironmentBase* env, SweepCompletionReason reason);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -36,7 +36,7 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 bool
-MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount)
+MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t numaNodeCount)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
@@ -44,6 +44,13 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	_sublistCount = extensions->cacheListSplit;
 	Assert_MM_true(0 < _sublistCount);
 
+	if (0 != numaNodeCount) {
+		/* cacheListSplit is rounded up to a multiple of the node count when NUMA aware copying is enabled */
+		Assert_MM_true(0 == (_sublistCount % numaNodeCount));
+		_numaNodeCount = numaNodeCount;
+		_sublistsPerNode = _sublistCount / numaNodeCount;
+	}
+
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
 		result = false;
@@ -323,7 +330,27 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 	uintptr_t index = getSublistIndex(env);
 	MM_CopyScanCacheStandard *cache = NULL;
 
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
+	if ((0 != _numaNodeCount) && (0 != MM_EnvironmentStandard::getEnvironment(env)->_scavengerNumaNode)) {
+		/* prefer caches produced on this thread's node, then any other node's */
+		uintptr_t groupBase = index - (index % _sublistsPerNode);
+		cache = popCacheFromSublists(env, index, _sublistsPerNode, groupBase, _sublistsPerNode);
+		if (NULL == cache) {
+			uintptr_t nextGroupBase = (groupBase + _sublistsPerNode) % _sublistCount;
+			cache = popCacheFromSublists(env, nextGroupBase, _sublistCount - _sublistsPerNode, 0, _sublistCount);
+		}
+	} else {
+		cache = popCacheFromSublists(env, index, _sublistCount, 0, _sublistCount);
+	}
+
+	return cache;
+}
+
+MM_CopyScanCacheStandard *
+MM_CopyScanCacheList::popCacheFromSublists(MM_EnvironmentBase *env, uintptr_t index, uintptr_t count, uintptr_t groupBase, uintptr_t groupSize)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	for (uintptr_t i = 0; i < count; i++) {
 		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
 
 		if (NULL != list->_cacheHead) {
@@ -345,7 +372,7 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 			}
 		}
 
-		index = (index + 1) % _sublistCount;
+		index = groupBase + (((index - groupBase) + 1) % groupSize);
 	}
 
 	return cache;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -75,6 +75,8 @@ private:
 	
 	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _numaNodeCount; /**< the number of NUMA nodes the sublists are partitioned between, or 0 if the lists are not partitioned */
+	uintptr_t _sublistsPerNode; /**< the number of consecutive sublists owned by each NUMA node (valid only if _numaNodeCount is not 0) */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -101,8 +103,29 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t index = 0;
+		uintptr_t numaNode = MM_EnvironmentStandard::getEnvironment(env)->_scavengerNumaNode;
+		if ((0 != _numaNodeCount) && (0 != numaNode)) {
+			/* stay within the group of sublists owned by the thread's node */
+			index = (((numaNode - 1) % _numaNodeCount) * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
+		} else {
+			index = env->getEnvironmentId() % _sublistCount;
+		}
+		return index;
 	}
+
+	/**
+	 * Pop a cache from the first non-empty sublist, walking the sublists in order from the specified index
+	 *
+	 * @param env the current environment
+	 * @param index the index of the first sublist to examine
+	 * @param count the number of sublists to examine
+	 * @param groupBase the index of the first sublist in the group being walked
+	 * @param groupSize the number of sublists in the group being walked (the walk wraps within the group)
+	 *
+	 * @return a cache, or NULL if all examined sublists are empty
+	 */
+	MM_CopyScanCacheStandard *popCacheFromSublists(MM_EnvironmentBase *env, uintptr_t index, uintptr_t count, uintptr_t groupBase, uintptr_t groupSize);
 	
 	/**
 	 * Increment the sublist counter by the specified amount
@@ -126,7 +149,15 @@ private:
 
 protected:
 public:
-	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount);
+	/**
+	 * Initialize the list.
+	 *
+	 * @param env the current environment
+	 * @param cachedEntryCount pointer to the count of non-empty sublists shared between lists, or NULL
+	 * @param numaNodeCount the number of NUMA nodes to partition the sublists between (0 to not partition).
+	 * Threads push to and preferentially pop from the sublists of their own node (see MM_EnvironmentStandard::_scavengerNumaNode).
+	 */
+	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t numaNodeCount = 0);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	/**
@@ -202,6 +233,8 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _numaNodeCount(0)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
@@ -32,6 +32,7 @@
 #include "j9nongenerated.h"
 #include "omrport.h"
 #include "modronopt.h"
+#include "omrmodroncore.h"
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -66,6 +67,10 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _scavengerNumaNode; /**< NUMA node (1-based affinity leader index) this thread copies into and scans for, or 0 if NUMA aware copying is not active */
+	Card *_cardCleaningCursor; /**< next card to check in the card table summary chunk this thread claimed for final card cleaning */
+	Card *_cardCleaningTop; /**< top (exclusive) of the cards being checked from _cardCleaningCursor */
+	uintptr_t _hierarchicalCopyDepth; /**< number of objects whose children this thread is currently copying ahead of the scan */
 
 protected:
 
@@ -98,6 +103,10 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_scavengerNumaNode(0)
+		,_cardCleaningCursor(NULL)
+		,_cardCleaningTop(NULL)
+		,_hierarchicalCopyDepth(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -42,7 +42,7 @@ MM_ParallelCompactTask::getVMStateID()
 void
 MM_ParallelCompactTask::run(MM_EnvironmentBase *env)
 {
-	_compactScheme->compact(env, _rebuildMarkBits, _aggressive);
+	_compactScheme->compact(env, _rebuildMarkBits, _aggressive, _incremental);
 }
 
 void
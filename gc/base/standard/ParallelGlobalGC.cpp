@@ -38,6 +38,9 @@
 #include "Configuration.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#include "FreePageReturner.hpp"
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 #include "GlobalAllocationManager.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
@@ -314,6 +317,16 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER) && (defined(LINUX) || defined(OSX))
+	/* Decommitted pages are only mapped back in on touch where the port library decommits with madvise */
+	if (_extensions->freePageReturner) {
+		_freePageReturner = MM_FreePageReturner::newInstance(env);
+		if (NULL == _freePageReturner) {
+			goto error_no_memory;
+		}
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER && (LINUX || OSX) */
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -378,6 +391,13 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _freePageReturner) {
+		_freePageReturner->kill(env);
+		_freePageReturner = NULL;
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 }
 
 uintptr_t
@@ -758,7 +778,12 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 #endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	}
 
-	
+	/* Continue an incremental compaction that left fragmented sub areas for a later increment */
+	if (_extensions->incrementalCompaction && _compactScheme->isIncrementalCompactionPending()) {
+		compactReason = COMPACT_INCREMENTAL;
+		goto compactionReqd;
+	}
+
 nocompact:	
 	/* Compaction not required or prevented from running */
 	_extensions->globalGCStats.compactStats._compactReason = compactReason;
@@ -777,6 +802,29 @@ compactionReqd:
 	return true;
 }
 
+/**
+ * Determine if the compaction of this cycle may be limited to an increment of the most fragmented sub areas.
+ */
+bool
+MM_ParallelGlobalGC::shouldCompactIncrementally(MM_EnvironmentBase *env)
+{
+	if (!_extensions->incrementalCompaction || env->_cycleState->_gcCode.shouldAggressivelyCompact()) {
+		return false;
+	}
+
+	switch (_extensions->globalGCStats.compactStats._compactReason) {
+	case COMPACT_FRAGMENTED:
+	case COMPACT_MICRO_FRAG:
+	case COMPACT_PAGE:
+	case COMPACT_ALWAYS:
+	case COMPACT_INCREMENTAL:
+		return true;
+	default:
+		/* allocation failures, low free memory, explicit requests and contraction need a complete compaction */
+		return false;
+	}
+}
+
 /**
  * Determine if a compact is required to aid contraction.
  * A heap contraction is due so decide whether a compaction would be
@@ -953,7 +1001,10 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 
 	/* run the mark */
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+	uint64_t markTaskStartTime = omrtime_hires_clock();
 	_dispatcher->run(env, &markTask);
+	uint64_t markTaskElapsedTime = omrtime_hires_clock() - markTaskStartTime;
+	markStats->_gcThreadCount = markTask.getThreadCount();
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -961,6 +1012,15 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 	postMark(env);
 	_markingScheme->mainCleanupAfterGC(env);
 	markStats->_endTime = omrtime_hires_clock();
+
+	if (_extensions->adaptiveGCThreading) {
+		/* feed the stall time of this mark back to choose the thread count of the next one */
+		MM_AdaptiveThreadCount *adaptiveThreadCount = _markingScheme->getAdaptiveThreadCount();
+		uint64_t stallTime = markStats->getStallTime() + _extensions->globalGCStats.workPacketStats.getStallTime();
+		adaptiveThreadCount->update(markStats->_gcThreadCount, _dispatcher->threadCountMaximum(), markTaskElapsedTime, stallTime);
+		markStats->_recommendedThreadCount = adaptiveThreadCount->getRecommendedThreadCount();
+		markStats->_parallelEfficiency = adaptiveThreadCount->getLastEfficiency();
+	}
 	reportMarkEnd(env);
 }
 
@@ -990,7 +1050,7 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 
 	reportCompactStart(env);
 	compactStats->_startTime = omrtime_hires_clock();
-	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
+	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact(), shouldCompactIncrementally(env));
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
 	reportCompactEnd(env);
@@ -1107,6 +1167,12 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 
 	env->_cycleState->_activeSubSpace = NULL;
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _freePageReturner) {
+		_freePageReturner->globalCollectionEnd(env);
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
+
 	/* Clear overflow flag regardless */
 	_extensions->globalGCStats.workPacketStats.setSTWWorkStackOverflowOccured(false);
 	_extensions->allocationStats.clear();
@@ -1362,6 +1428,11 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if ((NULL != _freePageReturner) && !_freePageReturner->startupThread(extensions)) {
+		return false;
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	return true;
 }
 
@@ -1373,6 +1444,11 @@ MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 		extensions->scavenger->collectorShutdown(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _freePageReturner) {
+		_freePageReturner->shutdownThread(extensions);
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 }
 
 /**
@@ -49,6 +49,7 @@ void healReferenceSlots(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *regi
 
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
+class MM_FreePageReturner;
 class MM_ParallelDispatcher;
 class MM_MarkingScheme;
 class MM_MemorySubSpace;
@@ -80,6 +81,9 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 	bool _fixHeapForWalkCompleted;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_FreePageReturner *_freePageReturner; /**< Decommits the pages of idle free entries after global collections, NULL unless -Xgc:freePageReturner */
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 public:
 	
 /*
@@ -143,6 +147,12 @@ private:
 	 * @return true if a compaction is required, false otherwise.
 	 */
 	bool compactRequiredBeforeHeapContraction(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t contractionSize);
+	/**
+	 * Determine if the compaction of this cycle may be limited to an increment of the most fragmented sub areas.
+	 * Compactions that have to free as much contiguous memory as possible always compact the whole heap.
+	 * @return true if the compaction should be incremental, false otherwise.
+	 */
+	bool shouldCompactIncrementally(MM_EnvironmentBase *env);
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	/**
@@ -285,6 +295,9 @@ public:
 	 */
 	uintptr_t fixHeapForWalk(MM_EnvironmentBase *env, UDATA walkFlags, uintptr_t walkReason, MM_HeapWalkerObjectFunc walkFunction);
 	MM_HeapWalker *getHeapWalker() { return _heapWalker; }
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_FreePageReturner *getFreePageReturner() { return _freePageReturner; }
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
 
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
@@ -345,6 +358,9 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _fixHeapForWalkCompleted(false)
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		, _freePageReturner(NULL)
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -38,6 +38,12 @@ MM_ParallelScavengeTask::run(MM_EnvironmentBase *envBase)
 	_collector->workThreadGarbageCollect(env);
 }
 
+uintptr_t
+MM_ParallelScavengeTask::getRecommendedWorkingThreads()
+{
+	return _collector->getRecommendedWorkingThreads();
+}
+
 void
 MM_ParallelScavengeTask::mainSetup(MM_EnvironmentBase *env)
 {
@@ -53,6 +53,7 @@ protected:
 
 public:
 	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_SCAVENGE; };
+	virtual uintptr_t getRecommendedWorkingThreads();
 
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -194,6 +194,8 @@ MM_ParallelSweepScheme::initialize(MM_EnvironmentBase *env)
 	if (0 != omrthread_monitor_init_with_name(&_mutexSweepPoolState, 0, "SweepPoolState Monitor")) {
 		return false;
 	}
+
+	_findMarkedSlot = MM_SweepMarkMapKernel::selectFindMarkedSlot(env);
 	
 	return true;
 }
@@ -341,14 +343,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = (*_findMarkedSlot)(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -636,6 +631,11 @@ MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalC
 				env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
 			}
  
+			/* Start pulling in the mark map of the following chunk (most likely the next one claimed) while this one is swept */
+			if (NULL != chunk->_next) {
+				SWEEP_MARK_MAP_PREFETCH(_currentSweepBits + (((uintptr_t)chunk->_next->chunkBase - (uintptr_t)_heapBase) / J9MODRON_HEAP_SLOTS_PER_MARK_SLOT));
+			}
+
         	/* Sweep the chunk */
 			sweepChunk(env, chunk);
 
@@ -39,6 +39,7 @@
 #include "GCExtensionsBase.hpp"
 #include "MemoryPool.hpp"
 #include "ParallelTask.hpp"
+#include "SweepMarkMapKernel.hpp"
 
 class MM_AllocateDescription;
 class MM_MemoryPool;
@@ -102,6 +103,7 @@ protected:
 	MM_ParallelDispatcher *_dispatcher;
 	MM_MarkMap *_currentMarkMap;	/**< The MarkMap which the ParallelGlobalGC gave to us to use for this cycle */
 	uint8_t *_currentSweepBits;	/*< The base address of the raw bits used by the _currentMarkMap (sweep knows about this in order to perform some optimized types of map walking) */
+	MM_SweepMarkMapKernel::FindMarkedSlotFunction _findMarkedSlot; /**< Kernel used to skip over free runs in the mark map, selected for the processor at startup */
 
 	void *_heapBase;
 
@@ -221,6 +223,7 @@ public:
 		, _dispatcher(_extensions->dispatcher)
 		, _currentMarkMap(NULL)
 		, _currentSweepBits(NULL)
+		, _findMarkedSlot(NULL)
 		, _heapBase(NULL)
 		, _sweepHeapSectioning(NULL)
 		, _poolSweepPoolState(NULL)
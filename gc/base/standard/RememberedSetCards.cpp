@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "RememberedSetCards.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+
+MM_RememberedSetCards *
+MM_RememberedSetCards::newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
+{
+	MM_RememberedSetCards *cards = (MM_RememberedSetCards *)env->getForge()->allocate(sizeof(MM_RememberedSetCards), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL != cards) {
+		new(cards) MM_RememberedSetCards(env, maxHeapSize);
+		if (!cards->initialize(env)) {
+			cards->kill(env);
+			cards = NULL;
+		}
+	}
+
+	return cards;
+}
+
+bool
+MM_RememberedSetCards::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_HeapMap::initialize(env)) {
+		return false;
+	}
+
+	/* Tenure may grow anywhere within the reservation, so back the map for all of it up front.
+	 * The map is only written for objects which overflow the remembered set list, so untouched
+	 * pages are never populated.
+	 */
+	MM_Heap *heap = _extensions->heap;
+	void *heapBase = heap->getHeapBase();
+	void *heapTop = heap->getHeapTop();
+	uintptr_t heapSize = (uintptr_t)heapTop - (uintptr_t)heapBase;
+	if (!MM_HeapMap::heapAddRange(env, heapSize, heapBase, heapTop)) {
+		return false;
+	}
+
+	_cardCount = MM_Math::roundToCeiling(REMEMBERED_SET_CARD_SIZE, heapSize) >> REMEMBERED_SET_CARD_SIZE_SHIFT;
+	_cards = (uint8_t *)env->getForge()->allocate(_cardCount, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _cards) {
+		return false;
+	}
+	memset(_cards, REMEMBERED_SET_CARD_CLEAN, _cardCount);
+
+	return true;
+}
+
+void
+MM_RememberedSetCards::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _cards) {
+		env->getForge()->free(_cards);
+		_cards = NULL;
+	}
+
+	MM_HeapMap::tearDown(env);
+}
+
+void
+MM_RememberedSetCards::clearCards(MM_EnvironmentBase *env)
+{
+	for (uintptr_t card = 0; card < _cardCount; card++) {
+		if (isCardDirty(card)) {
+			cleanCard(card);
+			uintptr_t slotIndex = getSlotIndex((omrobjectptr_t)getCardBase(card));
+			uintptr_t slotTop = getSlotIndex((omrobjectptr_t)getCardTop(card));
+			for (; slotIndex < slotTop; slotIndex++) {
+				setSlot(slotIndex, 0);
+			}
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
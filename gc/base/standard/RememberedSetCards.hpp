@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(REMEMBEREDSETCARDS_HPP_)
+#define REMEMBEREDSETCARDS_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "HeapMap.hpp"
+
+#define REMEMBERED_SET_CARD_SIZE_SHIFT 12
+#define REMEMBERED_SET_CARD_SIZE (((uintptr_t)1) << REMEMBERED_SET_CARD_SIZE_SHIFT)
+#define REMEMBERED_SET_CARDS_PER_WORK_UNIT 64
+
+#define REMEMBERED_SET_CARD_CLEAN ((uint8_t)0)
+#define REMEMBERED_SET_CARD_DIRTY ((uint8_t)1)
+
+class MM_EnvironmentBase;
+
+/**
+ * Fallback storage for remembered objects that could not be appended to the remembered set list.
+ * Each remembered object is recorded by a bit in a heap map, and the card covering it is dirtied,
+ * so only the dirty cards need to be visited when the remembered set is scanned or pruned
+ * instead of walking the whole tenure space as the overflow handling does.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetCards : public MM_HeapMap
+{
+private:
+	uint8_t *_cards; /**< One byte per card of the heap reservation, dirty if the card holds remembered objects */
+	uintptr_t _cardCount; /**< Number of cards covering the heap reservation */
+
+public:
+	static MM_RememberedSetCards *newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize);
+
+	/**
+	 * Record a remembered object. Safe to call from multiple threads.
+	 * @param objectPtr tenured object which has its remembered bit set
+	 */
+	MMINLINE void
+	rememberObject(omrobjectptr_t objectPtr)
+	{
+		atomicSetBit(objectPtr);
+		uintptr_t card = getCardIndex(objectPtr);
+		if (REMEMBERED_SET_CARD_DIRTY != _cards[card]) {
+			_cards[card] = REMEMBERED_SET_CARD_DIRTY;
+		}
+	}
+
+	/**
+	 * Remove an object found in a card being processed.
+	 * @note only the thread which cleaned the card may call this
+	 */
+	MMINLINE void forgetObject(omrobjectptr_t objectPtr) { clearBit(objectPtr); }
+
+	MMINLINE uintptr_t getCardCount() { return _cardCount; }
+	MMINLINE uintptr_t getCardIndex(omrobjectptr_t objectPtr) { return ((uintptr_t)objectPtr - (uintptr_t)_heapBase) >> REMEMBERED_SET_CARD_SIZE_SHIFT; }
+	MMINLINE bool isCardDirty(uintptr_t card) { return REMEMBERED_SET_CARD_DIRTY == _cards[card]; }
+	MMINLINE void cleanCard(uintptr_t card) { _cards[card] = REMEMBERED_SET_CARD_CLEAN; }
+	MMINLINE uintptr_t *getCardBase(uintptr_t card) { return (uintptr_t *)((uintptr_t)_heapBase + (card << REMEMBERED_SET_CARD_SIZE_SHIFT)); }
+	MMINLINE uintptr_t *
+	getCardTop(uintptr_t card)
+	{
+		uintptr_t cardTop = (uintptr_t)_heapBase + ((card + 1) << REMEMBERED_SET_CARD_SIZE_SHIFT);
+		return (uintptr_t *)OMR_MIN(cardTop, (uintptr_t)_heapTop);
+	}
+
+	/**
+	 * Forget every recorded object, cleaning all dirty cards.
+	 * @note assumes exclusive access
+	 */
+	void clearCards(MM_EnvironmentBase *env);
+
+	MM_RememberedSetCards(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
+		: MM_HeapMap(env, maxHeapSize)
+		, _cards(NULL)
+		, _cardCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* REMEMBEREDSETCARDS_HPP_ */
@@ -60,7 +60,10 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -77,6 +80,7 @@
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
 #include "RSOverflow.hpp"
+#include "RememberedSetCards.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
 #include "ScavengerRootScanner.hpp"
@@ -105,6 +109,14 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* With NUMA aware copying, the number of remote chunks a thread hands over to other nodes before settling for remote memory */
+#define OMR_SCAVENGER_NUMA_COPY_DONATION_LIMIT 4
+/* With NUMA aware copying, the maximum number of chunks (per space) parked for a node */
+#define OMR_SCAVENGER_NUMA_COPY_STASH_LIMIT 8
+
+/* With hierarchical copying, the number of cache lines (starting with the one the parent starts in) its children are copied into */
+#define OMR_SCAVENGER_HIERARCHICAL_COPY_BLOCK_LINES 4
+
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
@@ -228,10 +240,37 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
-	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount)) {
+	/* NUMA aware copying is not supported with Concurrent Scavenger, since mutator threads copy too */
+	if (_extensions->scavengerNumaAwareCopy && !IS_CONCURRENT_ENABLED) {
+		_numaCopyNodeCount = _extensions->_numaManager.getAffinityLeaderCount();
+	}
+
+	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount, _numaCopyNodeCount)) {
 		return false;
 	}
 
+	if (0 != _numaCopyNodeCount) {
+		_numaCopyChunkStashes = (NumaCopyChunkStash *)env->getForge()->allocate(sizeof(NumaCopyChunkStash) * _numaCopyNodeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _numaCopyChunkStashes) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _numaCopyNodeCount; i++) {
+			new (&_numaCopyChunkStashes[i]) NumaCopyChunkStash();
+			if (!_numaCopyChunkStashes[i]._lock.initialize(env, &_extensions->lnrlOptions, "MM_Scavenger:_numaCopyChunkStashes[]._lock")) {
+				return false;
+			}
+		}
+		_numaCopyPartitionAlignment = _extensions->heap->getPageSize();
+	}
+
+	/* Concurrent Scavenger scans the remembered set list while mutators run, so it keeps using the overflow state */
+	if (_extensions->scavengerRememberedSetCards && !_extensions->isConcurrentScavengerEnabled()) {
+		_rememberedSetCards = MM_RememberedSetCards::newInstance(env, _extensions->heap->getMaximumPhysicalRange());
+		if (NULL == _rememberedSetCards) {
+			return false;
+		}
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -251,6 +290,8 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST:
 		_cachesPerThread = FLIP_TENURE_LARGE_SCAN;
+		/* hierarchical copying relies on aliasing to hand the copied children back to the scan in copy order */
+		_extensions->scavengerHierarchicalCopy = false;
 		break;
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL:
 		/* deferred cache is only needed for hierarchical scanning */
@@ -307,6 +348,19 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _numaCopyChunkStashes) {
+		for (uintptr_t i = 0; i < _numaCopyNodeCount; i++) {
+			_numaCopyChunkStashes[i]._lock.tearDown();
+		}
+		env->getForge()->free(_numaCopyChunkStashes);
+		_numaCopyChunkStashes = NULL;
+	}
+
+	if (NULL != _rememberedSetCards) {
+		_rememberedSetCards->kill(env);
+		_rememberedSetCards = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -440,8 +494,15 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (0 != _numaCopyNodeCount) {
+		_tenureSpaceBase = _extensions->_tenureBase;
+		_tenureSpaceTop = (void *)((uintptr_t)_extensions->_tenureBase + _extensions->_tenureSize);
+		bindNumaCopyPartitions(env);
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
+	_isRememberedSetInCardStateAtTheBeginning = _extensions->isRememberedSetInCardState();
 	_extensions->rememberedSet.startProcessingSublist();
 }
 
@@ -471,6 +532,10 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_false(env->_loaAllocation);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderBase);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
+
+	if (0 != _numaCopyNodeCount) {
+		selectNumaCopyNode(env);
+	}
 }
 
 uintptr_t
@@ -486,8 +551,12 @@ void
 MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
+	uint64_t scavengeTaskStartTime = omrtime_hires_clock();
 	_dispatcher->run(env, &scavengeTask);
+	_scavengeTaskElapsedTime = omrtime_hires_clock() - scavengeTaskStartTime;
+	_extensions->incrementScavengerStats._gcThreadCount = scavengeTask.getThreadCount();
 
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
@@ -713,6 +782,10 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_tenureSpaceAllocationCountLarge += scavStats->_tenureSpaceAllocationCountLarge;
 	finalGCStats->_tenureSpaceAllocationCountSmall += scavStats->_tenureSpaceAllocationCountSmall;
 
+	finalGCStats->_numaLocalCopyCacheCount += scavStats->_numaLocalCopyCacheCount;
+	finalGCStats->_numaRemoteCopyCacheCount += scavStats->_numaRemoteCopyCacheCount;
+	finalGCStats->_numaDonatedChunkCount += scavStats->_numaDonatedChunkCount;
+
 	/* TODO: Fix this. Not true when merging Main GC threads stats for standard (non CS) Scavenger.
 	   Assert_MM_true(finalGCStats->_flipHistoryNewIndex == scavStats->_flipHistoryNewIndex); */
 
@@ -734,6 +807,7 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_hierarchicalCopyCount += scavStats->_hierarchicalCopyCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -1068,7 +1142,11 @@ retry:
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (0 != env->_scavengerNumaNode) {
+					allocateResult = collectorAllocateNumaCopyChunk(env, false, &allocDescription, scanCacheSize, addrBase, addrTop);
+				} else {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1190,7 +1268,11 @@ retry:
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (0 != env->_scavengerNumaNode) {
+					allocateResult = collectorAllocateNumaCopyChunk(env, true, &allocDescription, scanCacheSize, addrBase, addrTop);
+				} else {
+					allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 				if (allocateResult && allocDescription.isLOAAllocation()) {
@@ -1379,15 +1461,50 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObj
 	return result;
 }
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+MMINLINE void
+MM_Scavenger::recordReadObjectBarrierSlowPath(MM_EnvironmentStandard *env, uint64_t startTime)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *scavengerStats = &env->_scavengerStats;
+
+	/* mutators run through the scan phase and, once background threads exhaust the scan work, the complete phase */
+	if (concurrent_phase_scan == _concurrentPhase) {
+		scavengerStats->_readObjectBarrierSlowPathScan += 1;
+	} else {
+		scavengerStats->_readObjectBarrierSlowPathComplete += 1;
+	}
+	scavengerStats->_readObjectBarrierSlowPathTime += omrtime_hires_clock() - startTime;
+}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 bool
 MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, volatile omrobjectptr_t *slotPtr)
 {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if ((MUTATOR_THREAD == env->getThreadType()) && isConcurrentCycleInProgress()) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
+		bool result = copyAndForward(env, slotPtr);
+		recordReadObjectBarrierSlowPath(env, startTime);
+		return result;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	return copyAndForward(env, slotPtr);
 }
 
 bool
 MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, GC_SlotObject *slotObject)
 {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if ((MUTATOR_THREAD == env->getThreadType()) && isConcurrentCycleInProgress()) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
+		bool result = copyAndForward(env, slotObject);
+		recordReadObjectBarrierSlowPath(env, startTime);
+		return result;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	return copyAndForward(env, slotObject);
 }
 
@@ -1400,6 +1517,13 @@ MM_Scavenger::copyObject(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwar
 //		setBackOutFlag(env, backOutFlagRaised);
 //		return NULL;
 //	}
+	if ((MUTATOR_THREAD == env->getThreadType()) && isConcurrentCycleInProgress()) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
+		omrobjectptr_t result = copy(env, forwardedHeader);
+		recordReadObjectBarrierSlowPath(env, startTime);
+		return result;
+	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	return copy(env, forwardedHeader);
 }
@@ -1654,6 +1778,9 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 
 		/* depth copy the hot fields of an object if scavenger dynamicBreadthFirstScanOrdering is enabled */	
 		depthCopyHotFields(env, forwardedHeader, destinationObjectPtr);
+
+		/* copy the children of the object right after it if hierarchical copying is enabled */
+		hierarchicalCopy(env, copyCache, destinationObjectPtr);
 	} else {
 		/* We have not used the reserved space now, but we will for subsequent allocations. If this space was reserved for an individual object,
 		 * we might have created a TLH remainder from previous cache just before reserving this space. This space eventaully can create another remainder.
@@ -1713,6 +1840,54 @@ MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinati
 	}
 }
 
+MMINLINE void
+MM_Scavenger::hierarchicalCopy(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *copyCache, omrobjectptr_t objectPtr)
+{
+	if (_extensions->scavengerHierarchicalCopy && (env->_hierarchicalCopyDepth < _extensions->scavengerHierarchicalCopyDepth)) {
+		hierarchicalCopyOutline(env, copyCache, objectPtr);
+	}
+}
+
+void
+MM_Scavenger::hierarchicalCopyOutline(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *copyCache, omrobjectptr_t objectPtr)
+{
+	/* Leave the children to the scan, where they can be shared, while threads are stalled waiting for work (same
+	 * inhibiting condition as aliasing). The slots of the copy must not be updated while mutators may be reading them. */
+	if (IS_CONCURRENT_ENABLED || (_waitingCount > _waitingCountAliasThreshold)) {
+		return;
+	}
+
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = getObjectScanner(env, objectPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+	if ((NULL == objectScanner) || objectScanner->isLeafObject() || objectScanner->isIndexableObject()) {
+		/* arrays are left to the scan, where they may be split */
+		return;
+	}
+
+	/* Children are copied for as long as they still start within the block of cache lines the parent starts in and
+	 * the parent's copy cache is still the one being copied into. The slots of the copy are scanned again when its
+	 * copy cache is scanned, which only finds them already copied (and remembers the copy if it was tenured). */
+	uintptr_t blockTop = ((uintptr_t)objectPtr & ~(_cacheLineAlignment - 1)) + (_cacheLineAlignment * OMR_SCAVENGER_HIERARCHICAL_COPY_BLOCK_LINES);
+	GC_SlotObject *slotObject = NULL;
+
+	env->_hierarchicalCopyDepth += 1;
+	while (((uintptr_t)copyCache->cacheAlloc < blockTop)
+		&& ((copyCache == env->_survivorCopyScanCache) || (copyCache == env->_tenureCopyScanCache))
+		&& (NULL != (slotObject = objectScanner->getNextSlot()))
+	) {
+		copyAndForward(env, slotObject);
+		if (NULL != env->_effectiveCopyScanCache) {
+			env->_scavengerStats._hierarchicalCopyCount += 1;
+		}
+	}
+	env->_hierarchicalCopyDepth -= 1;
+
+	/* the caller checks aliasing against the cache that received the parent, unless copying has moved on from it */
+	if ((copyCache == env->_survivorCopyScanCache) || (copyCache == env->_tenureCopyScanCache)) {
+		env->_effectiveCopyScanCache = copyCache;
+	}
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -2128,6 +2303,13 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		return NULL;
 	}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (_slowdownTuner.shouldYieldToMutators() && isCurrentPhaseConcurrent()) {
+		/* mutators are barely slowed down by the read barrier, let them have the CPU between caches */
+		omrthread_yield();
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	/* Preference is to use survivor copy cache */
 	cache = env->_survivorCopyScanCache;
 	if (isWorkAvailableInCacheWithCheck(cache)) {
@@ -2440,6 +2622,9 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 	finalReturnCopyCachesToFreeList(env);
 	abandonSurvivorTLHRemainder(env);
 	abandonTenureTLHRemainder(env, true);
+	if (0 != _numaCopyNodeCount) {
+		abandonNumaCopyChunks(env);
+	}
 
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
@@ -2507,7 +2692,13 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
+		if(!refillRememberedSetFragment(env)) {
+			if (NULL != _rememberedSetCards) {
+				/* Record the object in the remembered set cards rather than overflowing the whole remembered set */
+				_rememberedSetCards->rememberObject(objectPtr);
+				_extensions->setRememberedSetCardState();
+				return ;
+			}
 			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
 			if (!_isRememberedSetInOverflowAtTheBeginning) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
@@ -2529,6 +2720,29 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
+bool
+MM_Scavenger::refillRememberedSetFragment(MM_EnvironmentStandard *env)
+{
+	J9VMGC_SublistFragment *fragment = (J9VMGC_SublistFragment *)&env->_scavengerRememberedSet;
+
+	/* Batch the publication of remembered objects: each refill reserves twice as many entries as the previous one */
+	if (NULL != fragment->fragmentTop) {
+		fragment->fragmentSize = OMR_MIN(fragment->fragmentSize * 2, (uintptr_t)OMR_SCV_REMSET_FRAGMENT_MAX_SIZE);
+	}
+
+	if (NULL == _rememberedSetCards) {
+		return (0 == allocateMemoryForSublistFragment(env->getOmrVMThread(), fragment));
+	}
+
+	/* With remembered set cards the failure is handled by the caller, so do not let the sublist raise the overflow state */
+	MM_SublistFragment::flush(fragment);
+	if (_extensions->fvtest_forceRememberedSetCards && (0 != (_extensions->scavengerStats._gcCount & 1))) {
+		return false;
+	}
+	MM_SublistFragment sublistFragment(fragment);
+	return ((MM_SublistPool *)fragment->parentList)->allocate(env, &sublistFragment);
+}
+
 void
 MM_Scavenger::rememberObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
@@ -2715,6 +2929,102 @@ MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 		pruneRememberedSetOverflow(env);
 	} else {
 		pruneRememberedSetList(env);
+		if (NULL != _rememberedSetCards) {
+			pruneRememberedSetCards(env);
+		}
+	}
+}
+
+void
+MM_Scavenger::scavengeRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	uintptr_t cardCount = _rememberedSetCards->getCardCount();
+
+	for (uintptr_t firstCard = 0; firstCard < cardCount; firstCard += REMEMBERED_SET_CARDS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t lastCard = OMR_MIN(firstCard + REMEMBERED_SET_CARDS_PER_WORK_UNIT, cardCount);
+			for (uintptr_t card = firstCard; card < lastCard; card++) {
+				if (_rememberedSetCards->isCardDirty(card)) {
+					/* Object sizes are not needed to find the recorded objects, so the heap does not have to be walkable */
+					MM_HeapMapIterator rememberedObjectIterator(_extensions, _rememberedSetCards, _rememberedSetCards->getCardBase(card), _rememberedSetCards->getCardTop(card), false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+						scavengeRememberedObject(env, objectPtr);
+					}
+				}
+			}
+		}
+	}
+}
+
+void
+MM_Scavenger::pruneRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		if (_extensions->isRememberedSetInCardState()) {
+			uintptr_t cardCount = _rememberedSetCards->getCardCount();
+			uintptr_t dirtyCards = 0;
+			uintptr_t keptObjects = 0;
+			uintptr_t removedObjects = 0;
+
+			/* Objects that remain remembered but still do not fit the list will restore the card state */
+			_extensions->clearRememberedSetCardState();
+
+			for (uintptr_t card = 0; card < cardCount; card++) {
+				if (_rememberedSetCards->isCardDirty(card)) {
+					dirtyCards += 1;
+					_rememberedSetCards->cleanCard(card);
+					MM_HeapMapIterator rememberedObjectIterator(_extensions, _rememberedSetCards, _rememberedSetCards->getCardBase(card), _rememberedSetCards->getCardTop(card), false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+						_rememberedSetCards->forgetObject(objectPtr);
+						Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+
+						/* Check if object still has nursery references, direct or indirect */
+						bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+						/* Unconditionally remember object if it was recently referenced */
+						if (!shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+							Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+							shouldBeRemembered = true;
+						}
+
+						if (shouldBeRemembered) {
+							/* Move the object back to the remembered set list if it has room, otherwise back to its card */
+							keptObjects += 1;
+							addToRememberedSetFragment(env, objectPtr);
+						} else {
+							removedObjects += 1;
+							_extensions->objectModel.clearRemembered(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+							if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference()) {
+								/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set */
+								oldToOldReferenceCreated(env, objectPtr);
+							}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+						}
+					}
+				}
+			}
+
+			/* Objects may have been remembered during the prune, fragment must be flushed */
+			flushRememberedSet(env);
+
+			Trc_MM_Scavenger_pruneRememberedSetCards(env->getLanguageVMThread(), dirtyCards, keptObjects, removedObjects);
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_Scavenger::convertRememberedSetCardsToOverflow(MM_EnvironmentBase *env)
+{
+	if (_extensions->isRememberedSetInCardState()) {
+		/* Recorded objects keep their remembered bits, so the tenure walk of the overflow handling finds them again */
+		_rememberedSetCards->clearCards(env);
+		_extensions->clearRememberedSetCardState();
+		setRememberedSetOverflowState();
+		Trc_MM_Scavenger_convertRememberedSetCardsToOverflow(env->getLanguageVMThread());
 	}
 }
 
@@ -2737,6 +3047,11 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
+		if (NULL != _rememberedSetCards) {
+			/* The walk below re-adds every remembered object, including those recorded in the cards */
+			_rememberedSetCards->clearCards(env);
+			_extensions->clearRememberedSetCardState();
+		}
 
 		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
 		MM_HeapRegionDescriptorStandard *region = NULL;
@@ -3008,6 +3323,9 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 	} else {
 		if (!IS_CONCURRENT_ENABLED) {
 			scavengeRememberedSetList(env);
+			if (_isRememberedSetInCardStateAtTheBeginning) {
+				scavengeRememberedSetCards(env);
+			}
 		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* Indirect refs are dealt within the root scanning phase (first STW phase), while the direct references are dealt within the main scan phase (typically concurrent). */
@@ -3373,6 +3691,195 @@ MM_Scavenger::abandonTenureTLHRemainder(MM_EnvironmentStandard *env, bool preser
 	}
 }
 
+void
+MM_Scavenger::selectNumaCopyNode(MM_EnvironmentStandard *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t numaNode = 0;
+
+	if (numaManager->isPhysicalNUMASupported()) {
+		uintptr_t affinityLeaderCount = 0;
+		J9MemoryNodeDetail const *affinityLeaders = numaManager->getAffinityLeaders(&affinityLeaderCount);
+		Assert_MM_true(affinityLeaderCount == _numaCopyNodeCount);
+
+		uintptr_t j9NodeNumber = env->getNumaAffinity();
+		if (0 != j9NodeNumber) {
+			for (uintptr_t i = 0; i < affinityLeaderCount; i++) {
+				if (affinityLeaders[i].j9NodeNumber == j9NodeNumber) {
+					numaNode = i + 1;
+					break;
+				}
+			}
+		} else if (GC_WORKER_THREAD == env->getThreadType()) {
+			/* keep the worker on the node whose memory it copies into */
+			j9NodeNumber = affinityLeaders[env->getWorkerID() % affinityLeaderCount].j9NodeNumber;
+			if (env->setNumaAffinity(&j9NodeNumber, 1)) {
+				numaNode = (env->getWorkerID() % affinityLeaderCount) + 1;
+			}
+		}
+	}
+
+	if (0 == numaNode) {
+		numaNode = (env->getWorkerID() % _numaCopyNodeCount) + 1;
+	}
+
+	env->_scavengerNumaNode = numaNode;
+}
+
+void
+MM_Scavenger::bindNumaCopyPartitions(MM_EnvironmentStandard *env)
+{
+	/* a split heap is an MM_HeapSplit made of two reservations, with no single memory handle to bind through */
+	if (_extensions->_numaManager.isPhysicalNUMASupported() && !_extensions->enableSplitHeap) {
+		void *spaceBase[3] = { _evacuateSpaceBase, _survivorSpaceBase, _tenureSpaceBase };
+		void *spaceTop[3] = { _evacuateSpaceTop, _survivorSpaceTop, _tenureSpaceTop };
+
+		/* the semi spaces swap roles every cycle, so only rebind if either of them actually moved */
+		bool semiSpacesBound = ((spaceBase[0] == _numaBoundSpaceBase[0]) && (spaceTop[0] == _numaBoundSpaceTop[0]) && (spaceBase[1] == _numaBoundSpaceBase[1]) && (spaceTop[1] == _numaBoundSpaceTop[1]))
+			|| ((spaceBase[0] == _numaBoundSpaceBase[1]) && (spaceTop[0] == _numaBoundSpaceTop[1]) && (spaceBase[1] == _numaBoundSpaceBase[0]) && (spaceTop[1] == _numaBoundSpaceTop[0]));
+		bool tenureSpaceBound = (spaceBase[2] == _numaBoundSpaceBase[2]) && (spaceTop[2] == _numaBoundSpaceTop[2]);
+
+		uintptr_t affinityLeaderCount = 0;
+		J9MemoryNodeDetail const *affinityLeaders = _extensions->_numaManager.getAffinityLeaders(&affinityLeaderCount);
+		const MM_MemoryHandle *handle = ((MM_HeapVirtualMemory *)_extensions->heap)->getVmemHandle();
+
+		for (uintptr_t space = (semiSpacesBound ? 2 : 0); space < (tenureSpaceBound ? 2 : 3); space++) {
+			uintptr_t spaceSize = (uintptr_t)spaceTop[space] - (uintptr_t)spaceBase[space];
+			uintptr_t partitionSize = MM_Math::roundToCeiling(_numaCopyPartitionAlignment, (spaceSize + _numaCopyNodeCount - 1) / _numaCopyNodeCount);
+			for (uintptr_t node = 1; node <= _numaCopyNodeCount; node++) {
+				uintptr_t partitionBase = MM_Math::roundToCeiling(_numaCopyPartitionAlignment, (uintptr_t)spaceBase[space] + ((node - 1) * partitionSize));
+				uintptr_t partitionTop = OMR_MIN((uintptr_t)spaceBase[space] + (node * partitionSize), (uintptr_t)spaceTop[space]);
+				if (partitionBase < partitionTop) {
+					/* failing to bind only costs locality, so it is not fatal */
+					_extensions->memoryManager->setNumaAffinity(handle, affinityLeaders[node - 1].j9NodeNumber, (void *)partitionBase, partitionTop - partitionBase);
+				}
+			}
+			_numaBoundSpaceBase[space] = spaceBase[space];
+			_numaBoundSpaceTop[space] = spaceTop[space];
+		}
+	}
+}
+
+bool
+MM_Scavenger::collectorAllocateNumaCopyChunk(MM_EnvironmentStandard *env, bool tenure, MM_AllocateDescription *allocDescription, uintptr_t scanCacheSize, void * &addrBase, void * &addrTop)
+{
+	MM_MemorySubSpace *subSpace = tenure ? _tenureMemorySubSpace : _survivorMemorySubSpace;
+	uintptr_t localNode = env->_scavengerNumaNode;
+	NumaCopyChunkStash *localStash = &_numaCopyChunkStashes[localNode - 1];
+	bool result = false;
+
+	/* first take a chunk of local memory another node has handed over */
+	if (NULL != (tenure ? localStash->_tenureChunks : localStash->_survivorChunks)) {
+		NumaCopyChunk *chunk = NULL;
+		localStash->_lock.acquire();
+		if (tenure) {
+			chunk = localStash->_tenureChunks;
+			if (NULL != chunk) {
+				localStash->_tenureChunks = chunk->_next;
+				localStash->_tenureChunkCount -= 1;
+			}
+		} else {
+			chunk = localStash->_survivorChunks;
+			if (NULL != chunk) {
+				localStash->_survivorChunks = chunk->_next;
+				localStash->_survivorChunkCount -= 1;
+			}
+		}
+		localStash->_lock.release();
+
+		if (NULL != chunk) {
+			addrBase = (void *)chunk;
+			addrTop = chunk->_top;
+			env->_scavengerStats._numaLocalCopyCacheCount += 1;
+			result = true;
+		}
+	}
+
+	for (uintptr_t attempt = 0; !result && (attempt < OMR_SCAVENGER_NUMA_COPY_DONATION_LIMIT); attempt++) {
+		if (NULL == subSpace->collectorAllocateTLH(env, this, allocDescription, scanCacheSize, addrBase, addrTop)) {
+			break;
+		}
+
+		void *spaceBase = tenure ? _tenureSpaceBase : _survivorSpaceBase;
+		void *spaceTop = tenure ? _tenureSpaceTop : _survivorSpaceTop;
+		uintptr_t chunkNode = localNode;
+		/* tenure may have expanded beyond the partitioned range - treat such memory as local */
+		if ((addrBase >= spaceBase) && (addrBase < spaceTop)) {
+			chunkNode = getNumaCopyNode(addrBase, spaceBase, spaceTop);
+		}
+
+		bool keepChunk = (chunkNode == localNode) || ((attempt + 1) == OMR_SCAVENGER_NUMA_COPY_DONATION_LIMIT);
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		/* LOA chunks are tagged on the copy cache, which the stash can not preserve */
+		keepChunk = keepChunk || allocDescription->isLOAAllocation();
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+
+		if (!keepChunk) {
+			NumaCopyChunkStash *remoteStash = &_numaCopyChunkStashes[chunkNode - 1];
+			NumaCopyChunk *chunk = (NumaCopyChunk *)addrBase;
+			remoteStash->_lock.acquire();
+			/* bound the memory parked for a node, in case its threads do not need it before the scavenge ends */
+			uintptr_t *chunkCount = tenure ? &remoteStash->_tenureChunkCount : &remoteStash->_survivorChunkCount;
+			if (*chunkCount < OMR_SCAVENGER_NUMA_COPY_STASH_LIMIT) {
+				NumaCopyChunk **chunks = tenure ? &remoteStash->_tenureChunks : &remoteStash->_survivorChunks;
+				chunk->_next = *chunks;
+				chunk->_top = addrTop;
+				*chunks = chunk;
+				*chunkCount += 1;
+			} else {
+				keepChunk = true;
+			}
+			remoteStash->_lock.release();
+		}
+
+		if (keepChunk) {
+			if (chunkNode == localNode) {
+				env->_scavengerStats._numaLocalCopyCacheCount += 1;
+			} else {
+				env->_scavengerStats._numaRemoteCopyCacheCount += 1;
+			}
+			result = true;
+		} else {
+			env->_scavengerStats._numaDonatedChunkCount += 1;
+		}
+	}
+
+	return result;
+}
+
+void
+MM_Scavenger::abandonNumaCopyChunks(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _numaCopyNodeCount; i++) {
+		NumaCopyChunkStash *stash = &_numaCopyChunkStashes[i];
+		if ((NULL != stash->_survivorChunks) || (NULL != stash->_tenureChunks)) {
+			stash->_lock.acquire();
+			NumaCopyChunk *survivorChunks = stash->_survivorChunks;
+			NumaCopyChunk *tenureChunks = stash->_tenureChunks;
+			stash->_survivorChunks = NULL;
+			stash->_tenureChunks = NULL;
+			stash->_survivorChunkCount = 0;
+			stash->_tenureChunkCount = 0;
+			stash->_lock.release();
+
+			while (NULL != survivorChunks) {
+				NumaCopyChunk *next = survivorChunks->_next;
+				void *top = survivorChunks->_top;
+				env->_scavengerStats._flipDiscardBytes += (uintptr_t)top - (uintptr_t)survivorChunks;
+				_survivorMemorySubSpace->abandonHeapChunk(survivorChunks, top);
+				survivorChunks = next;
+			}
+			while (NULL != tenureChunks) {
+				NumaCopyChunk *next = tenureChunks->_next;
+				void *top = tenureChunks->_top;
+				env->_scavengerStats._tenureDiscardBytes += (uintptr_t)top - (uintptr_t)tenureChunks;
+				_tenureMemorySubSpace->abandonHeapChunk(tenureChunks, top);
+				tenureChunks = next;
+			}
+		}
+	}
+}
+
 void
 MM_Scavenger::finalReturnCopyCachesToFreeList(MM_EnvironmentStandard *env)
 {
@@ -3932,6 +4439,11 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		 */
 		_extensions->scavengerRsoScanUnsafe = true;
 
+		if (NULL != _rememberedSetCards) {
+			/* Back out restores remembered objects from the list or from a walk of the tenure space only */
+			convertRememberedSetCardsToOverflow(env);
+		}
+
 		if(isRememberedSetInOverflowState()) {
 			GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
 			MM_HeapRegionDescriptor* rootRegion;
@@ -4077,6 +4589,14 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 
 	_extensions->incrementScavengerStats._endTime = omrtime_hires_clock();
 
+	if (_extensions->adaptiveGCThreading && !IS_CONCURRENT_ENABLED) {
+		/* feed the stall time of this scavenge back to choose the thread count of the next one */
+		MM_ScavengerStats *scavengerStats = &_extensions->incrementScavengerStats;
+		_adaptiveThreadCount.update(scavengerStats->_gcThreadCount, _dispatcher->threadCountMaximum(), _scavengeTaskElapsedTime, scavengerStats->getStallTime());
+		scavengerStats->_recommendedThreadCount = _adaptiveThreadCount.getRecommendedThreadCount();
+		scavengerStats->_parallelEfficiency = _adaptiveThreadCount.getLastEfficiency();
+	}
+
 	/* merge stats from this increment/phase to aggregate cycle stats */
 	mergeIncrementGCStats(env, lastIncrement);
 	reportScavengeEnd(env, lastIncrement);
@@ -4107,7 +4627,8 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 			/* Defer to collector language interface */
 			_delegate.mainThreadGarbageCollect_scavengeSuccess(env);
 
-			if(_extensions->scvTenureStrategyAdaptive) {
+			/* With a pause target the tenure age is adjusted together with new space sizing */
+			if (_extensions->scvTenureStrategyAdaptive && !_extensions->isScavengerPauseTargetEnabled()) {
 				/* Adjust the tenure age based on the percentage of new space used.  Also, avoid / by 0 */
 				uintptr_t newSpaceTotalSize = _activeSubSpace->getMemorySubSpaceAllocate()->getActiveMemorySize();
 				uintptr_t newSpaceConsumedSize = _extensions->scavengerStats._flipBytes;
@@ -4666,6 +5187,11 @@ MM_Scavenger::globalCollectionStart(MM_EnvironmentBase *env)
 
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
+
+	if (NULL != _rememberedSetCards) {
+		/* The global collection may free or move recorded objects, so the cards can not be carried across it */
+		convertRememberedSetCardsToOverflow(env);
+	}
 }
 
 void
@@ -5075,6 +5601,59 @@ MM_Scavenger::scavengeComplete(MM_EnvironmentBase *envBase)
 	return false;
 }
 
+void
+MM_Scavenger::mergeMutatorReadBarrierStats(MM_EnvironmentStandard *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *cycleStats = &_extensions->scavengerStats;
+	GC_OMRVMThreadListIterator threadIterator(_extensions->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+
+	while((walkThread = threadIterator.nextOMRVMThread()) != NULL) {
+		MM_EnvironmentStandard *threadEnvironment = MM_EnvironmentStandard::getEnvironment(walkThread);
+		if (MUTATOR_THREAD == threadEnvironment->getThreadType()) {
+			MM_ScavengerStats *threadStats = &threadEnvironment->_scavengerStats;
+			if (0 != (threadStats->_readObjectBarrierSlowPathScan + threadStats->_readObjectBarrierSlowPathComplete)) {
+				cycleStats->_readObjectBarrierSlowPathScan += threadStats->_readObjectBarrierSlowPathScan;
+				cycleStats->_readObjectBarrierSlowPathComplete += threadStats->_readObjectBarrierSlowPathComplete;
+				cycleStats->_readObjectBarrierSlowPathTime += threadStats->_readObjectBarrierSlowPathTime;
+				cycleStats->_readObjectBarrierSlowPathMaxThreadTime = OMR_MAX(cycleStats->_readObjectBarrierSlowPathMaxThreadTime, threadStats->_readObjectBarrierSlowPathTime);
+				cycleStats->_readObjectBarrierSlowPathThreads += 1;
+
+				threadStats->_readObjectBarrierSlowPathScan = 0;
+				threadStats->_readObjectBarrierSlowPathComplete = 0;
+				threadStats->_readObjectBarrierSlowPathTime = 0;
+			}
+		}
+	}
+
+	if (0 == _concurrentPhaseStartTime) {
+		/* the cycle aborted in its first STW phase and never went concurrent */
+		return;
+	}
+
+	uint64_t concurrentTime = omrtime_hires_clock() - _concurrentPhaseStartTime;
+	_concurrentPhaseStartTime = 0;
+	if (0 != concurrentTime) {
+		cycleStats->_mutatorSlowdown = (float)(((double)cycleStats->_readObjectBarrierSlowPathMaxThreadTime * 100.0) / (double)concurrentTime);
+	}
+
+	if (0 != _extensions->concurrentScavengerSlowdownTarget) {
+		uintptr_t threadCount = _extensions->concurrentScavengerBackgroundThreads;
+		uintptr_t minThreadCount = 1;
+		uintptr_t maxThreadCount = _dispatcher->threadCountMaximum();
+		if (_extensions->concurrentScavengerBackgroundThreadsForced) {
+			/* the thread count was set on the command line, only the yield criteria are tuned */
+			minThreadCount = threadCount;
+			maxThreadCount = threadCount;
+		}
+		_slowdownTuner.update(cycleStats->_mutatorSlowdown, (float)_extensions->concurrentScavengerSlowdownTarget, threadCount, minThreadCount, maxThreadCount);
+		_extensions->concurrentScavengerBackgroundThreads = _slowdownTuner.getRecommendedThreadCount();
+		cycleStats->_recommendedConcurrentThreadCount = _slowdownTuner.getRecommendedThreadCount();
+		cycleStats->_concurrentYieldToMutators = _slowdownTuner.shouldYieldToMutators();
+	}
+}
+
 void
 MM_Scavenger::mutatorSetupForGC(MM_EnvironmentBase *envBase)
 {
@@ -5370,6 +5949,10 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 				continue;
 			}
 
+			/* mutators are released into the concurrent phase once this STW phase ends */
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			_concurrentPhaseStartTime = omrtime_hires_clock();
+
 			timeout = true;
 		}
 			break;
@@ -5390,6 +5973,8 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 
 		case concurrent_phase_complete:
 		{
+			mergeMutatorReadBarrierStats(MM_EnvironmentStandard::getEnvironment(env));
+
 			scavengeComplete(env);
 
 			result = true;
@@ -5514,6 +6099,7 @@ MM_Scavenger::mainThreadConcurrentCollect(MM_EnvironmentBase *env)
 
 		MM_ConcurrentScavengeTask scavengeTask(env, _dispatcher, this, MM_ConcurrentScavengeTask::SCAVENGE_SCAN, env->_cycleState);
 		/* Concurrent background task will run with different (typically lower) number of threads. */
+		_extensions->scavengerStats._concurrentThreadCount = _extensions->concurrentScavengerBackgroundThreads;
 		_dispatcher->run(env, &scavengeTask, _extensions->concurrentScavengerBackgroundThreads);
 
 		_currentPhaseConcurrent = false;
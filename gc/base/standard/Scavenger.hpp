@@ -36,8 +36,14 @@
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
+#include "AdaptiveThreadCount.hpp"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "ConcurrentScavengerTuner.hpp"
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
+#include "Math.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
@@ -55,6 +61,7 @@ class MM_MemorySubSpaceSemiSpace;
 class MM_ParallelDispatcher;
 class MM_PhysicalSubArena;
 class MM_RSOverflow;
+class MM_RememberedSetCards;
 class MM_SublistPool;
 
 struct OMR_VM;
@@ -75,6 +82,8 @@ private:
 
 	const uintptr_t _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
 	bool _isRememberedSetInOverflowAtTheBeginning; /**< Cached RS Overflow flag at the beginning of the scavenge */
+	bool _isRememberedSetInCardStateAtTheBeginning; /**< Cached RS card state flag at the beginning of the scavenge */
+	MM_RememberedSetCards *_rememberedSetCards; /**< Fallback for remembered objects which do not fit the remembered set list (NULL if not enabled) */
 
 	MM_GCExtensionsBase *_extensions;
 	
@@ -121,6 +130,36 @@ private:
 	void *_heapTop;  /**< Cached top pointer of heap */
 	MM_HeapRegionManager *_regionManager;
 
+	/**
+	 * Header written at the base of a copy cache chunk while it sits in a NumaCopyChunkStash
+	 */
+	struct NumaCopyChunk {
+		NumaCopyChunk *_next; /**< next chunk in the stash */
+		void *_top; /**< top (exclusive) of this chunk */
+	};
+
+	/**
+	 * Copy cache chunks allocated by threads of other NUMA nodes, handed over to the node their memory is partitioned to.
+	 * Chunks are threaded through their own memory and must all be abandoned back to their subspace before the scavenge ends.
+	 */
+	struct NumaCopyChunkStash {
+		MM_LightweightNonReentrantLock _lock; /**< protects both chunk lists */
+		NumaCopyChunk *_survivorChunks; /**< survivor chunks partitioned to the node */
+		NumaCopyChunk *_tenureChunks; /**< tenure chunks partitioned to the node */
+		uintptr_t _survivorChunkCount; /**< number of chunks in _survivorChunks */
+		uintptr_t _tenureChunkCount; /**< number of chunks in _tenureChunks */
+	};
+
+	uintptr_t _numaCopyNodeCount; /**< number of NUMA nodes survivor and tenure memory is partitioned between, or 0 if NUMA aware copying is disabled */
+	NumaCopyChunkStash *_numaCopyChunkStashes; /**< array of _numaCopyNodeCount stashes, indexed by node - 1 */
+	uintptr_t _numaCopyPartitionAlignment; /**< partition boundaries are aligned to this (heap page size) so that they can be bound to physical nodes */
+	void *_tenureSpaceBase, *_tenureSpaceTop; /**< cached base and top heap pointers of tenure space (valid only if NUMA aware copying is enabled) */
+	void *_numaBoundSpaceBase[3]; /**< bases of the (two semi and one tenure) spaces whose partitions were last bound to physical NUMA nodes */
+	void *_numaBoundSpaceTop[3]; /**< tops of the spaces whose partitions were last bound to physical NUMA nodes */
+
+	MM_AdaptiveThreadCount _adaptiveThreadCount; /**< thread count recommendation for the scavenge task, fed by the parallel efficiency of previous scavenges */
+	uint64_t _scavengeTaskElapsedTime; /**< wall time of the last dispatched scavenge task, the time adaptive GC threading measures efficiency against */
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	MM_MainGCThread _mainGCThread; /**< An object which manages the state of the main GC thread */
 	
@@ -138,6 +177,9 @@ private:
 	volatile bool _shouldYield; /**< Set by the first GC thread that observes that a criteria for yielding is met. Reset only when the concurrent phase is finished. */
 
 	MM_ConcurrentPhaseStatsBase _concurrentPhaseStats;
+
+	uint64_t _concurrentPhaseStartTime; /**< Time the mutators were released into the concurrent phase of the current cycle, 0 if the cycle did not go concurrent */
+	MM_ConcurrentScavengerTuner _slowdownTuner; /**< background thread count and yield recommendations, fed by the read barrier slowdown of previous cycles */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 #define IS_CONCURRENT_ENABLED _extensions->isConcurrentScavengerEnabled()
@@ -170,6 +212,22 @@ private:
 	 * Check if concurrent phase of the cycle should yield to an external activity. If so, set the flag so that other GC threads react appropriately
 	 */ 
 	MMINLINE bool checkAndSetShouldYieldFlag(MM_EnvironmentStandard *env);
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * Count a read barrier slow path taken by a mutator thread in the thread's own stats.
+	 * @param startTime hi-res time the slow path was entered
+	 */
+	MMINLINE void recordReadObjectBarrierSlowPath(MM_EnvironmentStandard *env, uint64_t startTime);
+
+	/**
+	 * Fold the read barrier slow path counts of every mutator thread into the cycle stats, and feed
+	 * the resulting slowdown to the tuner when -Xgc:concurrentScavengerSlowdownTarget= is set.
+	 * Counts of threads that detached during the cycle are lost.
+	 * @note called at the start of the STW phase ending the cycle
+	 */
+	void mergeMutatorReadBarrierStats(MM_EnvironmentStandard *env);
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	
 	/**
 	 * Check if top level scan loop should be aborted before the work is done
@@ -249,6 +307,57 @@ public:
 	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 	MM_CopyScanCacheStandard *reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 
+	/**
+	 * Determine the NUMA node a space's memory is partitioned to at the specified address. Each space is split into
+	 * _numaCopyNodeCount contiguous, equally sized partitions, the lowest partition belonging to node 1.
+	 * @param address the address to look up (must be within [spaceBase, spaceTop))
+	 * @param spaceBase base of the space
+	 * @param spaceTop top of the space
+	 * @return the node (1-based)
+	 */
+	MMINLINE uintptr_t
+	getNumaCopyNode(void *address, void *spaceBase, void *spaceTop)
+	{
+		uintptr_t spaceSize = (uintptr_t)spaceTop - (uintptr_t)spaceBase;
+		uintptr_t partitionSize = MM_Math::roundToCeiling(_numaCopyPartitionAlignment, (spaceSize + _numaCopyNodeCount - 1) / _numaCopyNodeCount);
+		return (((uintptr_t)address - (uintptr_t)spaceBase) / partitionSize) + 1;
+	}
+
+	/**
+	 * Pick the NUMA node the thread copies into for this cycle: the node it is bound to if that is known, otherwise
+	 * round robin by worker ID. On physical NUMA, unbound GC worker threads are also bound to the selected node.
+	 * @param env the current thread
+	 */
+	void selectNumaCopyNode(MM_EnvironmentStandard *env);
+
+	/**
+	 * Bind the NUMA partitions of the evacuate, survivor and tenure spaces to their physical nodes, if they changed
+	 * since the last bind. Binding only affects pages that are not yet faulted in.
+	 * @param env the main thread
+	 */
+	void bindNumaCopyPartitions(MM_EnvironmentStandard *env);
+
+	/**
+	 * Allocate a copy cache chunk, preferring memory partitioned to the thread's NUMA node. A chunk handed over by
+	 * another node is used first; otherwise chunks allocated from the subspace that belong to another node are
+	 * handed over to that node (a bounded number of times) before settling for remote memory.
+	 * @param env the current thread
+	 * @param tenure true to allocate in tenure space, false for survivor space
+	 * @param allocDescription the allocation description to pass to the subspace
+	 * @param scanCacheSize the desired chunk size
+	 * @param[out] addrBase base of the allocated chunk
+	 * @param[out] addrTop top of the allocated chunk
+	 * @return true if a chunk was allocated
+	 */
+	bool collectorAllocateNumaCopyChunk(MM_EnvironmentStandard *env, bool tenure, MM_AllocateDescription *allocDescription, uintptr_t scanCacheSize, void * &addrBase, void * &addrTop);
+
+	/**
+	 * Abandon all chunks still held in the NUMA copy chunk stashes. Must be called by every thread once
+	 * it has finished copying, and before the heap may be walked.
+	 * @param env the current thread
+	 */
+	void abandonNumaCopyChunks(MM_EnvironmentStandard *env);
+
 	MM_CopyScanCacheStandard *getNextScanCache(MM_EnvironmentStandard *env);
 
 	/**
@@ -279,6 +388,14 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/* Copy the children of a just copied object next to it, if hierarchical copying is enabled.
+	 * Split into two functions hierarchicalCopy and hierarchicalCopyOutline, the enablement checks are inlined into copy().
+	 * @param copyCache The copy cache that received objectPtr
+	 * @param objectPtr The new location of the copied object
+	 */
+	MMINLINE void hierarchicalCopy(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *copyCache, omrobjectptr_t objectPtr);
+	void hierarchicalCopyOutline(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *copyCache, omrobjectptr_t objectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -337,6 +454,35 @@ public:
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
+	/**
+	 * Refill the thread's remembered set fragment, growing the fragment size on each refill
+	 * so threads that remember many objects publish them to the shared list in larger batches.
+	 * @param env Standard Environment
+	 * @return true if the fragment was refilled
+	 */
+	bool refillRememberedSetFragment(MM_EnvironmentStandard *env);
+
+	/**
+	 * Scan the remembered objects recorded in dirty remembered set cards. Remembered bits are not
+	 * adjusted; objects that no longer need remembering are pruned at the end of the scavenge.
+	 * @param env Standard Environment
+	 */
+	void scavengeRememberedSetCards(MM_EnvironmentStandard *env);
+
+	/**
+	 * Verify or clear the remembered objects recorded in dirty remembered set cards, moving those
+	 * that remain remembered back to the remembered set list when it has room.
+	 * @param env Standard Environment
+	 */
+	void pruneRememberedSetCards(MM_EnvironmentStandard *env);
+
+	/**
+	 * Forget the remembered set cards and fall back to the overflow state, for when the cards
+	 * can not be trusted or processed (global collection, back out).
+	 * @param env Standard Environment
+	 */
+	void convertRememberedSetCardsToOverflow(MM_EnvironmentBase *env);
+
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -676,6 +822,11 @@ public:
 
 	MM_ScavengerDelegate* getDelegate() { return &_delegate; }
 
+	/**
+	 * @return the number of threads adaptive GC threading recommends for the next scavenge task, or UDATA_MAX if there is no recommendation
+	 */
+	MMINLINE uintptr_t getRecommendedWorkingThreads() { return _adaptiveThreadCount.getRecommendedThreadCount(); }
+
 	/* Read Barrier Verifier specific methods */
 #if defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS)
 	virtual void scavenger_poisonSlots(MM_EnvironmentBase *env);
@@ -883,6 +1034,8 @@ public:
 		, _delegate(env)
 		, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
 		, _isRememberedSetInOverflowAtTheBeginning(false)
+		, _isRememberedSetInCardStateAtTheBeginning(false)
+		, _rememberedSetCards(NULL)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _doneIndex(0)
@@ -917,6 +1070,13 @@ public:
 		, _heapBase(NULL)
 		, _heapTop(NULL)
 		, _regionManager(regionManager)
+		, _numaCopyNodeCount(0)
+		, _numaCopyChunkStashes(NULL)
+		, _numaCopyPartitionAlignment(0)
+		, _tenureSpaceBase(NULL)
+		, _tenureSpaceTop(NULL)
+		, _adaptiveThreadCount()
+		, _scavengeTaskElapsedTime(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _mainGCThread(env)
 		, _concurrentPhase(concurrent_phase_idle)
@@ -924,12 +1084,16 @@ public:
 		, _concurrentScavengerSwitchCount(0)
 		, _shouldYield(false)
 		, _concurrentPhaseStats()
+		, _concurrentPhaseStartTime(0)
+		, _slowdownTuner()
 #endif /* #if defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 		, _omrVM(env->getOmrVM())
 	{
 		_typeId = __FUNCTION__;
 		_cycleType = OMR_GC_CYCLE_TYPE_SCAVENGE;
+		memset(_numaBoundSpaceBase, 0, sizeof(_numaBoundSpaceBase));
+		memset(_numaBoundSpaceTop, 0, sizeof(_numaBoundSpaceTop));
 	}
 };
 
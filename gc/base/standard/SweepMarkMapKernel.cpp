@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "ut_j9mm.h"
+
+#include "EnvironmentBase.hpp"
+
+#include "SweepMarkMapKernel.hpp"
+
+#if defined(OMR_GC_SWEEP_SIMD_KERNELS)
+#include <immintrin.h>
+#endif /* defined(OMR_GC_SWEEP_SIMD_KERNELS) */
+
+/**
+ * Finish a scan one slot at a time.
+ */
+static MMINLINE uintptr_t *
+findMarkedSlotTail(uintptr_t *markMapCurrent, uintptr_t *markMapTop)
+{
+	while ((markMapCurrent < markMapTop) && (0 == *markMapCurrent)) {
+		markMapCurrent += 1;
+	}
+	return markMapCurrent;
+}
+
+uintptr_t *
+MM_SweepMarkMapKernel::findMarkedSlotScalar(uintptr_t *markMapCurrent, uintptr_t *markMapTop)
+{
+	/* test four slots per iteration to reduce the number of branches */
+	while (4 <= (uintptr_t)(markMapTop - markMapCurrent)) {
+		SWEEP_MARK_MAP_PREFETCH(markMapCurrent + prefetchDistance);
+		if (0 != (markMapCurrent[0] | markMapCurrent[1] | markMapCurrent[2] | markMapCurrent[3])) {
+			break;
+		}
+		markMapCurrent += 4;
+	}
+	return findMarkedSlotTail(markMapCurrent, markMapTop);
+}
+
+#if defined(OMR_GC_SWEEP_SIMD_KERNELS)
+__attribute__((target("sse4.1"))) uintptr_t *
+MM_SweepMarkMapKernel::findMarkedSlotSSE41(uintptr_t *markMapCurrent, uintptr_t *markMapTop)
+{
+	/* test one 64 byte cache line of mark map (four 128-bit blocks) per iteration */
+	const uintptr_t slotsPerIteration = (4 * sizeof(__m128i)) / sizeof(uintptr_t);
+	while (slotsPerIteration <= (uintptr_t)(markMapTop - markMapCurrent)) {
+		SWEEP_MARK_MAP_PREFETCH(markMapCurrent + prefetchDistance);
+		const __m128i *block = (const __m128i *)markMapCurrent;
+		__m128i bits = _mm_or_si128(
+				_mm_or_si128(_mm_loadu_si128(block), _mm_loadu_si128(block + 1)),
+				_mm_or_si128(_mm_loadu_si128(block + 2), _mm_loadu_si128(block + 3)));
+		if (!_mm_testz_si128(bits, bits)) {
+			break;
+		}
+		markMapCurrent += slotsPerIteration;
+	}
+	return findMarkedSlotTail(markMapCurrent, markMapTop);
+}
+
+__attribute__((target("avx2"))) uintptr_t *
+MM_SweepMarkMapKernel::findMarkedSlotAVX2(uintptr_t *markMapCurrent, uintptr_t *markMapTop)
+{
+	/* test one 64 byte cache line of mark map (two 256-bit blocks) per iteration */
+	const uintptr_t slotsPerIteration = (2 * sizeof(__m256i)) / sizeof(uintptr_t);
+	while (slotsPerIteration <= (uintptr_t)(markMapTop - markMapCurrent)) {
+		SWEEP_MARK_MAP_PREFETCH(markMapCurrent + prefetchDistance);
+		const __m256i *block = (const __m256i *)markMapCurrent;
+		__m256i bits = _mm256_or_si256(_mm256_loadu_si256(block), _mm256_loadu_si256(block + 1));
+		if (!_mm256_testz_si256(bits, bits)) {
+			break;
+		}
+		markMapCurrent += slotsPerIteration;
+	}
+	return findMarkedSlotTail(markMapCurrent, markMapTop);
+}
+#endif /* defined(OMR_GC_SWEEP_SIMD_KERNELS) */
+
+#if defined(OMR_GC_SWEEP_SIMD_KERNELS)
+/**
+ * Read the XCR0 extended control register, only valid when OSXSAVE is set.
+ */
+static MMINLINE uint64_t
+readXCR0()
+{
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((uint64_t)edx << 32) | eax;
+}
+#endif /* defined(OMR_GC_SWEEP_SIMD_KERNELS) */
+
+bool
+MM_SweepMarkMapKernel::isSupported(OMRPortLibrary *portLibrary, FindMarkedSlotFunction kernel)
+{
+	if (findMarkedSlotScalar == kernel) {
+		return true;
+	}
+
+#if defined(OMR_GC_SWEEP_SIMD_KERNELS)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRProcessorDesc processorDesc;
+	if (0 == omrsysinfo_get_processor_description(&processorDesc)) {
+		if (findMarkedSlotSSE41 == kernel) {
+			return omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_SSE4_1);
+		}
+		if (findMarkedSlotAVX2 == kernel) {
+			/* YMM registers are only usable if the OS saves them on context switch: XCR0[2:1] enables XMM and YMM state */
+			return omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_AVX2)
+				&& omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_OSXSAVE)
+				&& (0x6 == (readXCR0() & 0x6));
+		}
+	}
+#endif /* defined(OMR_GC_SWEEP_SIMD_KERNELS) */
+
+	return false;
+}
+
+MM_SweepMarkMapKernel::FindMarkedSlotFunction
+MM_SweepMarkMapKernel::selectFindMarkedSlot(MM_EnvironmentBase *env)
+{
+	FindMarkedSlotFunction kernel = findMarkedSlotScalar;
+	const char *kernelName = "scalar";
+
+#if defined(OMR_GC_SWEEP_SIMD_KERNELS)
+	OMRPortLibrary *portLibrary = env->getPortLibrary();
+	if (isSupported(portLibrary, findMarkedSlotAVX2)) {
+		kernel = findMarkedSlotAVX2;
+		kernelName = "avx2";
+	} else if (isSupported(portLibrary, findMarkedSlotSSE41)) {
+		kernel = findMarkedSlotSSE41;
+		kernelName = "sse4.1";
+	}
+#endif /* defined(OMR_GC_SWEEP_SIMD_KERNELS) */
+
+	Trc_MM_SweepMarkMapKernel_selectFindMarkedSlot(env->getLanguageVMThread(), kernelName);
+	return kernel;
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SWEEPMARKMAPKERNEL_HPP_)
+#define SWEEPMARKMAPKERNEL_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "omrport.h"
+
+class MM_EnvironmentBase;
+
+/* The vector kernels rely on per-function target attributes, so they are only built with GCC compatible compilers */
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+#define OMR_GC_SWEEP_SIMD_KERNELS
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+#if defined(__GNUC__)
+#define SWEEP_MARK_MAP_PREFETCH(address) __builtin_prefetch((const void *)(address))
+#else /* defined(__GNUC__) */
+#define SWEEP_MARK_MAP_PREFETCH(address)
+#endif /* defined(__GNUC__) */
+
+/**
+ * Mark map scanning kernels used by the sweep to skip over runs of free memory.
+ *
+ * A kernel returns the first mark map slot in a range that has any bit set. Large free runs
+ * are skipped a cache line of mark map at a time using the widest vector test the processor
+ * supports; the kernel is chosen once at startup.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_SweepMarkMapKernel
+{
+/* Data members / types */
+public:
+	/**
+	 * Find the first non-empty mark map slot.
+	 * @param markMapCurrent[in] First slot to examine
+	 * @param markMapTop[in] Slot past the end of the range
+	 * @return the first slot in [markMapCurrent, markMapTop) that is not empty, or markMapTop if there is none
+	 */
+	typedef uintptr_t *(*FindMarkedSlotFunction)(uintptr_t *markMapCurrent, uintptr_t *markMapTop);
+
+	enum {
+		prefetchDistance = 256 / sizeof(uintptr_t) /**< Number of slots (four cache lines) to prefetch ahead of the scan */
+	};
+
+protected:
+private:
+
+/* Methods */
+public:
+	/**
+	 * Select the fastest kernel supported by the current processor.
+	 * @param env[in] The current thread
+	 * @return the kernel to use for the lifetime of the sweep scheme
+	 */
+	static FindMarkedSlotFunction selectFindMarkedSlot(MM_EnvironmentBase *env);
+
+	/**
+	 * Check whether the current processor and operating system can run a kernel.
+	 * @param portLibrary[in] The port library
+	 * @param kernel[in] One of the findMarkedSlot kernels
+	 * @return true if the kernel can be used
+	 */
+	static bool isSupported(OMRPortLibrary *portLibrary, FindMarkedSlotFunction kernel);
+
+	static uintptr_t *findMarkedSlotScalar(uintptr_t *markMapCurrent, uintptr_t *markMapTop);
+#if defined(OMR_GC_SWEEP_SIMD_KERNELS)
+	static uintptr_t *findMarkedSlotSSE41(uintptr_t *markMapCurrent, uintptr_t *markMapTop);
+	static uintptr_t *findMarkedSlotAVX2(uintptr_t *markMapCurrent, uintptr_t *markMapTop);
+#endif /* defined(OMR_GC_SWEEP_SIMD_KERNELS) */
+
+protected:
+private:
+};
+
+#endif /* SWEEPMARKMAPKERNEL_HPP_ */
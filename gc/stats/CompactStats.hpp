@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -58,6 +58,11 @@ public:
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+
+	bool _incremental; /**< True if the compaction only evacuated the sub areas selected for this increment */
+	uintptr_t _incrementSubAreas; /**< Number of sub areas evacuated by the increment */
+	uintptr_t _incrementBytes; /**< Size of the sub areas evacuated by the increment */
+	uintptr_t _incrementPendingSubAreas; /**< Number of fragmented sub areas left for later increments */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -75,6 +75,13 @@ class MM_ConcurrentGCStats : public MM_Base
 	
 	ConcurrentKickoffReason _kickoffReason; /**< a constant indicating why kickoff occured */
 	ConcurrentCardCleaningReason _cardCleaningReason; /**< a constant indicating why card cleaning was kicked off */
+
+	/* The following statistics report the decisions of the concurrent mark pacer and are not reset between cycles */
+	float _pacerKickoffBoost; /**< factor applied to the kickoff threshold for the current cycle */
+	float _pacerTraceRate; /**< tracing rate (bytes traced per byte allocated) required to complete the mark at the last pacer update */
+	float _pacerConHelperTraceRate; /**< bytes traced by concurrent helpers per byte allocated, as estimated at the last pacer update */
+	uintptr_t _pacerAllocationRate; /**< bytes allocated per millisecond since kickoff, as estimated at the last pacer update */
+	uintptr_t _pacerFreeAtExhaustion; /**< free bytes remaining when tracing was exhausted in the last completed cycle */
 	
 public:
 	static const char* getConcurrentStatusString(MM_EnvironmentBase *env, uintptr_t status, char *statusBuffer, uintptr_t statusBufferLength);
@@ -213,6 +220,17 @@ public:
 	
 	MMINLINE void setCardCleaningReason(ConcurrentCardCleaningReason reason) { _cardCleaningReason = reason; };
 	MMINLINE ConcurrentCardCleaningReason getCardCleaningReason() { return _cardCleaningReason; };
+
+	MMINLINE float getPacerKickoffBoost() { return _pacerKickoffBoost; };
+	MMINLINE void setPacerKickoffBoost(float boost) { _pacerKickoffBoost = boost; };
+	MMINLINE float getPacerTraceRate() { return _pacerTraceRate; };
+	MMINLINE void setPacerTraceRate(float rate) { _pacerTraceRate = rate; };
+	MMINLINE float getPacerConHelperTraceRate() { return _pacerConHelperTraceRate; };
+	MMINLINE void setPacerConHelperTraceRate(float rate) { _pacerConHelperTraceRate = rate; };
+	MMINLINE uintptr_t getPacerAllocationRate() { return _pacerAllocationRate; };
+	MMINLINE void setPacerAllocationRate(uintptr_t rate) { _pacerAllocationRate = rate; };
+	MMINLINE uintptr_t getPacerFreeAtExhaustion() { return _pacerFreeAtExhaustion; };
+	MMINLINE void setPacerFreeAtExhaustion(uintptr_t free) { _pacerFreeAtExhaustion = free; };
 	
 	MMINLINE void reset()
 	{
@@ -264,7 +282,12 @@ public:
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
 		_kickoffReason(NO_KICKOFF_REASON),
-		_cardCleaningReason(CARD_CLEANING_REASON_NONE)
+		_cardCleaningReason(CARD_CLEANING_REASON_NONE),
+		_pacerKickoffBoost(0.0),
+		_pacerTraceRate(0.0),
+		_pacerConHelperTraceRate(0.0),
+		_pacerAllocationRate(0),
+		_pacerFreeAtExhaustion(0)
 	{}
 
 };
@@ -36,6 +36,10 @@ MM_MarkStats::clear()
 	_objectsScanned = 0;
 	_bytesScanned = 0;
 
+	_gcThreadCount = 0;
+	_recommendedThreadCount = UDATA_MAX;
+	_parallelEfficiency = 0.0f;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
 	_syncStallTime = 0;
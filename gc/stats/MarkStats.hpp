@@ -56,6 +56,10 @@ public:
 	uintptr_t _splitArraysAmount;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	uintptr_t _gcThreadCount; /**< Number of threads that participated in the mark task */
+	uintptr_t _recommendedThreadCount; /**< Number of threads recommended for the next mark by adaptive GC threading (UDATA_MAX if none) */
+	float _parallelEfficiency; /**< Fraction (0.0 - 1.0) of the mark thread time not spent stalled */
+
 	uint64_t _startTime;	/**< Mark start time */
 	uint64_t _endTime;		/**< Mark end time */
 
@@ -116,6 +120,9 @@ public:
 		,_splitArraysProcessed(0)
 		,_splitArraysAmount(0)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		,_gcThreadCount(0)
+		,_recommendedThreadCount(UDATA_MAX)
+		,_parallelEfficiency(0.0f)
 		,_startTime(0)
 		,_endTime(0)
 	{
@@ -84,16 +84,32 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_semiSpaceAllocationCountSmall(0)
 	,_tenureSpaceAllocationCountLarge(0)
 	,_tenureSpaceAllocationCountSmall(0)
+	,_numaLocalCopyCacheCount(0)
+	,_numaRemoteCopyCacheCount(0)
+	,_numaDonatedChunkCount(0)
+	,_gcThreadCount(0)
+	,_recommendedThreadCount(UDATA_MAX)
+	,_parallelEfficiency(0.0f)
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
+	,_hierarchicalCopyCount(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
+	,_readObjectBarrierSlowPathScan(0)
+	,_readObjectBarrierSlowPathComplete(0)
+	,_readObjectBarrierSlowPathTime(0)
+	,_readObjectBarrierSlowPathMaxThreadTime(0)
+	,_readObjectBarrierSlowPathThreads(0)
+	,_mutatorSlowdown(0.0f)
+	,_concurrentThreadCount(0)
+	,_recommendedConcurrentThreadCount(UDATA_MAX)
+	,_concurrentYieldToMutators(false)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	,_flipHistoryNewIndex(0)
 {
@@ -188,6 +204,14 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureSpaceAllocationCountLarge = 0;
 	_tenureSpaceAllocationCountSmall = 0;
 
+	_numaLocalCopyCacheCount = 0;
+	_numaRemoteCopyCacheCount = 0;
+	_numaDonatedChunkCount = 0;
+
+	_gcThreadCount = 0;
+	_recommendedThreadCount = UDATA_MAX;
+	_parallelEfficiency = 0.0f;
+
 	_tenureExpandedBytes = 0;
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
@@ -198,9 +222,19 @@ MM_ScavengerStats::clear(bool firstIncrement)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	_readObjectBarrierCopy = 0;
 	_readObjectBarrierUpdate = 0;
+	_readObjectBarrierSlowPathScan = 0;
+	_readObjectBarrierSlowPathComplete = 0;
+	_readObjectBarrierSlowPathTime = 0;
+	_readObjectBarrierSlowPathMaxThreadTime = 0;
+	_readObjectBarrierSlowPathThreads = 0;
+	_mutatorSlowdown = 0.0f;
+	_concurrentThreadCount = 0;
+	_recommendedConcurrentThreadCount = UDATA_MAX;
+	_concurrentYieldToMutators = false;
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	_leafObjectCount = 0;
+	_hierarchicalCopyCount = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
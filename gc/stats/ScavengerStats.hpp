@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -128,11 +128,20 @@ public:
 	uintptr_t _tenureSpaceAllocationCountLarge;
 	uintptr_t _tenureSpaceAllocationCountSmall;
 
+	uintptr_t _numaLocalCopyCacheCount; /**< Copy caches refreshed with memory partitioned to the copying thread's NUMA node */
+	uintptr_t _numaRemoteCopyCacheCount; /**< Copy caches refreshed with memory partitioned to another NUMA node */
+	uintptr_t _numaDonatedChunkCount; /**< Copy cache chunks handed over to the NUMA node they are partitioned to */
+
+	uintptr_t _gcThreadCount; /**< Number of threads that participated in the scavenge task */
+	uintptr_t _recommendedThreadCount; /**< Number of threads recommended for the next scavenge by adaptive GC threading (UDATA_MAX if none) */
+	float _parallelEfficiency; /**< Fraction (0.0 - 1.0) of the scavenge thread time not spent stalled */
+
 	uintptr_t _tenureExpandedBytes; /**< Bytes by which the heap expanded in order to complete the collection */
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
 	uint64_t _leafObjectCount;
+	uint64_t _hierarchicalCopyCount; /**< Objects copied next to their parent by hierarchical copying, ahead of the scan */
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
@@ -143,6 +152,15 @@ public:
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
 	uint64_t _readObjectBarrierUpdate; /**< Number of reference slots updates, which may be (often is) preceded by object copy */ 
+	uint64_t _readObjectBarrierSlowPathScan; /**< Number of read barrier slow path hits by mutators while the concurrent scan was in progress */
+	uint64_t _readObjectBarrierSlowPathComplete; /**< Number of read barrier slow path hits by mutators after the concurrent scan ran out of work */
+	uint64_t _readObjectBarrierSlowPathTime; /**< Time, in hi-res ticks, mutators spent in the read barrier slow path */
+	uint64_t _readObjectBarrierSlowPathMaxThreadTime; /**< Largest time, in hi-res ticks, a single mutator spent in the read barrier slow path */
+	uintptr_t _readObjectBarrierSlowPathThreads; /**< Number of mutator threads that hit the read barrier slow path */
+	float _mutatorSlowdown; /**< Share (in percent) of the concurrent phase the most affected mutator spent in the read barrier slow path */
+	uintptr_t _concurrentThreadCount; /**< Number of background threads the concurrent phase was started with */
+	uintptr_t _recommendedConcurrentThreadCount; /**< Number of background threads recommended for the next concurrent phase by the slowdown tuner (UDATA_MAX if none) */
+	bool _concurrentYieldToMutators; /**< true if background threads of the next concurrent phase yield the CPU to mutators between copy caches */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 protected:
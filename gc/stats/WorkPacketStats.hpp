@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -51,6 +51,8 @@ public:
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
+	uintptr_t workPacketsStolen; /**< The number of input packets taken from another thread's work-stealing deque */
+	uintptr_t _stealIdleCount; /**< The number of steal attempts that found every work-stealing deque empty */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 protected:
@@ -73,6 +75,8 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workPacketsStolen = 0;
+		_stealIdleCount = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +95,8 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workPacketsStolen += statsToMerge->workPacketsStolen;
+		_stealIdleCount += statsToMerge->_stealIdleCount;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -121,6 +127,20 @@ public:
 		_completeStallTime += (endTime - startTime);
 	}
 	
+	/**
+	 * Record the outcome of an attempt to steal a packet from another thread's deque
+	 * @param stolen true if a packet was stolen, false if no deque had a packet to steal
+	 */
+	MMINLINE void
+	addStealAttempt(bool stolen)
+	{
+		if (stolen) {
+			workPacketsStolen += 1;
+		} else {
+			_stealIdleCount += 1;
+		}
+	}
+
 	/**
 	 * Get the total stall time
 	 * @return the time in hi-res ticks
@@ -151,6 +171,8 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,workPacketsStolen(0)
+		,_stealIdleCount(0)
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -84,6 +84,8 @@ MM_SublistPool::freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list)
 
 /**
  * Allocate a new puddle for the current sublist pool.
+ * The size of the puddle is reserved against the maximum size of the pool with an atomic update, so
+ * the call is safe while other threads are growing the pool.
  * 
  * @return The newly allocated puddle if successful, NULL otherwise.
  * 
@@ -92,30 +94,37 @@ MM_SublistPool::freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list)
 MM_SublistPuddle *
 MM_SublistPool::createNewPuddle(MM_EnvironmentBase *env)
 {
-	uintptr_t puddleSize;
+	uintptr_t puddleSize = 0;
+	uintptr_t oldSize = 0;
 
-	/* If the sublist has a maximum size, be sure we aren't attempting to grow beyond it */
-	if(_maxSize) {
-		puddleSize = _maxSize - _currentSize;
-		if(0 == puddleSize) {
-			return NULL;
-		}
-		/* If the available size to grow is greater than the suggested size, reduce */
-		if(puddleSize > _growSize) {
+	do {
+		oldSize = _currentSize;
+
+		/* If the sublist has a maximum size, be sure we aren't attempting to grow beyond it */
+		if(_maxSize) {
+			puddleSize = _maxSize - oldSize;
+			/* If the available size to grow is greater than the suggested size, reduce */
+			if(puddleSize > _growSize) {
+				puddleSize = _growSize;
+			}
+		} else {
+			/* No limit on the grow size - use the suggested grow size */
 			puddleSize = _growSize;
 		}
-	} else {
-		/* No limit on the grow size - use the suggested grow size */
-		puddleSize = _growSize;
-	}
 
-	/* Check that the determined grow size is valid */
-	if(0 == puddleSize) {
-		return NULL;
-	}
+		/* Check that the determined grow size is valid */
+		if(0 == puddleSize) {
+			return NULL;
+		}
+	} while(oldSize != MM_AtomicOperations::lockCompareExchange(&_currentSize, oldSize, oldSize + puddleSize));
 
 	/* Get a new puddle to add to the sublist pool */
-	return MM_SublistPuddle::newInstance(env, puddleSize, this, _allocCategory);	
+	MM_SublistPuddle *puddle = MM_SublistPuddle::newInstance(env, puddleSize, this, _allocCategory);
+	if(NULL == puddle) {
+		/* Give back the reserved size */
+		MM_AtomicOperations::subtract(&_currentSize, puddleSize);
+	}
+	return puddle;
 }
 
 /**
@@ -123,93 +132,98 @@ MM_SublistPool::createNewPuddle(MM_EnvironmentBase *env)
  * Reserve memory from the sublist and update the fragment.  If there is no room available
  * in the current sublist memory, allocate a new sublist puddle (until the maximum sublist size is reached).
  * 
+ * Refilling is lock free: threads walk forward from the allocation puddle, helping to advance it past
+ * exhausted puddles, and a thread that finds the tail exhausted creates a private puddle, carves its own
+ * fragment from it and then publishes it at the tail of the list with a single compare and swap.
+ * The pool lock is only taken to install the very first puddle, which must be coordinated with
+ * #popPreviousPuddle().
+ * 
  * @return true if the fragment allocate is successful, false otherwise.
  */
 bool
 MM_SublistPool::allocate(MM_EnvironmentBase *env, MM_SublistFragment *fragment)
 {
-	uintptr_t puddleSize = 0;
-	MM_SublistPuddle *emptyPuddle = NULL;
+	MM_SublistPuddle *allocPuddle = _allocPuddle;
 
-	/* Attempt to allocate a fragment from the current allocation puddle. If successful, we are done. */
-	if(_allocPuddle && _allocPuddle->allocate(fragment)) {
-		return true;
+	/* Attempt to allocate a fragment from the allocation puddle or from any puddle published after it */
+	while (NULL != allocPuddle) {
+		if (allocPuddle->allocate(fragment)) {
+			return true;
+		}
+		MM_SublistPuddle *next = allocPuddle->getNext();
+		if (NULL == next) {
+			break;
+		}
+		/* The puddle is exhausted - help move the allocation puddle forward (losing the race is fine) */
+		MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_allocPuddle, (uintptr_t)allocPuddle, (uintptr_t)next);
+		allocPuddle = next;
 	}
 
-	/* No new fragment is available.  Lock the sublist and allocate a new puddle */
-	omrthread_monitor_enter(_mutex);
+	if (NULL == allocPuddle) {
+		return allocateFirstPuddle(env, fragment);
+	}
 
-	/* Another thread may have allocated a puddle while attempting to get the lock
-	 * Check by attempting to allocate the puddle again 
+	/* Every published puddle is exhausted - build a new one privately */
+	MM_SublistPuddle *emptyPuddle = createNewPuddle(env);
+	if (NULL == emptyPuddle) {
+		return false;
+	}
+	Assert_MM_true(emptyPuddle->isEmpty());
+	Assert_MM_true(NULL == emptyPuddle->getNext());
+
+	/* Allocate the fragment from the puddle. We are guaranteed to succeed because
+	 * other threads don't have access to it yet
 	 */
-	if(_allocPuddle && _allocPuddle->allocate(fragment)) {
-		omrthread_monitor_exit(_mutex);
-		return true;
+	bool mustSucceed = emptyPuddle->allocate(fragment);
+	Assert_MM_true(mustSucceed);
+
+	/* Now that we have allocated our fragment, it is safe to expose the puddle to the rest of the VM.
+	 * Other threads may be publishing puddles concurrently, so append at the true tail of the list.
+	 */
+	MM_SublistPuddle *tail = allocPuddle;
+	while (!tail->atomicSetNext(emptyPuddle)) {
+		tail = tail->getNext();
 	}
 
-	/* Are there any puddles past the alloc puddle? */
-	if (_allocPuddle && _allocPuddle->getNext()) {
-		/* Yes - it's guaranteed to be empty */
-		emptyPuddle = _allocPuddle->getNext();
-		Assert_MM_true(NULL != emptyPuddle);
-		Assert_MM_true(emptyPuddle->isEmpty());
-	} else {
-		/* No - we need to allocate a new puddle */
+	/* Advance the allocation puddle if nobody has moved it past our predecessor yet */
+	MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_allocPuddle, (uintptr_t)tail, (uintptr_t)emptyPuddle);
 
-		/* If the sublist has a maximum size, be sure we aren't attempting to grow beyond it */
-		if(_maxSize) {
-			puddleSize = _maxSize - _currentSize;
-			if(0 == puddleSize) {
-				omrthread_monitor_exit(_mutex);
-				return false;
-			}
-			/* If the available size to grow is greater than the suggested size, reduce */
-			if(puddleSize > _growSize) {
-				puddleSize = _growSize;
-			}
-		} else {
-			/* No limit on the grow size - use the suggested grow size */
-			puddleSize = _growSize;
-		}
-	
-		/* Check that the determined grow size is valid */
-		if(0 == puddleSize) {
-			omrthread_monitor_exit(_mutex);
-			return false;
-		}
-	
-		/* Get a new puddle to add to the sublist pool */
-		if(NULL == (emptyPuddle = MM_SublistPuddle::newInstance(env, puddleSize, this, _allocCategory))) {
-			omrthread_monitor_exit(_mutex);
-			return false;
-		}
-		Assert_MM_true(emptyPuddle->isEmpty());
-		Assert_MM_true(NULL == emptyPuddle->getNext());
-	 	_currentSize += emptyPuddle->totalSize();
+	return true;
+}
+
+/**
+ * Install the first puddle of an empty sublist and allocate a fragment from it.
+ * The list head and the allocation puddle are also updated by #popPreviousPuddle() so the lock is
+ * required here.
+ * 
+ * @return true if the fragment allocate is successful, false otherwise.
+ */
+bool
+MM_SublistPool::allocateFirstPuddle(MM_EnvironmentBase *env, MM_SublistFragment *fragment)
+{
+	omrthread_monitor_enter(_mutex);
+
+	/* Another thread may have installed a puddle while we were attempting to get the lock */
+	if (NULL != _allocPuddle) {
+		omrthread_monitor_exit(_mutex);
+		return allocate(env, fragment);
 	}
- 
- 	/* Allocate the fragment from the puddle. We are guaranteed to succeed because
- 	 * other threads don't have access yet -- either because it's new, or because
- 	 * they can't allocate from anything other than _allocPuddle
- 	 */
-	bool mustSucceed = emptyPuddle->allocate(fragment);
- 	Assert_MM_true(mustSucceed);
-
- 	/* Now that we have allocated our fragment, it is safe to expose the puddle to the rest of the VM */
-	if (NULL == _list) {
-		/* This is the first puddle. Make it the head of the list. */
-		/* (The list is empty, so there must not be an _allocPuddle) */
-		Assert_MM_true(NULL == _allocPuddle);
-		_list = emptyPuddle;
-	} else {
-		/* Add this puddle to the tail of the list */
-		/* (The list is non-empty so there must be an _allocPuddle) */
-		Assert_MM_true(NULL != _allocPuddle);
-		Assert_MM_true(NULL == _allocPuddle->getNext());
-		_allocPuddle->setNext(emptyPuddle);
+
+	/* The list is empty, so a new puddle is required */
+	Assert_MM_true(NULL == _list);
+	MM_SublistPuddle *emptyPuddle = createNewPuddle(env);
+	if (NULL == emptyPuddle) {
+		omrthread_monitor_exit(_mutex);
+		return false;
 	}
+
+	bool mustSucceed = emptyPuddle->allocate(fragment);
+	Assert_MM_true(mustSucceed);
+
+	/* This is the first puddle. Make it the head of the list before it becomes visible to lock free allocators */
+	_list = emptyPuddle;
+	MM_AtomicOperations::storeSync();
 	_allocPuddle = emptyPuddle;
-	Assert_MM_true(NULL == _allocPuddle->getNext());
 
 	omrthread_monitor_exit(_mutex);
 
@@ -229,31 +243,30 @@ MM_SublistPool::allocateElementNoContention(MM_EnvironmentBase *env)
 	uintptr_t *element;
 	MM_SublistPuddle *emptyPuddle;
 
-	/* Allocate a new fragment from the current alloc puddle (if successful, we are done) */
-	if(_allocPuddle && (NULL != (element = _allocPuddle->allocateElementNoContention()))) {
-		return element;
+	/* Allocate a new fragment from the current alloc puddle, or from any puddle published after it
+	 * (if successful, we are done)
+	 */
+	while(NULL != _allocPuddle) {
+		if(NULL != (element = _allocPuddle->allocateElementNoContention())) {
+			return element;
+		}
+		if(NULL == _allocPuddle->getNext()) {
+			break;
+		}
+		_allocPuddle = _allocPuddle->getNext();
 	}
 
-	/* Any puddles past the alloc puddle are guaranteed to
-	 * be empty. Attempt to use one of those puddles before
-	 * creating a new one.
-	 */	
-	if(_allocPuddle && _allocPuddle->getNext()) {
-		emptyPuddle = _allocPuddle->getNext();	
-	} else {
-		/* No new fragment is available.  Allocate a new puddle */
-		if(NULL == (emptyPuddle = createNewPuddle(env))) {
-			return NULL;
-		}
-		_currentSize += emptyPuddle->totalSize();		
+	/* No new fragment is available.  Allocate a new puddle */
+	if(NULL == (emptyPuddle = createNewPuddle(env))) {
+		return NULL;
+	}
 
-		/* Link the new puddle into the list */
-		if (_allocPuddle) {
-			_allocPuddle->setNext(emptyPuddle);	
-		}
-		if (_list == NULL) {
-			_list = emptyPuddle;	
-		}
+	/* Link the new puddle into the list */
+	if (_allocPuddle) {
+		_allocPuddle->setNext(emptyPuddle);	
+	}
+	if (_list == NULL) {
+		_list = emptyPuddle;	
 	}
 	
  	_allocPuddle = emptyPuddle;
@@ -407,11 +420,17 @@ MM_SublistPool::startProcessingSublist()
 	Assert_MM_true(NULL == _previousList);
 	_previousList = _list;
 
+	/* The allocation puddle may lag behind puddles published by lock free allocators: split the
+	 * list after the last non-empty puddle so that only empty puddles remain for allocation
+	 */
 	MM_SublistPuddle* tail = _allocPuddle;
 	if (NULL == tail) {
 		_list = NULL;
 		_allocPuddle = NULL;
 	} else {
+		while ((NULL != tail->getNext()) && !tail->getNext()->isEmpty()) {
+			tail = tail->getNext();
+		}
 		_list = tail->getNext();
 		tail->setNext(NULL);
 		_allocPuddle = _list;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -56,10 +56,10 @@ class MM_SublistPool
  */
 private:
 	MM_SublistPuddle *_list;
-	MM_SublistPuddle *_allocPuddle;
+	MM_SublistPuddle * volatile _allocPuddle; /**< Puddle fragments are allocated from; advanced without locking once exhausted */
 	omrthread_monitor_t _mutex;
 	uintptr_t _growSize;
-	uintptr_t _currentSize;
+	volatile uintptr_t _currentSize;
 	uintptr_t _maxSize;
 	volatile uintptr_t _count; /**< A count for number of elements across all sublistPuddles */
 	OMR::GC::AllocationCategory::Enum _allocCategory;
@@ -74,6 +74,7 @@ public:
  */
 private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
+	bool allocateFirstPuddle(MM_EnvironmentBase *env, MM_SublistFragment *fragment);
 	void freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list);
 
 protected:
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -55,7 +55,7 @@ class MM_SublistPuddle
 private:
 	MM_SublistPool *_parent;
 		
-	MM_SublistPuddle *_next;
+	MM_SublistPuddle * volatile _next;
 	uintptr_t *_listBase;
 	uintptr_t * volatile _listCurrent;
 	uintptr_t *_listTop;
@@ -94,6 +94,16 @@ public:
 	MMINLINE MM_SublistPuddle *getNext() { return _next; }
 	MMINLINE void setNext(MM_SublistPuddle *next) { _next = next; }
 
+	/**
+	 * Atomically link a puddle after the receiver if it is still the tail of its list.
+	 * @return true if the puddle was linked, false if another puddle was linked first
+	 */
+	MMINLINE bool
+	atomicSetNext(MM_SublistPuddle *next)
+	{
+		return NULL == (MM_SublistPuddle *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_next, (uintptr_t)NULL, (uintptr_t)next);
+	}
+
 	MM_SublistPuddle() {}
 
 	friend class GC_SublistIterator;
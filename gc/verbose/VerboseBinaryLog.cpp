@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "VerboseBinaryLog.hpp"
+
+const char *
+MM_VerboseBinaryLog::parseConversion(const char *format, uint8_t *kind)
+{
+	const char *cursor = format + 1;
+
+	if ('%' == *cursor) {
+		*kind = 0;
+		return cursor + 1;
+	}
+
+	/* flags, width and precision */
+	while ((NULL != strchr("-+ #0", *cursor)) && ('\0' != *cursor)) {
+		cursor += 1;
+	}
+	while (('0' <= *cursor) && ('9' >= *cursor)) {
+		cursor += 1;
+	}
+	if ('.' == *cursor) {
+		cursor += 1;
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+	}
+
+	/* length modifier */
+	uint8_t integerKind = VERBOSE_BINARY_ARG_INT;
+	switch (*cursor) {
+	case 'h':
+		cursor += ('h' == cursor[1]) ? 2 : 1;
+		break;
+	case 'l':
+		if ('l' == cursor[1]) {
+			integerKind = VERBOSE_BINARY_ARG_LONG_LONG;
+			cursor += 2;
+		} else {
+			integerKind = VERBOSE_BINARY_ARG_LONG;
+			cursor += 1;
+		}
+		break;
+	case 'L':
+	case 'j':
+		integerKind = VERBOSE_BINARY_ARG_LONG_LONG;
+		cursor += 1;
+		break;
+	case 'z':
+	case 't':
+		integerKind = VERBOSE_BINARY_ARG_SIZE;
+		cursor += 1;
+		break;
+	default:
+		break;
+	}
+
+	/* conversion */
+	switch (*cursor) {
+	case 'd':
+	case 'i':
+	case 'u':
+	case 'x':
+	case 'X':
+	case 'o':
+	case 'c':
+		*kind = integerKind;
+		break;
+	case 'f':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+		*kind = VERBOSE_BINARY_ARG_DOUBLE;
+		break;
+	case 'p':
+		*kind = VERBOSE_BINARY_ARG_POINTER;
+		break;
+	case 's':
+		*kind = VERBOSE_BINARY_ARG_STRING;
+		break;
+	default:
+		/* '*', 'n' and anything the port library does not know */
+		return NULL;
+	}
+
+	return cursor + 1;
+}
+
+bool
+MM_VerboseBinaryLog::parseFormat(const char *format, uint8_t *kinds, uintptr_t *argCount)
+{
+	uintptr_t count = 0;
+	const char *cursor = format;
+
+	while (NULL != (cursor = strchr(cursor, '%'))) {
+		uint8_t kind = 0;
+		cursor = parseConversion(cursor, &kind);
+		if (NULL == cursor) {
+			return false;
+		}
+		if (0 != kind) {
+			if (VERBOSE_BINARY_LOG_MAX_ARGUMENTS == count) {
+				return false;
+			}
+			kinds[count] = kind;
+			count += 1;
+		}
+	}
+
+	*argCount = count;
+	return true;
+}
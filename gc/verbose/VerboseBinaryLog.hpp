@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYLOG_HPP_)
+#define VERBOSEBINARYLOG_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgcconsts.h"
+
+/**
+ * @name Binary verbose GC log layout
+ * A binary log starts with an MM_VerboseBinaryLogHeader followed by the GC version string, and continues
+ * with MM_VerboseBinaryLogRecord records. Every record is a multiple of VERBOSE_BINARY_LOG_ALIGNMENT
+ * bytes. Scalar arguments of an event take one 8 byte slot each, string arguments a slot holding the
+ * length including the NUL (VERBOSE_BINARY_LOG_NULL_STRING for a NULL string) followed by the bytes.
+ * @{
+ */
+#define VERBOSE_BINARY_LOG_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_LOG_VERSION 1
+#define VERBOSE_BINARY_LOG_BYTE_ORDER 0x01020304
+#define VERBOSE_BINARY_LOG_ALIGNMENT 8
+#define VERBOSE_BINARY_LOG_SLOT_SIZE 8
+#define VERBOSE_BINARY_LOG_NULL_STRING ((uint64_t)-1)
+#define VERBOSE_BINARY_LOG_MAX_ARGUMENTS 32 /**< Formats taking more arguments are formatted when recorded */
+#define VERBOSE_BINARY_LOG_MAX_FORMATS 512 /**< Format ids are 1 to VERBOSE_BINARY_LOG_MAX_FORMATS */
+
+typedef enum {
+	VERBOSE_BINARY_RECORD_FORMAT = 1, /**< Defines formatId, payload is the NUL terminated format string */
+	VERBOSE_BINARY_RECORD_EVENT = 2, /**< A line produced by formatId from argCount recorded arguments */
+	VERBOSE_BINARY_RECORD_TEXT = 3, /**< NUL terminated text output as is, without indentation or newline */
+	VERBOSE_BINARY_RECORD_ROTATE = 4, /**< The writer moves on to file formatId, never written to a file */
+	VERBOSE_BINARY_RECORD_PAD = 5 /**< Fills the end of the writer's ring buffer, never written to a file */
+} VerboseBinaryRecordType;
+
+typedef enum {
+	VERBOSE_BINARY_ARG_INT = 1, /**< int, including char and short conversions */
+	VERBOSE_BINARY_ARG_LONG, /**< l modifier */
+	VERBOSE_BINARY_ARG_LONG_LONG, /**< ll, L and j modifiers */
+	VERBOSE_BINARY_ARG_SIZE, /**< z and t modifiers, recorded as uintptr_t */
+	VERBOSE_BINARY_ARG_DOUBLE,
+	VERBOSE_BINARY_ARG_POINTER,
+	VERBOSE_BINARY_ARG_STRING
+} VerboseBinaryArgumentKind;
+
+typedef struct MM_VerboseBinaryLogHeader {
+	char magic[8]; /**< VERBOSE_BINARY_LOG_MAGIC */
+	uint32_t version; /**< VERBOSE_BINARY_LOG_VERSION */
+	uint32_t byteOrder; /**< VERBOSE_BINARY_LOG_BYTE_ORDER in the byte order of the writer */
+	uint32_t pointerSize; /**< sizeof(void *) of the writer */
+	uint32_t gcVersionLength; /**< Bytes of GC version string following the header, including the NUL and padding */
+} MM_VerboseBinaryLogHeader;
+
+typedef struct MM_VerboseBinaryLogRecord {
+	uint16_t type; /**< VerboseBinaryRecordType */
+	uint16_t indent; /**< Indentation level of the line */
+	uint32_t size; /**< Bytes in the record, including this header */
+	uint32_t formatId; /**< Format of an event or the format defined */
+	uint32_t argCount; /**< Arguments recorded for an event, or taken by the format defined */
+} MM_VerboseBinaryLogRecord;
+/** @} */
+
+/**
+ * Helpers shared by the binary verbose writer and the converter back to XML.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseBinaryLog
+{
+public:
+	/**
+	 * Round a record or payload size up to the record alignment.
+	 */
+	static MMINLINE uintptr_t
+	align(uintptr_t size)
+	{
+		return (size + (VERBOSE_BINARY_LOG_ALIGNMENT - 1)) & ~(uintptr_t)(VERBOSE_BINARY_LOG_ALIGNMENT - 1);
+	}
+
+	/**
+	 * Find the arguments consumed by a printf style format.
+	 * @param format the format to parse
+	 * @param[out] kinds the VerboseBinaryArgumentKind of each argument, in order
+	 * @param[out] argCount the number of arguments
+	 * @return false if the format uses a conversion that can not be recorded or takes more than
+	 * VERBOSE_BINARY_LOG_MAX_ARGUMENTS arguments
+	 */
+	static bool parseFormat(const char *format, uint8_t *kinds, uintptr_t *argCount);
+
+	/**
+	 * Find the end of the conversion specification starting at the '%' at format. Widths and precisions
+	 * taken from the argument list ('*') can not be recorded.
+	 * @param format a conversion specification
+	 * @param[out] kind the VerboseBinaryArgumentKind of the argument consumed, 0 for "%%"
+	 * @return the character following the specification, or NULL if it can not be recorded
+	 */
+	static const char *parseConversion(const char *format, uint8_t *kind);
+};
+
+#endif /* VERBOSEBINARYLOG_HPP_ */
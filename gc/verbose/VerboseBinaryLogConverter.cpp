@@ -0,0 +1,268 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "VerboseBinaryLogConverter.hpp"
+
+#include "VerboseBuffer.hpp"
+#include "VerboseWriter.hpp"
+
+#define VERBOSE_BINARY_CONVERSION_MAX_LENGTH 32
+
+bool
+MM_VerboseBinaryLogConverter::convert(OMRPortLibrary *portLibrary, const char *binaryFilename, const char *xmlFilename)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t size = 0;
+	bool result = false;
+
+	uint8_t *log = readFile(portLibrary, binaryFilename, &size);
+	if (NULL == log) {
+		return false;
+	}
+
+	MM_VerboseBinaryLogHeader *header = (MM_VerboseBinaryLogHeader *)log;
+	if ((sizeof(MM_VerboseBinaryLogHeader) <= size)
+		&& (0 == memcmp(header->magic, VERBOSE_BINARY_LOG_MAGIC, sizeof(header->magic)))
+		&& (VERBOSE_BINARY_LOG_VERSION == header->version)
+		&& (VERBOSE_BINARY_LOG_BYTE_ORDER == header->byteOrder)
+		&& (sizeof(void *) == header->pointerSize)
+		&& (0 != header->gcVersionLength)
+		&& (header->gcVersionLength <= (size - sizeof(MM_VerboseBinaryLogHeader)))
+		&& (NULL != memchr(log + sizeof(MM_VerboseBinaryLogHeader), '\0', header->gcVersionLength))
+	) {
+		OMRFileStream *output = omrfilestream_open(xmlFilename, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL != output) {
+			const char *version = (const char *)(log + sizeof(MM_VerboseBinaryLogHeader));
+			uintptr_t recordsOffset = sizeof(MM_VerboseBinaryLogHeader) + header->gcVersionLength;
+
+			omrfilestream_printf(output, VERBOSEGC_HEADER, version);
+			result = convertRecords(portLibrary, output, log + recordsOffset, size - recordsOffset);
+			omrfilestream_write_text(output, VERBOSEGC_FOOTER, strlen(VERBOSEGC_FOOTER), J9STR_CODE_PLATFORM_RAW);
+			omrfilestream_write_text(output, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+			if (0 != omrfilestream_close(output)) {
+				result = false;
+			}
+		}
+	}
+
+	omrmem_free_memory(log);
+	return result;
+}
+
+/**
+ * Read a whole file into memory, which the caller must free.
+ * @return the contents of the file, or NULL if it can not be read
+ */
+uint8_t *
+MM_VerboseBinaryLogConverter::readFile(OMRPortLibrary *portLibrary, const char *filename, uintptr_t *size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint8_t *contents = NULL;
+
+	intptr_t fd = omrfile_open(filename, EsOpenRead, 0);
+	if (-1 == fd) {
+		return NULL;
+	}
+
+	int64_t length = omrfile_flength(fd);
+	if ((0 <= length) && ((uint64_t)length < (uint64_t)UDATA_MAX)) {
+		contents = (uint8_t *)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_MM);
+		if (NULL != contents) {
+			uintptr_t offset = 0;
+			while (offset < (uintptr_t)length) {
+				intptr_t bytesRead = omrfile_read(fd, contents + offset, (intptr_t)((uintptr_t)length - offset));
+				if (bytesRead <= 0) {
+					omrmem_free_memory(contents);
+					contents = NULL;
+					break;
+				}
+				offset += (uintptr_t)bytesRead;
+			}
+			*size = offset;
+		}
+	}
+
+	omrfile_close(fd);
+	return contents;
+}
+
+bool
+MM_VerboseBinaryLogConverter::convertRecords(OMRPortLibrary *portLibrary, OMRFileStream *output, const uint8_t *log, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t formatsSize = sizeof(Format) * (VERBOSE_BINARY_LOG_MAX_FORMATS + 1);
+	uintptr_t offset = 0;
+
+	Format *formats = (Format *)omrmem_allocate_memory(formatsSize, OMRMEM_CATEGORY_MM);
+	if (NULL == formats) {
+		return false;
+	}
+	memset(formats, 0, formatsSize);
+
+	bool result = true;
+	while (result && (sizeof(MM_VerboseBinaryLogRecord) <= (size - offset))) {
+		const MM_VerboseBinaryLogRecord *record = (const MM_VerboseBinaryLogRecord *)(log + offset);
+		if ((sizeof(MM_VerboseBinaryLogRecord) > record->size) || (0 != (record->size % VERBOSE_BINARY_LOG_ALIGNMENT))) {
+			result = false;
+			break;
+		}
+		if (record->size > (size - offset)) {
+			/* the log was cut short while the record was written */
+			break;
+		}
+
+		const char *payload = (const char *)(record + 1);
+		uintptr_t payloadSize = record->size - sizeof(MM_VerboseBinaryLogRecord);
+		bool validFormatId = (0 != record->formatId) && (VERBOSE_BINARY_LOG_MAX_FORMATS >= record->formatId);
+		switch (record->type) {
+		case VERBOSE_BINARY_RECORD_FORMAT:
+			if (validFormatId && (NULL != memchr(payload, '\0', payloadSize))) {
+				Format *format = &formats[record->formatId];
+				format->text = payload;
+				result = MM_VerboseBinaryLog::parseFormat(payload, format->kinds, &format->argCount) && (format->argCount == record->argCount);
+			} else {
+				result = false;
+			}
+			break;
+		case VERBOSE_BINARY_RECORD_EVENT:
+			if (validFormatId && (NULL != formats[record->formatId].text) && (formats[record->formatId].argCount == record->argCount)) {
+				result = outputEvent(portLibrary, output, &formats[record->formatId], record);
+			} else {
+				result = false;
+			}
+			break;
+		case VERBOSE_BINARY_RECORD_TEXT:
+		{
+			const char *end = (const char *)memchr(payload, '\0', payloadSize);
+			if (NULL != end) {
+				omrfilestream_write_text(output, payload, end - payload, J9STR_CODE_PLATFORM_RAW);
+			} else {
+				result = false;
+			}
+			break;
+		}
+		default:
+			result = false;
+			break;
+		}
+		offset += record->size;
+	}
+
+	omrmem_free_memory(formats);
+	return result;
+}
+
+/**
+ * Output the line of an event, formatting each conversion of its format with the recorded argument.
+ * @return false if the arguments recorded do not match the format
+ */
+bool
+MM_VerboseBinaryLogConverter::outputEvent(OMRPortLibrary *portLibrary, OMRFileStream *output, Format *format, const MM_VerboseBinaryLogRecord *record)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	const uint8_t *argument = (const uint8_t *)(record + 1);
+	const uint8_t *end = (const uint8_t *)record + record->size;
+	const char *cursor = format->text;
+
+	for (uintptr_t i = 0; i < record->indent; ++i) {
+		omrfilestream_write_text(output, INDENT_SPACER, strlen(INDENT_SPACER), J9STR_CODE_PLATFORM_RAW);
+	}
+
+	while (true) {
+		const char *percent = strchr(cursor, '%');
+		uintptr_t literalLength = (NULL == percent) ? strlen(cursor) : (uintptr_t)(percent - cursor);
+		if (0 != literalLength) {
+			omrfilestream_write_text(output, cursor, literalLength, J9STR_CODE_PLATFORM_RAW);
+		}
+		if (NULL == percent) {
+			break;
+		}
+
+		uint8_t kind = 0;
+		const char *next = MM_VerboseBinaryLog::parseConversion(percent, &kind);
+		if (NULL == next) {
+			return false;
+		}
+		if (0 == kind) {
+			omrfilestream_write_text(output, "%", 1, J9STR_CODE_PLATFORM_RAW);
+		} else {
+			char specification[VERBOSE_BINARY_CONVERSION_MAX_LENGTH];
+			uintptr_t specificationLength = next - percent;
+			if ((sizeof(specification) <= specificationLength) || (VERBOSE_BINARY_LOG_SLOT_SIZE > (uintptr_t)(end - argument))) {
+				return false;
+			}
+			memcpy(specification, percent, specificationLength);
+			specification[specificationLength] = '\0';
+
+			uint64_t slot = 0;
+			memcpy(&slot, argument, VERBOSE_BINARY_LOG_SLOT_SIZE);
+			argument += VERBOSE_BINARY_LOG_SLOT_SIZE;
+
+			switch (kind) {
+			case VERBOSE_BINARY_ARG_INT:
+				omrfilestream_printf(output, specification, (int)slot);
+				break;
+			case VERBOSE_BINARY_ARG_LONG:
+				omrfilestream_printf(output, specification, (long)slot);
+				break;
+			case VERBOSE_BINARY_ARG_LONG_LONG:
+				omrfilestream_printf(output, specification, (long long)slot);
+				break;
+			case VERBOSE_BINARY_ARG_SIZE:
+				omrfilestream_printf(output, specification, (uintptr_t)slot);
+				break;
+			case VERBOSE_BINARY_ARG_DOUBLE:
+			{
+				double value = 0.0;
+				memcpy(&value, &slot, sizeof(value));
+				omrfilestream_printf(output, specification, value);
+				break;
+			}
+			case VERBOSE_BINARY_ARG_POINTER:
+				omrfilestream_printf(output, specification, (void *)(uintptr_t)slot);
+				break;
+			case VERBOSE_BINARY_ARG_STRING:
+			{
+				const char *string = NULL;
+				if (VERBOSE_BINARY_LOG_NULL_STRING != slot) {
+					uintptr_t available = end - argument;
+					if ((0 == slot) || (MM_VerboseBinaryLog::align((uintptr_t)slot) > available) || ('\0' != argument[slot - 1])) {
+						return false;
+					}
+					string = (const char *)argument;
+					argument += MM_VerboseBinaryLog::align((uintptr_t)slot);
+				}
+				omrfilestream_printf(output, specification, string);
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+		cursor = next;
+	}
+
+	omrfilestream_write_text(output, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+	return true;
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYLOGCONVERTER_HPP_)
+#define VERBOSEBINARYLOGCONVERTER_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "VerboseBinaryLog.hpp"
+
+/**
+ * Converts a binary verbose GC log written by MM_VerboseWriterFileLoggingBinary back to the verbose GC XML
+ * the text writers produce, one log file at a time. Lines are formatted by the port library as they would
+ * have been by the writer chain.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseBinaryLogConverter
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef struct Format {
+		const char *text; /**< The format string, in the binary log */
+		uintptr_t argCount;
+		uint8_t kinds[VERBOSE_BINARY_LOG_MAX_ARGUMENTS];
+	} Format;
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Convert a binary verbose GC log to XML. A log which ends in the middle of a record, such as the log of a
+	 * process which did not shut down, is converted up to its last complete record.
+	 * @param portLibrary[in] the port library of the converting process
+	 * @param binaryFilename[in] the binary log
+	 * @param xmlFilename[in] the XML file to create
+	 * @return true on success, false if the binary log can not be read or was written by a process of a different
+	 * pointer size or byte order, or the XML file can not be written
+	 */
+	static bool convert(OMRPortLibrary *portLibrary, const char *binaryFilename, const char *xmlFilename);
+
+protected:
+private:
+	static uint8_t *readFile(OMRPortLibrary *portLibrary, const char *filename, uintptr_t *size);
+	static bool convertRecords(OMRPortLibrary *portLibrary, OMRFileStream *output, const uint8_t *log, uintptr_t size);
+	static bool outputEvent(OMRPortLibrary *portLibrary, OMRFileStream *output, Format *format, const MM_VerboseBinaryLogRecord *record);
+};
+
+#endif /* VERBOSEBINARYLOGCONVERTER_HPP_ */
@@ -29,8 +29,6 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 
-#define INDENT_SPACER "  "
-
 /**
  * Instantiate a new buffer object
  * @param size Buffer size
@@ -35,6 +35,7 @@
 #include "ut_j9vgc.h"
 
 #define INITIAL_BUFFER_SIZE 512
+#define INDENT_SPACER "  "
 
 /**
  * Verbose buffer
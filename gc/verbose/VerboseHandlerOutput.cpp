@@ -308,6 +308,9 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	buffer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", getPageTypeString(_extensions->heap->getPageFlags()));
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", _extensions->requestedPageSize);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", getPageTypeString(_extensions->requestedPageFlags));
+	buffer->formatAndOutput(env, 1, "<attribute name=\"hugePages\" value=\"%s\" />", getHeapHugePagesString(_extensions->heapHugePages));
+	buffer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePages\" value=\"%s\" />", _extensions->heap->isTransparentHugePages() ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"numaInterleave\" value=\"%s\" />", _extensions->heap->isNumaInterleaved() ? "true" : "false");
 	buffer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", _extensions->gcThreadCount);
 
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
@@ -519,6 +522,23 @@ MM_VerboseHandlerOutput::getCycleType(uintptr_t type)
 	return "unknown";
 }
 
+const char *
+MM_VerboseHandlerOutput::getHeapHugePagesString(uintptr_t heapHugePages)
+{
+	switch (heapHugePages) {
+	case MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE:
+		return "none";
+	case MM_GCExtensionsBase::HEAP_HUGE_PAGES_NURSERY:
+		return "nursery";
+	case MM_GCExtensionsBase::HEAP_HUGE_PAGES_TENURE:
+		return "tenure";
+	case MM_GCExtensionsBase::HEAP_HUGE_PAGES_ALL:
+		return "all";
+	default:
+		return "unknown";
+	}
+}
+
 const char *
 MM_VerboseHandlerOutput::getCurrentCycleType(MM_EnvironmentBase *env) {
 	return getCycleType(env->_cycleState->_type);
@@ -1004,7 +1024,7 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 		reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
 	} else if (HEAP_RELEASE_FREE_PAGES == resizeType) {
 		resizeTypeName = "release free pages";
-		reasonString = "idle";
+		reasonString = (RELEASE_FREE_PAGES_IDLE_FREE_ENTRIES == (ReleaseFreePagesReason)reason) ? "idle free entries" : "idle";
 	} else {
 		resizeTypeName = "unknown";
 		reasonString = "unknown";
@@ -106,6 +106,13 @@ protected:
 	 */	
 	virtual const char *getCycleType(uintptr_t type);
 
+	/**
+	 * Answer a string representation of the heap areas selected for huge pages.
+	 * @param[IN] heapHugePages MM_GCExtensionsBase::HeapHugePages mask
+	 * @return string naming the heap areas backed by huge pages.
+	 */
+	const char *getHeapHugePagesString(uintptr_t heapHugePages);
+
 
 	/**
      * Output a stanza on data tracking for the initialized phase of verbose GC into a verbose buffer.
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -31,10 +31,6 @@
 #undef UT_MODULE_UNLOADED
 #include "ut_j9vgc.h"
 
-/* Output constants */
-#define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
-#define VERBOSEGC_FOOTER "</verbosegc>\n"
-
 MM_VerboseWriter::MM_VerboseWriter(WriterType type)
 	: MM_Base()
 	,_nextWriter(NULL)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,9 +36,14 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 6
 } WriterType;
 
+/* Output constants */
+#define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
+#define VERBOSEGC_FOOTER "</verbosegc>\n"
+
 /**
  * The base class for writers that do output for the verbose GC.
  * Actual writers subclass this.
@@ -69,6 +75,19 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * @return true if the writer records lines through outputDeferred rather than taking formatted output
+	 */
+	virtual bool defersFormatting() { return false; }
+
+	/**
+	 * Output a line which has not been formatted, only called on writers which defer formatting.
+	 * @param indent[in] Indentation level of the line
+	 * @param format[in] Format of the line
+	 * @param args[in] Arguments of the format
+	 */
+	virtual void outputDeferred(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
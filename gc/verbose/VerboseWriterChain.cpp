@@ -60,10 +60,34 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 	va_list args;
 
 	va_start(args, format);
-	_buffer->formatAndOutputV(env, indent, format, args);
+	if (defersFormatting()) {
+		MM_VerboseWriter* writer = _writers;
+		while (NULL != writer) {
+			va_list argsCopy;
+			COPY_VA_LIST(argsCopy, args);
+			writer->outputDeferred(env, indent, format, argsCopy);
+			END_VA_LIST_COPY(argsCopy);
+			writer = writer->getNextWriter();
+		}
+	} else {
+		_buffer->formatAndOutputV(env, indent, format, args);
+	}
 	va_end(args);
 }
 
+bool
+MM_VerboseWriterChain::defersFormatting()
+{
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (!writer->defersFormatting()) {
+			return false;
+		}
+		writer = writer->getNextWriter();
+	}
+	return NULL != _writers;
+}
+
 void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
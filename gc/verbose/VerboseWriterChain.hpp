@@ -36,7 +36,8 @@ class MM_VerboseWriter;
 
 /**
  * This class manages a list of writers. It formats and buffers output, flushing it
- * to the writers when asked.
+ * to the writers when asked. When every writer defers formatting, lines are handed to
+ * the writers unformatted instead, and the buffer only holds output written to it directly.
  */
 class MM_VerboseWriterChain : public MM_Base
 {
@@ -54,6 +55,11 @@ public:
 	void formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, const char *format, ...);
 	void flush(MM_EnvironmentBase *env);
 
+	/**
+	 * @return true if there are writers and all of them defer formatting
+	 */
+	bool defersFormatting();
+
 	/**
 	 * Add a new verbose writer to the list of active output writers.
 	 * @param writer[in] New writer to add to list.
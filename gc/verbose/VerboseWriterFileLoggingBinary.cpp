@@ -0,0 +1,704 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "ModronAssertions.h"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+#include <string.h>
+
+#define VERBOSE_BINARY_MINIMUM_RING_SIZE (64 * 1024)
+#define VERBOSE_BINARY_FORMAT_TABLE_SIZE (2 * VERBOSE_BINARY_LOG_MAX_FORMATS) /* a power of two, larger than the number of formats */
+#define VERBOSE_BINARY_FLUSH_INTERVAL_MILLIS 1000
+
+static const uint8_t verboseBinaryPadding[VERBOSE_BINARY_LOG_ALIGNMENT] = {0};
+
+extern "C" {
+
+/**
+ * Flusher thread procedure
+ *
+ * @parm info Address of the MM_VerboseWriterFileLoggingBinary to flush
+ */
+static int J9THREAD_PROC
+verbose_binary_flusher_thread_proc(void *info)
+{
+	((MM_VerboseWriterFileLoggingBinary *)info)->flusherThreadEntryPoint();
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_omrVM(env->getOmrVM())
+	,_logFileStream(NULL)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_maxRecordSize(0)
+	,_writeCursor(0)
+	,_readCursor(0)
+	,_monitor(NULL)
+	,_flusherState(FLUSHER_NOT_STARTED)
+	,_formats(NULL)
+	,_formatCount(0)
+	,_formatTable(NULL)
+	,_formatWritten(NULL)
+	,_textBuffer(NULL)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * The ring and the flusher are kept when the writer is reconfigured.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	if ((NULL == _ring) && !initializeRing(env)) {
+		return false;
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	if ((FLUSHER_NOT_STARTED == _flusherState) && !startFlusher(env)) {
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Allocate the ring, the format table and the flusher monitor.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initializeRing(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	uintptr_t ringSize = VERBOSE_BINARY_MINIMUM_RING_SIZE;
+	while ((ringSize < extensions->verboseBinaryBufferSize) && (0 != (ringSize << 1))) {
+		ringSize <<= 1;
+	}
+	_ring = (uint8_t *)extensions->getForge()->allocate(ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _ring) {
+		return false;
+	}
+	_ringSize = ringSize;
+	_maxRecordSize = ringSize / 4;
+
+	uintptr_t formatsSize = sizeof(Format) * (VERBOSE_BINARY_LOG_MAX_FORMATS + 1);
+	_formats = (Format *)extensions->getForge()->allocate(formatsSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _formats) {
+		return false;
+	}
+	memset(_formats, 0, formatsSize);
+
+	uintptr_t formatTableSize = sizeof(uint16_t) * VERBOSE_BINARY_FORMAT_TABLE_SIZE;
+	_formatTable = (uint16_t *)extensions->getForge()->allocate(formatTableSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _formatTable) {
+		return false;
+	}
+	memset(_formatTable, 0, formatTableSize);
+
+	uintptr_t formatWrittenSize = sizeof(bool) * (VERBOSE_BINARY_LOG_MAX_FORMATS + 1);
+	_formatWritten = (bool *)extensions->getForge()->allocate(formatWrittenSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _formatWritten) {
+		return false;
+	}
+	memset(_formatWritten, 0, formatWrittenSize);
+
+	_textBuffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+	if (NULL == _textBuffer) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingBinary")) {
+		_monitor = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Anything still in the ring is written out first.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	stopFlusher(env);
+	if (NULL != _ring) {
+		flushRing(env);
+	}
+	closeLogFile(env);
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+	if (NULL != _textBuffer) {
+		_textBuffer->kill(env);
+		_textBuffer = NULL;
+	}
+	if (NULL != _formats) {
+		for (uintptr_t formatId = 1; formatId <= _formatCount; formatId++) {
+			extensions->getForge()->free(_formats[formatId].text);
+		}
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+	extensions->getForge()->free(_formatTable);
+	_formatTable = NULL;
+	extensions->getForge()->free(_formatWritten);
+	_formatWritten = NULL;
+	extensions->getForge()->free(_ring);
+	_ring = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::startFlusher(MM_EnvironmentBase *env)
+{
+	omrthread_t thread = NULL;
+
+	_flusherState = FLUSHER_RUNNING;
+	if (0 != createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0,
+			verbose_binary_flusher_thread_proc, (void *)this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+		_flusherState = FLUSHER_NOT_STARTED;
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Ask the flusher to write out the ring and terminate, and wait for it to do so.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::stopFlusher(MM_EnvironmentBase *env)
+{
+	if (isFlusherAlive()) {
+		omrthread_monitor_enter(_monitor);
+		_flusherState = FLUSHER_SHUTDOWN_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		while (FLUSHER_TERMINATED != _flusherState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flusherThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_monitor);
+	while (true) {
+		uintptr_t writeCursor = _writeCursor;
+		if (_readCursor != writeCursor) {
+			/* the records up to writeCursor are complete, write them out without holding the monitor */
+			omrthread_monitor_exit(_monitor);
+			writeRecords(&env, writeCursor);
+			omrthread_monitor_enter(_monitor);
+			_readCursor = writeCursor;
+			omrthread_monitor_notify_all(_monitor);
+		} else if (FLUSHER_SHUTDOWN_REQUESTED == _flusherState) {
+			break;
+		} else {
+			omrthread_monitor_wait_timed(_monitor, VERBOSE_BINARY_FLUSH_INTERVAL_MILLIS, 0);
+		}
+	}
+
+	_flusherState = FLUSHER_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::requestFlush(MM_EnvironmentBase *env)
+{
+	if (isFlusherAlive()) {
+		omrthread_monitor_enter(_monitor);
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flushRing(MM_EnvironmentBase *env)
+{
+	if (isFlusherAlive()) {
+		omrthread_monitor_enter(_monitor);
+		while (_readCursor != _writeCursor) {
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	} else if (_readCursor != _writeCursor) {
+		writeRecords(env, _writeCursor);
+		_readCursor = _writeCursor;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drain(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	flushRing(env);
+	if (NULL != _logFileStream) {
+		omrfilestream_sync(_logFileStream);
+	}
+}
+
+MM_VerboseBinaryLogRecord *
+MM_VerboseWriterFileLoggingBinary::reserveRecord(MM_EnvironmentBase *env, uintptr_t size)
+{
+	uintptr_t offset = _writeCursor & (_ringSize - 1);
+	uintptr_t tail = _ringSize - offset;
+	/* a record is never split across the end of the ring */
+	uintptr_t needed = (size > tail) ? (tail + size) : size;
+
+	if ((_ringSize - (_writeCursor - _readCursor)) < needed) {
+		omrthread_monitor_enter(_monitor);
+		while ((_ringSize - (_writeCursor - _readCursor)) < needed) {
+			if (isFlusherAlive()) {
+				omrthread_monitor_notify_all(_monitor);
+				omrthread_monitor_wait(_monitor);
+			} else {
+				writeRecords(env, _writeCursor);
+				_readCursor = _writeCursor;
+			}
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	if (size > tail) {
+		/* a tail too short for a record header is skipped by the reader without a pad record */
+		if (tail >= sizeof(MM_VerboseBinaryLogRecord)) {
+			MM_VerboseBinaryLogRecord *pad = (MM_VerboseBinaryLogRecord *)(_ring + offset);
+			pad->type = VERBOSE_BINARY_RECORD_PAD;
+			pad->indent = 0;
+			pad->size = (uint32_t)tail;
+			pad->formatId = 0;
+			pad->argCount = 0;
+		}
+		MM_AtomicOperations::storeSync();
+		_writeCursor += tail;
+		offset = 0;
+	}
+
+	return (MM_VerboseBinaryLogRecord *)(_ring + offset);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::commitRecord(MM_EnvironmentBase *env, uintptr_t size)
+{
+	uintptr_t halfRing = _ringSize / 2;
+	uintptr_t usedBefore = _writeCursor - _readCursor;
+
+	/* the record must be visible to the flusher before the cursor covering it */
+	MM_AtomicOperations::storeSync();
+	_writeCursor += size;
+
+	if ((usedBefore <= halfRing) && ((usedBefore + size) > halfRing)) {
+		requestFlush(env);
+	}
+}
+
+MM_VerboseWriterFileLoggingBinary::Format *
+MM_VerboseWriterFileLoggingBinary::internFormat(MM_EnvironmentBase *env, const char *format)
+{
+	uintptr_t hash = 5381;
+	for (const char *cursor = format; '\0' != *cursor; cursor++) {
+		hash = (hash * 33) ^ (uint8_t)*cursor;
+	}
+
+	uintptr_t slot = hash & (VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1);
+	while (0 != _formatTable[slot]) {
+		Format *entry = &_formats[_formatTable[slot]];
+		if ((hash == entry->hash) && (0 == strcmp(entry->text, format))) {
+			return entry;
+		}
+		slot = (slot + 1) & (VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1);
+	}
+
+	if (VERBOSE_BINARY_LOG_MAX_FORMATS == _formatCount) {
+		return NULL;
+	}
+	Format *entry = &_formats[_formatCount + 1];
+	if (!MM_VerboseBinaryLog::parseFormat(format, entry->kinds, &entry->argCount)) {
+		return NULL;
+	}
+	uintptr_t length = strlen(format) + 1;
+	entry->text = (char *)env->getExtensions()->getForge()->allocate(length, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == entry->text) {
+		return NULL;
+	}
+	memcpy(entry->text, format, length);
+	entry->hash = hash;
+
+	_formatCount += 1;
+	_formatTable[slot] = (uint16_t)_formatCount;
+	return entry;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputDeferred(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	Format *entry = internFormat(env, format);
+
+	if (NULL != entry) {
+		uint64_t slots[VERBOSE_BINARY_LOG_MAX_ARGUMENTS];
+		const char *strings[VERBOSE_BINARY_LOG_MAX_ARGUMENTS];
+		uintptr_t size = sizeof(MM_VerboseBinaryLogRecord) + (entry->argCount * VERBOSE_BINARY_LOG_SLOT_SIZE);
+		va_list argsCopy;
+
+		COPY_VA_LIST(argsCopy, args);
+		for (uintptr_t i = 0; i < entry->argCount; i++) {
+			strings[i] = NULL;
+			switch (entry->kinds[i]) {
+			case VERBOSE_BINARY_ARG_INT:
+				slots[i] = (uint64_t)(int64_t)va_arg(argsCopy, int);
+				break;
+			case VERBOSE_BINARY_ARG_LONG:
+				slots[i] = (uint64_t)(int64_t)va_arg(argsCopy, long);
+				break;
+			case VERBOSE_BINARY_ARG_LONG_LONG:
+				slots[i] = (uint64_t)va_arg(argsCopy, long long);
+				break;
+			case VERBOSE_BINARY_ARG_SIZE:
+				slots[i] = (uint64_t)va_arg(argsCopy, uintptr_t);
+				break;
+			case VERBOSE_BINARY_ARG_DOUBLE:
+			{
+				double value = va_arg(argsCopy, double);
+				memcpy(&slots[i], &value, sizeof(value));
+				break;
+			}
+			case VERBOSE_BINARY_ARG_POINTER:
+				slots[i] = (uint64_t)(uintptr_t)va_arg(argsCopy, void *);
+				break;
+			case VERBOSE_BINARY_ARG_STRING:
+				strings[i] = va_arg(argsCopy, const char *);
+				if (NULL == strings[i]) {
+					slots[i] = VERBOSE_BINARY_LOG_NULL_STRING;
+				} else {
+					slots[i] = strlen(strings[i]) + 1;
+					size += MM_VerboseBinaryLog::align((uintptr_t)slots[i]);
+				}
+				break;
+			default:
+				Assert_MM_unreachable();
+			}
+		}
+		END_VA_LIST_COPY(argsCopy);
+
+		if (size <= _maxRecordSize) {
+			MM_VerboseBinaryLogRecord *record = reserveRecord(env, size);
+			record->type = VERBOSE_BINARY_RECORD_EVENT;
+			record->indent = (uint16_t)indent;
+			record->size = (uint32_t)size;
+			record->formatId = (uint32_t)(entry - _formats);
+			record->argCount = (uint32_t)entry->argCount;
+
+			uint8_t *cursor = (uint8_t *)(record + 1);
+			for (uintptr_t i = 0; i < entry->argCount; i++) {
+				memcpy(cursor, &slots[i], VERBOSE_BINARY_LOG_SLOT_SIZE);
+				cursor += VERBOSE_BINARY_LOG_SLOT_SIZE;
+				if (NULL != strings[i]) {
+					uintptr_t length = (uintptr_t)slots[i];
+					uintptr_t alignedLength = MM_VerboseBinaryLog::align(length);
+					memcpy(cursor, strings[i], length);
+					memset(cursor + length, 0, alignedLength - length);
+					cursor += alignedLength;
+				}
+			}
+
+			commitRecord(env, size);
+			return;
+		}
+	}
+
+	/* the line can not be recorded as an event, format it here as the writer chain would have */
+	_textBuffer->reset();
+	_textBuffer->formatAndOutputV(env, indent, format, args);
+	recordText(env, _textBuffer->contents());
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::recordText(MM_EnvironmentBase *env, const char *text)
+{
+	uintptr_t remaining = strlen(text);
+
+	while (0 != remaining) {
+		uintptr_t length = OMR_MIN(remaining, _maxRecordSize - sizeof(MM_VerboseBinaryLogRecord) - 1);
+		uintptr_t size = MM_VerboseBinaryLog::align(sizeof(MM_VerboseBinaryLogRecord) + length + 1);
+
+		MM_VerboseBinaryLogRecord *record = reserveRecord(env, size);
+		record->type = VERBOSE_BINARY_RECORD_TEXT;
+		record->indent = 0;
+		record->size = (uint32_t)size;
+		record->formatId = 0;
+		record->argCount = 0;
+		char *payload = (char *)(record + 1);
+		memcpy(payload, text, length);
+		memset(payload + length, 0, size - sizeof(MM_VerboseBinaryLogRecord) - length);
+		commitRecord(env, size);
+
+		text += length;
+		remaining -= length;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	recordText(env, string);
+}
+
+/**
+ * Moves on to the next file once enough cycles have been logged to the current one. The file is switched by the
+ * flusher when it reaches the point of the switch in the ring, which is also woken to write out the cycle.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (rotating_files == _mode) {
+		_currentCycle = (_currentCycle + 1) % _numCycles;
+		if (0 == _currentCycle) {
+			_currentFile = (_currentFile + 1) % _numFiles;
+
+			MM_VerboseBinaryLogRecord *record = reserveRecord(env, sizeof(MM_VerboseBinaryLogRecord));
+			record->type = VERBOSE_BINARY_RECORD_ROTATE;
+			record->indent = 0;
+			record->size = sizeof(MM_VerboseBinaryLogRecord);
+			record->formatId = (uint32_t)_currentFile;
+			record->argCount = 0;
+			commitRecord(env, sizeof(MM_VerboseBinaryLogRecord));
+
+			/* Print an Initialized Stanza in new file */
+			_textBuffer->reset();
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, _textBuffer);
+			recordText(env, _textBuffer->contents());
+		}
+	}
+
+	requestFlush(env);
+}
+
+/**
+ * Opens the file to log output to, on the thread initializing the writer.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	return openLogFile(env, _currentFile);
+}
+
+/**
+ * Writes out everything recorded and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	flushRing(env);
+	closeLogFile(env);
+}
+
+/**
+ * Opens a log file and writes the binary log header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openLogFile(MM_EnvironmentBase *env, uintptr_t currentFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	uintptr_t versionLength = strlen(version) + 1;
+	MM_VerboseBinaryLogHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, VERBOSE_BINARY_LOG_MAGIC, sizeof(header.magic));
+	header.version = VERBOSE_BINARY_LOG_VERSION;
+	header.byteOrder = VERBOSE_BINARY_LOG_BYTE_ORDER;
+	header.pointerSize = sizeof(void *);
+	header.gcVersionLength = (uint32_t)MM_VerboseBinaryLog::align(versionLength);
+	writeBytes(env, &header, sizeof(header));
+	writeBytes(env, version, versionLength);
+	writeBytes(env, verboseBinaryPadding, header.gcVersionLength - versionLength);
+
+	/* every file carries the definitions of the formats it uses */
+	memset(_formatWritten, 0, sizeof(bool) * (VERBOSE_BINARY_LOG_MAX_FORMATS + 1));
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::closeLogFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeRecords(MM_EnvironmentBase *env, uintptr_t writeCursor)
+{
+	uintptr_t readCursor = _readCursor;
+
+	while (readCursor != writeCursor) {
+		uintptr_t offset = readCursor & (_ringSize - 1);
+		uintptr_t tail = _ringSize - offset;
+		if (tail < sizeof(MM_VerboseBinaryLogRecord)) {
+			readCursor += tail;
+			continue;
+		}
+
+		MM_VerboseBinaryLogRecord *record = (MM_VerboseBinaryLogRecord *)(_ring + offset);
+		switch (record->type) {
+		case VERBOSE_BINARY_RECORD_EVENT:
+			if (!_formatWritten[record->formatId]) {
+				writeFormat(env, record->formatId);
+			}
+			writeBytes(env, record, record->size);
+			break;
+		case VERBOSE_BINARY_RECORD_TEXT:
+			writeBytes(env, record, record->size);
+			break;
+		case VERBOSE_BINARY_RECORD_ROTATE:
+			closeLogFile(env);
+			openLogFile(env, record->formatId);
+			break;
+		case VERBOSE_BINARY_RECORD_PAD:
+			break;
+		default:
+			Assert_MM_unreachable();
+		}
+		readCursor += record->size;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeFormat(MM_EnvironmentBase *env, uintptr_t formatId)
+{
+	Format *format = &_formats[formatId];
+	uintptr_t length = strlen(format->text) + 1;
+
+	MM_VerboseBinaryLogRecord record;
+	record.type = VERBOSE_BINARY_RECORD_FORMAT;
+	record.indent = 0;
+	record.size = (uint32_t)MM_VerboseBinaryLog::align(sizeof(record) + length);
+	record.formatId = (uint32_t)formatId;
+	record.argCount = (uint32_t)format->argCount;
+	writeBytes(env, &record, sizeof(record));
+	writeBytes(env, format->text, length);
+	writeBytes(env, verboseBinaryPadding, record.size - sizeof(record) - length);
+
+	_formatWritten[formatId] = true;
+}
+
+/**
+ * Write to the current file. Output is dropped if the file could not be opened, which has already been reported.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::writeBytes(MM_EnvironmentBase *env, const void *bytes, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if ((NULL != _logFileStream) && (0 != size)) {
+		omrfilestream_write(_logFileStream, bytes, (intptr_t)size);
+	}
+}
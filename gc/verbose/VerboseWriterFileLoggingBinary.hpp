@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrstdarg.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryLog.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Output agent which records verbosegc output as binary records and writes them to file from a background thread.
+ *
+ * Lines are not formatted on the reporting thread. The format string of a line is interned and the line is
+ * recorded as the id of its format and its raw arguments into a ring buffer, which a flusher thread writes out
+ * to the (rotating) log. MM_VerboseBinaryLogConverter turns the log back into the verbose GC XML.
+ *
+ * Verbose output is serialized by the reporting lock of the handlers (as the shared MM_VerboseBuffer of the
+ * writer chain already requires), so the reporting thread is the single producer of the ring and the flusher
+ * its single consumer, and neither takes a lock unless the ring is full.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum {
+		FLUSHER_NOT_STARTED = 0,
+		FLUSHER_RUNNING,
+		FLUSHER_SHUTDOWN_REQUESTED,
+		FLUSHER_TERMINATED
+	} FlusherState;
+
+	typedef struct Format {
+		char *text; /**< Copy of the format string */
+		uintptr_t hash; /**< Hash of the format string */
+		uintptr_t argCount; /**< Number of arguments taken by the format */
+		uint8_t kinds[VERBOSE_BINARY_LOG_MAX_ARGUMENTS]; /**< VerboseBinaryArgumentKind of each argument */
+	} Format;
+
+	OMR_VM *_omrVM;
+	OMRFileStream *_logFileStream; /**< the filestream being written to, owned by the flusher once it is running */
+
+	uint8_t *_ring; /**< Records waiting to be written to the log */
+	uintptr_t _ringSize; /**< Size of _ring, a power of two */
+	uintptr_t _maxRecordSize; /**< Larger lines are formatted on the reporting thread and recorded as text in pieces */
+	volatile uintptr_t _writeCursor; /**< Bytes ever recorded, only advanced by the reporting thread */
+	volatile uintptr_t _readCursor; /**< Bytes ever written out, only advanced under _monitor */
+
+	omrthread_monitor_t _monitor; /**< Wakes the flusher and producers waiting for room in the ring */
+	volatile FlusherState _flusherState;
+
+	Format *_formats; /**< Interned formats indexed by format id, entry 0 is unused */
+	uintptr_t _formatCount; /**< Number of formats interned */
+	uint16_t *_formatTable; /**< Open addressing hash table of format ids */
+	bool *_formatWritten; /**< Whether the definition of each format has been written to the current file, owned by the flusher */
+
+	MM_VerboseBuffer *_textBuffer; /**< Formats lines which can not be recorded as events */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual bool defersFormatting() { return true; }
+	virtual void outputDeferred(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait for the flusher to write out everything recorded so far and sync the log to disk.
+	 */
+	void drain(MM_EnvironmentBase *env);
+
+	/**
+	 * Entry point of the flusher thread.
+	 */
+	void flusherThreadEntryPoint();
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool openLogFile(MM_EnvironmentBase *env, uintptr_t currentFile);
+	void closeLogFile(MM_EnvironmentBase *env);
+
+	bool initializeRing(MM_EnvironmentBase *env);
+	bool startFlusher(MM_EnvironmentBase *env);
+	void stopFlusher(MM_EnvironmentBase *env);
+	MMINLINE bool isFlusherAlive() { return (FLUSHER_RUNNING == _flusherState) || (FLUSHER_SHUTDOWN_REQUESTED == _flusherState); }
+
+	/**
+	 * Find or add format in the format table.
+	 * @return the interned format, or NULL if it can not be recorded
+	 */
+	Format *internFormat(MM_EnvironmentBase *env, const char *format);
+
+	/**
+	 * Make room for a record of size bytes, waiting for the flusher if the ring is full.
+	 * @return where to write the record
+	 */
+	MM_VerboseBinaryLogRecord *reserveRecord(MM_EnvironmentBase *env, uintptr_t size);
+	void commitRecord(MM_EnvironmentBase *env, uintptr_t size);
+	void recordText(MM_EnvironmentBase *env, const char *text);
+
+	/**
+	 * Wake the flusher so it writes out the ring without waiting for its interval.
+	 */
+	void requestFlush(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait until everything recorded so far has been written out, writing it on the calling thread if there is no flusher.
+	 */
+	void flushRing(MM_EnvironmentBase *env);
+
+	/**
+	 * Write out the records between the read cursor and writeCursor.
+	 */
+	void writeRecords(MM_EnvironmentBase *env, uintptr_t writeCursor);
+	void writeFormat(MM_EnvironmentBase *env, uintptr_t formatId);
+	void writeBytes(MM_EnvironmentBase *env, const void *bytes, uintptr_t size);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -73,6 +73,11 @@ static void verboseHandlerConcurrentCollectionStart(J9HookInterface** hook, uint
 static void verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+static void verboseHandlerConcurrentSweepPhaseCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerConcurrentSweepCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandard::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
 {
@@ -154,6 +159,10 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENTLY_COMPLETED_SWEEP_PHASE, verboseHandlerConcurrentSweepPhaseCompleted, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerConcurrentSweepCompleted, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, OMR_GET_CALLSITE(), this);
@@ -213,6 +222,10 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, NULL);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENTLY_COMPLETED_SWEEP_PHASE, verboseHandlerConcurrentSweepPhaseCompleted, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerConcurrentSweepCompleted, NULL);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, NULL);
@@ -277,6 +290,10 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (extensions->adaptiveGCThreading && (UDATA_MAX != markStats->_recommendedThreadCount)) {
+		writer->formatAndOutput(env, 1, "<gc-threads active=\"%zu\" recommended=\"%zu\" efficiency=\"%.3f\" />",
+				markStats->_gcThreadCount, markStats->_recommendedThreadCount, markStats->_parallelEfficiency);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -352,6 +369,10 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (compactStats->_incremental) {
+			writer->formatAndOutput(env, 1, "<compact-increment subareas=\"%zu\" bytes=\"%zu\" pending=\"%zu\" />",
+					compactStats->_incrementSubAreas, compactStats->_incrementBytes, compactStats->_incrementPendingSubAreas);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -394,6 +415,25 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
 	}
 
+	if (extensions->adaptiveGCThreading && (UDATA_MAX != scavengerStats->_recommendedThreadCount)) {
+		writer->formatAndOutput(env, 1, "<gc-threads active=\"%zu\" recommended=\"%zu\" efficiency=\"%.3f\" />",
+				scavengerStats->_gcThreadCount, scavengerStats->_recommendedThreadCount, scavengerStats->_parallelEfficiency);
+	}
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (event->cycleEnd && extensions->isConcurrentScavengerEnabled()) {
+		uint64_t slowPathMicros = omrtime_hires_delta(0, cycleScavengerStats->_readObjectBarrierSlowPathTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<read-barrier slowpathscan=\"%llu\" slowpathcomplete=\"%llu\" threads=\"%zu\" timems=\"%llu.%03.3llu\" slowdown=\"%.2f\" />",
+				cycleScavengerStats->_readObjectBarrierSlowPathScan, cycleScavengerStats->_readObjectBarrierSlowPathComplete, cycleScavengerStats->_readObjectBarrierSlowPathThreads,
+				slowPathMicros / 1000, slowPathMicros % 1000, cycleScavengerStats->_mutatorSlowdown);
+		if (UDATA_MAX != cycleScavengerStats->_recommendedConcurrentThreadCount) {
+			writer->formatAndOutput(env, 1, "<concurrent-threads active=\"%zu\" recommended=\"%zu\" yield=\"%s\" />",
+					cycleScavengerStats->_concurrentThreadCount, cycleScavengerStats->_recommendedConcurrentThreadCount,
+					cycleScavengerStats->_concurrentYieldToMutators ? "true" : "false");
+		}
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	if (0 != scavengerStats->_flipCount) {
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_flipCount, scavengerStats->_flipBytes, scavengerStats->_flipDiscardBytes);
@@ -794,6 +834,68 @@ MM_VerboseHandlerOutputStandard::handleConcurrentAbortedInternal(MM_EnvironmentB
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+MM_VerboseHandlerOutputStandard::handleConcurrentSweepPhaseCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ConcurrentlyCompletedSweepPhase* event = (MM_ConcurrentlyCompletedSweepPhase*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	char tagTemplate[200];
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-sweep-phase-end %s>", tagTemplate);
+	writer->formatAndOutput(env, 1, "<sweep bytes=\"%zu\" timems=\"%llu.%03llu\" />", event->bytesSwept, event->timeElapsed / 1000, event->timeElapsed % 1000);
+	writer->formatAndOutput(env, 0, "</concurrent-sweep-phase-end>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+void
+MM_VerboseHandlerOutputStandard::handleConcurrentSweepCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompletedConcurrentSweep* event = (MM_CompletedConcurrentSweep*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	char tagTemplate[200];
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-sweep-end reason=\"%s\" %s>", getSweepCompletionReasonAsString(event->reason), tagTemplate);
+	writer->formatAndOutput(env, 1, "<sweep bytes=\"%zu\" timems=\"%llu.%03llu\" />", event->bytesSwept, event->timeElapsedSweep / 1000, event->timeElapsedSweep % 1000);
+	writer->formatAndOutput(env, 1, "<connect bytes=\"%zu\" timems=\"%llu.%03llu\" />", event->bytesConnected, event->timeElapsedConnect / 1000, event->timeElapsedConnect % 1000);
+	writer->formatAndOutput(env, 0, "</concurrent-sweep-end>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+const char *
+MM_VerboseHandlerOutputStandard::getSweepCompletionReasonAsString(uintptr_t reason)
+{
+	switch ((SweepCompletionReason)reason) {
+	case ABOUT_TO_GC:
+		return "about to gc";
+	case COMPACTION_REQUIRED:
+		return "compaction required";
+	case CONTRACTION_REQUIRED:
+		return "contraction required";
+	case EXPANSION_REQUIRED:
+		return "expansion required";
+	case LOA_RESIZE:
+		return "loa resize";
+	case SYSTEM_GC:
+		return "system gc";
+	default:
+		return "unknown";
+	}
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 bool
 MM_VerboseHandlerOutputStandard::hasOutputMemoryInfoInnerStanza()
 {
@@ -1066,6 +1168,20 @@ verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+verboseHandlerConcurrentSweepPhaseCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentSweepPhaseCompleted(hook, eventNum, eventData);
+}
+
+void
+verboseHandlerConcurrentSweepCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentSweepCompleted(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 void
 verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
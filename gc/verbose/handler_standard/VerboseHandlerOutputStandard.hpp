@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -198,6 +198,31 @@ public:
 	 */
 	void handleConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/**
+	 * Write verbose stanza for the sweep phase being completed concurrently with the mutators.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleConcurrentSweepPhaseCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Write verbose stanza for the stop-the-world completion of a concurrent sweep.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleConcurrentSweepCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Answer a string representation of the reason a concurrent sweep had to be completed.
+	 * @param reason[in] a SweepCompletionReason
+	 * @return string representing the reason
+	 */
+	const char *getSweepCompletionReasonAsString(uintptr_t reason);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARD_HPP_ */
@@ -274,6 +274,7 @@ struct ModronLnrlOptions {
 #define DEFAULT_MINIMUM_CONTRACTION_RATIO	10
 
 #define DESIRED_SUBAREA_SIZE		((uintptr_t)(4*1024*1024))
+#define INCREMENTAL_COMPACTION_SUBAREA_SIZE		((uintptr_t)(256*1024))
 
 typedef enum {
 	COMPACT_NONE = 0,
@@ -287,7 +288,8 @@ typedef enum {
 	COMPACT_CONTRACT = 11,
 	COMPACT_AGGRESSIVE= 12,
 	COMPACT_PAGE = 13,
-	COMPACT_MICRO_FRAG = 14
+	COMPACT_MICRO_FRAG = 14,
+	COMPACT_INCREMENTAL = 15
 } CompactReason;
 
 typedef enum {
@@ -423,7 +425,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	SCAV_PAUSE_ABOVE_TARGET
 } ContractReason;
 
 typedef enum {
@@ -434,7 +437,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	SCAV_PAUSE_BELOW_TARGET
 } ExpandReason;
 
 typedef enum {
@@ -448,6 +452,11 @@ typedef enum {
 	LOA_CONTRACT_LAST_RESIZE_REASON = LOA_CONTRACT_UNDERUTILIZED
 } LoaResizeReason;
 
+typedef enum {
+	RELEASE_FREE_PAGES_IDLE_GC = 1,
+	RELEASE_FREE_PAGES_IDLE_FREE_ENTRIES
+} ReleaseFreePagesReason;
+
 typedef enum {
 	FIXUP_NONE = 0,
 	FIXUP_CLASS_UNLOADING,
@@ -505,6 +514,7 @@ typedef enum {
 #define OMR_SCV_TENURE_RATIO_LOW 10
 #define OMR_SCV_TENURE_RATIO_HIGH 30
 #define OMR_SCV_REMSET_FRAGMENT_SIZE 32
+#define OMR_SCV_REMSET_FRAGMENT_MAX_SIZE 1024
 #define OMR_SCV_REMSET_SIZE 16384
 
 #define J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK 20
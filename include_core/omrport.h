@@ -852,6 +852,7 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_VMEM_NUMA_IN_USE  "VMEM_NUMA_IN_USE"
 #define OMRPORT_CTLDATA_VMEM_NUMA_ENABLE  "VMEM_NUMA_IN_ENABLE"
 #define OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_MEM "VMEM_NUMA_INTERLEAVE"
+#define OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_IN_USE "VMEM_NUMA_INTERLEAVE_IN_USE"
 #define OMRPORT_CTLDATA_SYSLOG_OPEN  "SYSLOG_OPEN"
 #define OMRPORT_CTLDATA_SYSLOG_CLOSE  "SYSLOG_CLOSE"
 #define OMRPORT_CTLDATA_NOIPT  "NOIPT"
@@ -864,6 +865,7 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_VECTOR_REGS_SUPPORT_ON  "VECTOR_REGS_SUPPORT_ON"
 #define OMRPORT_CTLDATA_NLS_DISABLE "NLS_DISABLE"
 #define OMRPORT_CTLDATA_VMEM_ADVISE_HUGEPAGE  "VMEM_ADVISE_HUGEPAGE"
+#define OMRPORT_CTLDATA_VMEM_ADVISE_HUGEPAGE_IN_USE  "VMEM_ADVISE_HUGEPAGE_IN_USE"
 #define OMRPORT_CTLDATA_VMEM_PERFORM_FULL_MEMORY_SEARCH  "VMEM_PERFORM_FULL_SEARCH"
 #define OMRPORT_CTLDATA_VMEM_HUGE_PAGES_MMAP_ENABLED "VMEM_HUGE_PAGES_MMAP_ENABLED"
 
@@ -0,0 +1,354 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/JBCompilationQueue.hpp"
+
+#include <new>
+#include "AtomicSupport.hpp"
+#include "compile/Compilation.hpp"
+#include "env/CompilerEnv.hpp"
+#include "infra/Assert.hpp"
+
+namespace
+{
+
+/**
+ * Attaches the current thread to the omrthread library for the lifetime of the
+ * object, which is a no-op beyond counting for threads that are attached already.
+ */
+class AttachedThread
+   {
+   public:
+
+   AttachedThread() : _self(NULL)
+      {
+      intptr_t rc = omrthread_attach(&_self);
+      TR_ASSERT_FATAL(0 == rc, "failed to attach thread to the thread library, rc=%d", (int32_t)rc);
+      }
+
+   ~AttachedThread()
+      {
+      omrthread_detach(_self);
+      }
+
+   private:
+
+   omrthread_t _self;
+   };
+
+}
+
+JitBuilder::CompilationQueue::CompilationQueue(CompileFunction compile)
+   : _compile(compile),
+     _monitor(NULL),
+     _live(NULL),
+     _numThreads(0),
+     _liveThreads(0),
+     _shuttingDown(false)
+   {
+   for (int32_t i = 0; i < NumPriorities; i++)
+      {
+      _head[i] = NULL;
+      _tail[i] = NULL;
+      }
+   }
+
+JitBuilder::CompilationQueue *
+JitBuilder::CompilationQueue::create(int32_t numThreads, CompileFunction compile)
+   {
+   AttachedThread attached;
+
+   void *storage = TR::Compiler->persistentAllocator().allocate(sizeof(CompilationQueue), std::nothrow);
+   if (NULL == storage)
+      return NULL;
+
+   CompilationQueue *queue = new (storage) CompilationQueue(compile);
+   if (0 != omrthread_monitor_init_with_name(&queue->_monitor, 0, "JIT-CompilationQueueMonitor"))
+      {
+      TR::Compiler->persistentAllocator().deallocate(queue);
+      return NULL;
+      }
+
+   if (!queue->startThreads(numThreads))
+      {
+      destroy(queue);
+      return NULL;
+      }
+
+   return queue;
+   }
+
+void
+JitBuilder::CompilationQueue::destroy(CompilationQueue *queue)
+   {
+   AttachedThread attached;
+
+   queue->stopThreads();
+
+   while (NULL != queue->_live)
+      queue->freeRequest(queue->_live);
+
+   omrthread_monitor_destroy(queue->_monitor);
+   TR::Compiler->persistentAllocator().deallocate(queue);
+   }
+
+bool
+JitBuilder::CompilationQueue::startThreads(int32_t numThreads)
+   {
+   omrthread_monitor_enter(_monitor);
+   for (int32_t i = 0; i < numThreads; i++)
+      {
+      omrthread_t thread = NULL;
+      if (0 != omrthread_create(&thread, CompilationThreadStackSize, J9THREAD_PRIORITY_NORMAL, 0, compilationThread, this))
+         break;
+      _numThreads += 1;
+      _liveThreads += 1;
+      }
+   omrthread_monitor_exit(_monitor);
+
+   return (_numThreads == numThreads);
+   }
+
+void
+JitBuilder::CompilationQueue::stopThreads()
+   {
+   omrthread_monitor_enter(_monitor);
+   _shuttingDown = true;
+
+   // complete the requests nobody has started to compile
+   CompilationRequest *request = NULL;
+   while (NULL != (request = dequeue()))
+      {
+      request->_rc = COMPILATION_FAILED;
+      request->_state = CompilationRequest::Done;
+      if (request->_released)
+         freeRequest(request);
+      }
+
+   omrthread_monitor_notify_all(_monitor);
+   while (_liveThreads > 0)
+      omrthread_monitor_wait(_monitor);
+   omrthread_monitor_exit(_monitor);
+   }
+
+int J9THREAD_PROC
+JitBuilder::CompilationQueue::compilationThread(void *queue)
+   {
+   static_cast<CompilationQueue *>(queue)->serveRequests();
+   return 0;
+   }
+
+void
+JitBuilder::CompilationQueue::serveRequests()
+   {
+   omrthread_monitor_enter(_monitor);
+   while (true)
+      {
+      CompilationRequest *request = dequeue();
+      if (NULL == request)
+         {
+         if (_shuttingDown)
+            break;
+         omrthread_monitor_wait(_monitor);
+         continue;
+         }
+
+      request->_state = CompilationRequest::InProgress;
+      omrthread_monitor_exit(_monitor);
+
+      // scratch memory of the compilation comes from a region of this thread
+      // that is released before the compilation returns
+      void *startPC = NULL;
+      int32_t rc = _compile(request->_methodBuilder, request->_hotness, &startPC);
+      if (COMPILATION_SUCCEEDED == rc && NULL != request->_entryPoint)
+         {
+         // the compiled code must be visible before the entry point leading to it
+         VM_AtomicSupport::writeBarrier();
+         *request->_entryPoint = startPC;
+         }
+
+      omrthread_monitor_enter(_monitor);
+      request->_startPC = startPC;
+      request->_rc = rc;
+      request->_state = CompilationRequest::Done;
+      if (request->_released)
+         freeRequest(request);
+      omrthread_monitor_notify_all(_monitor);
+      }
+
+   _liveThreads -= 1;
+   omrthread_monitor_notify_all(_monitor);
+   omrthread_exit(_monitor);
+   }
+
+JitBuilder::CompilationRequest *
+JitBuilder::CompilationQueue::submit(TR::MethodBuilder *methodBuilder, TR_Hotness hotness, void **entryPoint)
+   {
+   AttachedThread attached;
+
+   void *storage = TR::Compiler->persistentAllocator().allocate(sizeof(CompilationRequest), std::nothrow);
+   if (NULL == storage)
+      return NULL;
+
+   CompilationRequest *request = static_cast<CompilationRequest *>(storage);
+   request->_methodBuilder = methodBuilder;
+   request->_hotness = (hotness > maxHotness) ? maxHotness : hotness;
+   request->_entryPoint = entryPoint;
+   request->_startPC = NULL;
+   request->_rc = COMPILATION_REQUESTED;
+   request->_state = CompilationRequest::Queued;
+   request->_released = false;
+   request->_next = NULL;
+
+   omrthread_monitor_enter(_monitor);
+   request->_prevLive = NULL;
+   request->_nextLive = _live;
+   if (NULL != _live)
+      _live->_prevLive = request;
+   _live = request;
+
+   if (_shuttingDown)
+      {
+      request->_rc = COMPILATION_FAILED;
+      request->_state = CompilationRequest::Done;
+      }
+   else
+      {
+      enqueue(request);
+      omrthread_monitor_notify_all(_monitor);
+      }
+   omrthread_monitor_exit(_monitor);
+
+   return request;
+   }
+
+int32_t
+JitBuilder::CompilationQueue::getStatus(CompilationRequest *request)
+   {
+   AttachedThread attached;
+
+   omrthread_monitor_enter(_monitor);
+   int32_t rc = request->_rc;
+   omrthread_monitor_exit(_monitor);
+
+   return rc;
+   }
+
+int32_t
+JitBuilder::CompilationQueue::wait(CompilationRequest *request)
+   {
+   AttachedThread attached;
+
+   omrthread_monitor_enter(_monitor);
+   while (CompilationRequest::Done != request->_state)
+      omrthread_monitor_wait(_monitor);
+   int32_t rc = request->_rc;
+   omrthread_monitor_exit(_monitor);
+
+   return rc;
+   }
+
+void
+JitBuilder::CompilationQueue::release(CompilationRequest *request)
+   {
+   AttachedThread attached;
+
+   omrthread_monitor_enter(_monitor);
+   switch (request->_state)
+      {
+      case CompilationRequest::Queued:
+         remove(request);
+         freeRequest(request);
+         break;
+      case CompilationRequest::InProgress:
+         request->_released = true;
+         break;
+      case CompilationRequest::Done:
+         freeRequest(request);
+         break;
+      }
+   omrthread_monitor_exit(_monitor);
+   }
+
+void
+JitBuilder::CompilationQueue::enqueue(CompilationRequest *request)
+   {
+   int32_t priority = request->_hotness;
+   if (NULL == _tail[priority])
+      _head[priority] = request;
+   else
+      _tail[priority]->_next = request;
+   _tail[priority] = request;
+   }
+
+JitBuilder::CompilationRequest *
+JitBuilder::CompilationQueue::dequeue()
+   {
+   for (int32_t priority = NumPriorities - 1; priority >= 0; priority--)
+      {
+      CompilationRequest *request = _head[priority];
+      if (NULL != request)
+         {
+         _head[priority] = request->_next;
+         if (NULL == _head[priority])
+            _tail[priority] = NULL;
+         request->_next = NULL;
+         return request;
+         }
+      }
+   return NULL;
+   }
+
+void
+JitBuilder::CompilationQueue::remove(CompilationRequest *request)
+   {
+   int32_t priority = request->_hotness;
+   CompilationRequest *previous = NULL;
+   for (CompilationRequest *cursor = _head[priority]; NULL != cursor; cursor = cursor->_next)
+      {
+      if (cursor == request)
+         {
+         if (NULL == previous)
+            _head[priority] = request->_next;
+         else
+            previous->_next = request->_next;
+         if (_tail[priority] == request)
+            _tail[priority] = previous;
+         request->_next = NULL;
+         return;
+         }
+      previous = cursor;
+      }
+   }
+
+void
+JitBuilder::CompilationQueue::freeRequest(CompilationRequest *request)
+   {
+   if (NULL == request->_prevLive)
+      _live = request->_nextLive;
+   else
+      request->_prevLive->_nextLive = request->_nextLive;
+   if (NULL != request->_nextLive)
+      request->_nextLive->_prevLive = request->_prevLive;
+
+   TR::Compiler->persistentAllocator().deallocate(request);
+   }
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITBUILDER_COMPILATIONQUEUE_HPP
+#define JITBUILDER_COMPILATIONQUEUE_HPP
+
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+#include "omrthread.h"
+
+namespace TR { class MethodBuilder; }
+
+namespace JitBuilder
+{
+
+/**
+ * @brief A request to compile a MethodBuilder on a compilation thread.
+ *
+ * Requests are created by CompilationQueue::submit() and stay valid until they
+ * are passed to CompilationQueue::release().  The MethodBuilder, and any
+ * TypeDictionary it uses, must not be compiled or changed elsewhere while the
+ * request is queued or in progress.
+ */
+struct CompilationRequest
+   {
+   enum State
+      {
+      Queued,
+      InProgress,
+      Done
+      };
+
+   TR::MethodBuilder *_methodBuilder;
+   TR_Hotness _hotness;
+   void **_entryPoint;  // patched with the start of the compiled code on success, may be NULL
+   void *_startPC;
+   int32_t _rc;
+   State _state;
+   bool _released;      // released while in progress, the compilation thread frees it when done
+   CompilationRequest *_next;      // next request of the same hotness in the queue
+   CompilationRequest *_nextLive;  // requests not released yet, freed by CompilationQueue::destroy()
+   CompilationRequest *_prevLive;
+   };
+
+/**
+ * @brief A pool of compilation threads serving a queue of compilation requests.
+ *
+ * Requests are compiled hottest first and in submission order within a hotness
+ * level.  Each compilation allocates its scratch memory from a TR::Region of
+ * the compilation thread that performs it, so compilations running in parallel
+ * share nothing but persistent memory and the code cache.  The pool is made of
+ * TR::Options::getNumUsableCompilationThreads() threads, set with
+ * -Xjit:compilationThreads=<n>.
+ *
+ * Every thread calling into the queue is attached to the omrthread library for
+ * the duration of the call.
+ */
+class CompilationQueue
+   {
+   public:
+
+   typedef int32_t (*CompileFunction)(TR::MethodBuilder *methodBuilder, TR_Hotness hotness, void **entryPoint);
+
+   /**
+    * @brief create the queue and start its compilation threads
+    * @param compile the function performing a compilation on a compilation thread
+    * @returns the queue, or NULL if it or one of its threads could not be created
+    */
+   static CompilationQueue *create(int32_t numThreads, CompileFunction compile);
+
+   /**
+    * @brief stop the compilation threads and free the queue
+    *
+    * Requests still queued are completed with COMPILATION_FAILED, compilations
+    * in progress are waited for.  Requests that were not released are freed.
+    */
+   static void destroy(CompilationQueue *queue);
+
+   /**
+    * @brief queue a MethodBuilder for compilation
+    * @param entryPoint if not NULL, written with the entry point of the compiled code once it is ready
+    * @returns the request, or NULL if it could not be allocated
+    */
+   CompilationRequest *submit(TR::MethodBuilder *methodBuilder, TR_Hotness hotness, void **entryPoint);
+
+   /**
+    * @returns COMPILATION_REQUESTED while the request is queued or in progress, its return code once done
+    */
+   int32_t getStatus(CompilationRequest *request);
+
+   /**
+    * @brief block until the request is done
+    * @returns the return code of the compilation
+    */
+   int32_t wait(CompilationRequest *request);
+
+   /**
+    * @brief give up a request, which must not be used afterwards
+    *
+    * A queued request is removed from the queue without being compiled, a
+    * request in progress is freed when its compilation ends.  The entry point of
+    * a request in progress is still patched if its compilation succeeds.
+    */
+   void release(CompilationRequest *request);
+
+   int32_t getNumThreads() { return _numThreads; }
+
+   private:
+
+   static const uintptr_t CompilationThreadStackSize = 8 * 1024 * 1024;
+   static const int32_t NumPriorities = maxHotness + 1;
+
+   CompilationQueue(CompileFunction compile);
+
+   bool startThreads(int32_t numThreads);
+   void stopThreads();
+
+   static int J9THREAD_PROC compilationThread(void *queue);
+   void serveRequests();
+
+   void enqueue(CompilationRequest *request);
+   CompilationRequest *dequeue();
+   void remove(CompilationRequest *request);
+   void freeRequest(CompilationRequest *request);
+
+   CompileFunction _compile;
+   omrthread_monitor_t _monitor;    // protects the queue, the request states and the thread counts
+   CompilationRequest *_head[NumPriorities];
+   CompilationRequest *_tail[NumPriorities];
+   CompilationRequest *_live;
+   int32_t _numThreads;
+   int32_t _liveThreads;
+   bool _shuttingDown;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_COMPILATIONQUEUE_HPP)
@@ -21,10 +21,13 @@
  *******************************************************************************/
 
 #include <stdio.h>
+#include "AtomicSupport.hpp"
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
 #include "control/CompileMethod.hpp"
+#include "control/JBCompilationQueue.hpp"
+#include "control/Options.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/IO.hpp"
@@ -105,6 +108,8 @@ initializeCodeCache(TR::CodeCacheManager & codeCacheManager)
    codeCacheConfig._emitExecutableELF = TR::Options::getCmdLineOptions()->getOption(TR_PerfTool) 
                                     ||  TR::Options::getCmdLineOptions()->getOption(TR_EmitExecutableELFFile);
    codeCacheConfig._emitRelocatableELF = TR::Options::getCmdLineOptions()->getOption(TR_EmitRelocatableELFFile);
+   codeCacheConfig._emitPerfJitDump = TR::Options::getCmdLineOptions()->getOption(TR_PerfToolJitDump);
+   codeCacheConfig._persistentCodeCacheDir = TR::Options::getCmdLineOptions()->getPersistentCodeCacheDir();
 
    TR::CodeCache *firstCodeCache = codeCacheManager.initialize(true, 1);
    }
@@ -184,10 +189,10 @@ internal_initializeJit()
    return initializeJitBuilder(0, 0, 0, (char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator");
    }
 
-int32_t
-internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+static int32_t
+compileMethodBuilder(TR::MethodBuilder *m, TR_Hotness hotness, void **entry)
    {
-   auto rc = m->Compile(entry);
+   auto rc = m->Compile(entry, hotness);
 
 #if defined(AIXPPC)
    struct FunctionDescriptor
@@ -210,11 +215,90 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
    return rc;
    }
 
+int32_t
+internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+   {
+   return compileMethodBuilder(m, warm, entry);
+   }
+
+// Created by the first asynchronous compilation request, destroyed by shutdownJit()
+static JitBuilder::CompilationQueue * volatile compilationQueue = NULL;
+
+// Threads racing on the first request each create a queue, only one is published
+static JitBuilder::CompilationQueue *
+getCompilationQueue()
+   {
+   JitBuilder::CompilationQueue *queue = compilationQueue;
+   if (NULL == queue)
+      {
+      int32_t numThreads = TR::Options::getNumUsableCompilationThreads();
+      queue = JitBuilder::CompilationQueue::create(numThreads > 0 ? numThreads : 1, compileMethodBuilder);
+      if (NULL == queue)
+         return NULL;
+
+      uintptr_t published = VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&compilationQueue, 0, (uintptr_t)queue);
+      if (0 != published)
+         {
+         JitBuilder::CompilationQueue::destroy(queue);
+         queue = (JitBuilder::CompilationQueue *)published;
+         }
+      }
+   return queue;
+   }
+
+void *
+internal_compileMethodBuilderAsync(TR::MethodBuilder *m, int32_t hotness, void **entry)
+   {
+   JitBuilder::CompilationQueue *queue = getCompilationQueue();
+   if (NULL == queue)
+      return NULL;
+
+   if (hotness < noOpt)
+      hotness = noOpt;
+   else if (hotness > maxHotness)
+      hotness = maxHotness;
+
+   return queue->submit(m, static_cast<TR_Hotness>(hotness), entry);
+   }
+
+int32_t
+internal_getCompilationStatus(void *request)
+   {
+   JitBuilder::CompilationQueue *queue = compilationQueue;
+   if (NULL == queue || NULL == request)
+      return COMPILATION_FAILED;
+   return queue->getStatus(static_cast<JitBuilder::CompilationRequest *>(request));
+   }
+
+int32_t
+internal_waitForCompilation(void *request)
+   {
+   JitBuilder::CompilationQueue *queue = compilationQueue;
+   if (NULL == queue || NULL == request)
+      return COMPILATION_FAILED;
+   return queue->wait(static_cast<JitBuilder::CompilationRequest *>(request));
+   }
+
+void
+internal_releaseCompilation(void *request)
+   {
+   JitBuilder::CompilationQueue *queue = compilationQueue;
+   if (NULL != queue && NULL != request)
+      queue->release(static_cast<JitBuilder::CompilationRequest *>(request));
+   }
+
 void
 internal_shutdownJit()
    {
    auto fe = JitBuilder::FrontEnd::instance();
 
+   // compilation threads must be stopped before the code cache goes away
+   if (NULL != compilationQueue)
+      {
+      JitBuilder::CompilationQueue::destroy(compilationQueue);
+      compilationQueue = NULL;
+      }
+
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
 
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "AsyncCompile.hpp"
+
+// Hotness levels accepted by compileMethodBuilderAsync(), hotter requests are compiled first
+#define HOTNESS_WARM 2
+#define HOTNESS_HOT 3
+
+#define NUM_METHODS 4
+
+PolynomialMethod::PolynomialMethod(OMR::JitBuilder::TypeDictionary *types, int32_t coefficient)
+   : OMR::JitBuilder::MethodBuilder(types),
+   _coefficient(coefficient)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("polynomial");
+   DefineParameter("x", Int32);
+   DefineReturnType(Int32);
+   }
+
+bool
+PolynomialMethod::buildIL()
+   {
+   Return(
+      Add(
+         Mul(
+            Load("x"),
+            Load("x")),
+         Mul(
+            ConstInt32(_coefficient),
+            Load("x"))));
+
+   return true;
+   }
+
+// Runs until the compiled code is installed, as an interpreter would
+static int32_t coefficients[NUM_METHODS] = { 1, 2, 3, 4 };
+
+static int32_t polynomial0(int32_t x) { return x * x + coefficients[0] * x; }
+static int32_t polynomial1(int32_t x) { return x * x + coefficients[1] * x; }
+static int32_t polynomial2(int32_t x) { return x * x + coefficients[2] * x; }
+static int32_t polynomial3(int32_t x) { return x * x + coefficients[3] * x; }
+
+static PolynomialFunctionType *fallbacks[NUM_METHODS] = { polynomial0, polynomial1, polynomial2, polynomial3 };
+
+int
+main(int argc, char *argv[])
+   {
+   printf("Step 1: initialize JIT\n");
+   bool initialized = initializeJit();
+   if (!initialized)
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   printf("Step 2: define relevant types\n");
+   // methods compiled at the same time must not share a TypeDictionary
+   OMR::JitBuilder::TypeDictionary *types[NUM_METHODS];
+   PolynomialMethod *methods[NUM_METHODS];
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      {
+      types[m] = new OMR::JitBuilder::TypeDictionary();
+      methods[m] = new PolynomialMethod(types[m], coefficients[m]);
+      }
+
+   printf("Step 3: queue method builders for compilation\n");
+   void * volatile entries[NUM_METHODS];
+   void *requests[NUM_METHODS];
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      {
+      entries[m] = (void *)fallbacks[m];
+      requests[m] = compileMethodBuilderAsync(methods[m], (m % 2) ? HOTNESS_HOT : HOTNESS_WARM, (void **)&entries[m]);
+      if (NULL == requests[m])
+         {
+         fprintf(stderr, "FAIL: could not queue compilation %d\n", m);
+         exit(-2);
+         }
+      }
+
+   printf("Step 4: invoke code while it is being compiled\n");
+   int32_t failures = 0;
+   for (int32_t i = 0; i < 100000; i++)
+      {
+      int32_t m = i % NUM_METHODS;
+      PolynomialFunctionType *polynomial = (PolynomialFunctionType *)entries[m];
+      int32_t x = i % 100;
+      if (polynomial(x) != x * x + coefficients[m] * x)
+         failures++;
+      }
+
+   printf("Step 5: wait for compilations\n");
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      {
+      int32_t rc = waitForCompilation(requests[m]);
+      if (rc != 0 || rc != getCompilationStatus(requests[m]))
+         {
+         fprintf(stderr, "FAIL: compilation error %d\n", rc);
+         exit(-3);
+         }
+      if (entries[m] == (void *)fallbacks[m])
+         {
+         fprintf(stderr, "FAIL: entry point %d was not installed\n", m);
+         exit(-4);
+         }
+      releaseCompilation(requests[m]);
+      }
+
+   printf("Step 6: invoke compiled code\n");
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      {
+      PolynomialFunctionType *polynomial = (PolynomialFunctionType *)entries[m];
+      int32_t r = polynomial(7);
+      printf("polynomial%d(7) is %d\n", m, r);
+      if (r != 7 * 7 + coefficients[m] * 7)
+         failures++;
+      }
+
+   if (failures > 0)
+      {
+      fprintf(stderr, "FAIL: %d wrong results\n", failures);
+      exit(-5);
+      }
+
+   printf ("Step 7: shutdown JIT\n");
+   shutdownJit();
+
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      {
+      delete methods[m];
+      delete types[m];
+      }
+
+   printf("PASS\n");
+   }
@@ -0,0 +1,394 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+#include "JitDump.hpp"
+
+// Record layouts, see tools/perf/Documentation/jitdump-specification.txt
+#define JIT_CODE_LOAD 0
+#define JIT_CODE_DEBUG_INFO 2
+#define JIT_CODE_CLOSE 3
+#define JIT_CODE_UNWINDING_INFO 4
+
+#define DW_CFA_advance_loc 0x40
+#define DW_CFA_offset 0x80
+#define DW_CFA_nop 0x00
+#define DW_CFA_advance_loc1 0x02
+#define DW_CFA_advance_loc2 0x03
+#define DW_CFA_advance_loc4 0x04
+#define DW_CFA_def_cfa 0x0c
+
+#define DWARF_RSP 7
+#define DWARF_RETURN_ADDRESS 16
+
+static int32_t
+scale(int32_t x, int32_t y)
+   {
+   #define SCALE_LINE LINETOSTR(__LINE__)
+   return x * 10 + y;
+   }
+
+JitDumpMethod::JitDumpMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("jitDumpMethod");
+   DefineParameter("x", Int32);
+   DefineParameter("y", Int32);
+   DefineReturnType(Int32);
+
+   DefineFunction((char *)"scale",
+                  (char *)__FILE__,
+                  (char *)SCALE_LINE,
+                  (void *)&scale,
+                  Int32,
+                  2,
+                  Int32,
+                  Int32);
+   }
+
+bool
+JitDumpMethod::buildIL()
+   {
+   Store("a",
+      Mul(
+         Load("x"),
+         ConstInt32(3)));
+   Store("b",
+      Add(
+         Load("y"),
+         ConstInt32(7)));
+
+   Store("c",
+      Call("scale", 2,
+         Load("a"),
+         Load("b")));
+
+   Return(
+      Add(
+         Mul(
+            Load("a"),
+            Load("b")),
+         Load("c")));
+
+   return true;
+   }
+
+static int32_t failures = 0;
+
+static void
+check(bool ok, const char *what)
+   {
+   if (!ok)
+      {
+      fprintf(stderr, "FAIL: %s\n", what);
+      failures++;
+      }
+   }
+
+static uint32_t get32(const uint8_t *p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+static uint64_t get64(const uint8_t *p) { uint64_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+static uint32_t
+getULEB128(const uint8_t *&cursor)
+   {
+   uint32_t value = 0;
+   uint32_t shift = 0;
+   uint8_t byte;
+   do
+      {
+      byte = *cursor++;
+      value |= (uint32_t)(byte & 0x7f) << shift;
+      shift += 7;
+      }
+   while (byte & 0x80);
+   return value;
+   }
+
+// Is the instruction ending at code + end "mov [rsp + displacement], reg" for the
+// register with the given DWARF number?
+static bool
+isSaveToStack(const uint8_t *code, uint32_t end, uint32_t dwarfRegister, int32_t displacement)
+   {
+   static const uint8_t x86Numbers[] = { 0, 2, 1, 3, 6, 7, 5, 4, 8, 9, 10, 11, 12, 13, 14, 15 };
+   if (dwarfRegister >= sizeof(x86Numbers))
+      return false;
+   uint8_t reg = x86Numbers[dwarfRegister];
+   uint8_t rex = 0x48 | ((reg & 8) ? 0x04 : 0);
+   uint8_t modRM = ((reg & 7) << 3) | 0x04;
+
+   uint8_t forms[3][9];
+   uint32_t lengths[3] = { 0, 0, 0 };
+   int32_t numForms = 0;
+   if (displacement == 0)
+      {
+      const uint8_t bytes[] = { rex, 0x89, modRM, 0x24 };
+      memcpy(forms[numForms], bytes, sizeof(bytes));
+      lengths[numForms++] = sizeof(bytes);
+      }
+   if (displacement >= -128 && displacement <= 127)
+      {
+      const uint8_t bytes[] = { rex, 0x89, (uint8_t)(0x40 | modRM), 0x24, (uint8_t)displacement };
+      memcpy(forms[numForms], bytes, sizeof(bytes));
+      lengths[numForms++] = sizeof(bytes);
+      }
+   const uint8_t bytes[] = { rex, 0x89, (uint8_t)(0x80 | modRM), 0x24 };
+   memcpy(forms[numForms], bytes, sizeof(bytes));
+   memcpy(forms[numForms] + sizeof(bytes), &displacement, sizeof(displacement));
+   lengths[numForms++] = sizeof(bytes) + sizeof(displacement);
+
+   for (int32_t i = 0; i < numForms; i++)
+      {
+      if (lengths[i] <= end && memcmp(code + end - lengths[i], forms[i], lengths[i]) == 0)
+         return true;
+      }
+   return false;
+   }
+
+/**
+ * Run the call frame instructions of the FDE and check that every preserved
+ * register it describes is stored, where it says, by the instruction that ends
+ * where the rule takes effect.
+ * @return the number of preserved register rules checked
+ */
+static int32_t
+checkCallFrameInstructions(const uint8_t *instructions, const uint8_t *end, const uint8_t *code, uint32_t codeSize)
+   {
+   uint32_t location = 0;
+   uint32_t cfaRegister = DWARF_RSP;
+   uint32_t cfaOffset = 8;
+   int32_t savedRegisters = 0;
+   const uint8_t *cursor = instructions;
+   while (cursor < end)
+      {
+      uint8_t op = *cursor++;
+      if ((op & 0xc0) == DW_CFA_advance_loc)
+         location += op & 0x3f;
+      else if ((op & 0xc0) == DW_CFA_offset)
+         {
+         uint32_t reg = op & 0x3f;
+         int32_t offset = getULEB128(cursor) * 8;
+         if (reg == DWARF_RETURN_ADDRESS)
+            {
+            check(offset == 8, "return address is not right below the CFA");
+            continue;
+            }
+         check(cfaRegister == DWARF_RSP, "preserved register saved with the CFA off a frame pointer");
+         check(isSaveToStack(code, location, reg, cfaOffset - offset), "preserved register rule does not follow the store of the register to its save slot");
+         savedRegisters++;
+         }
+      else if (op == DW_CFA_advance_loc1)
+         location += *cursor++;
+      else if (op == DW_CFA_advance_loc2)
+         {
+         location += cursor[0] | (cursor[1] << 8);
+         cursor += 2;
+         }
+      else if (op == DW_CFA_advance_loc4)
+         {
+         location += get32(cursor);
+         cursor += 4;
+         }
+      else if (op == DW_CFA_def_cfa)
+         {
+         cfaRegister = getULEB128(cursor);
+         cfaOffset = getULEB128(cursor);
+         }
+      else if (op != DW_CFA_nop)
+         {
+         check(false, "unexpected call frame instruction");
+         return savedRegisters;
+         }
+      check(location <= codeSize, "call frame instructions advance past the end of the code");
+      }
+   return savedRegisters;
+   }
+
+static void
+checkDebugInfo(const uint8_t *record, uint32_t size, void *entry, uint32_t codeSize)
+   {
+   check(get64(record + 16) == (uintptr_t)entry, "debug info is not for the method");
+   uint64_t numEntries = get64(record + 24);
+   check(numEntries > 0, "debug info has no entries");
+
+   const uint8_t *cursor = record + 32;
+   for (uint64_t i = 0; i < numEntries && cursor < record + size; i++)
+      {
+      uint64_t address = get64(cursor);
+      check(address >= (uintptr_t)entry && address < (uintptr_t)entry + codeSize, "debug info entry outside of the method");
+      const char *fileName = (const char *)cursor + 16;
+      check(strstr(fileName, "jitDumpMethod") != NULL, "debug info entry does not name the method");
+      cursor += 16 + strlen(fileName) + 1;
+      }
+   check(cursor <= record + size, "debug info entries overrun the record");
+   }
+
+static void
+checkUnwindingInfo(const uint8_t *record, uint32_t size, const uint8_t *code, uint32_t codeSize)
+   {
+   uint64_t unwindingSize = get64(record + 16);
+   uint64_t ehFrameHdrSize = get64(record + 24);
+   check(get64(record + 32) == unwindingSize, "mapped size differs from the unwinding data size");
+   check(40 + unwindingSize <= size && ehFrameHdrSize < unwindingSize, "unwinding data overruns the record");
+
+   const uint8_t *cie = record + 40;
+   uint32_t cieSize = get32(cie) + 4;
+   check(get32(cie + 4) == 0 && cie[8] == 1, "no CIE at the start of .eh_frame");
+   check(strcmp((const char *)cie + 9, "zR") == 0, "CIE augmentation is not zR");
+   check(cie[12] == 1 && cie[13] == 0x78 && cie[14] == DWARF_RETURN_ADDRESS, "CIE alignment factors or return address column are wrong");
+
+   const uint8_t *fde = cie + cieSize;
+   uint32_t fdeSize = get32(fde) + 4;
+   check(get32(fde + 4) == (uint32_t)(fde + 4 - cie), "FDE does not point back to the CIE");
+   check(get32(fde + 12) == codeSize, "FDE does not cover the method");
+   check(fde[16] == 0, "FDE has augmentation data");
+
+   check(checkCallFrameInstructions(fde + 17, fde + fdeSize, code, codeSize) > 0, "no preserved register is described");
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   printf("Step 1: initialize JIT with perfToolJitDump\n");
+   bool initialized = initializeJitWithOptions((char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,perfToolJitDump");
+   if (!initialized)
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   printf("Step 2: define type dictionary\n");
+   OMR::JitBuilder::TypeDictionary types;
+
+   printf("Step 3: compile method builder\n");
+   JitDumpMethod method(&types);
+   void *entry = 0;
+   int32_t rc = compileMethodBuilder(&method, &entry);
+   if (rc != 0)
+      {
+      fprintf(stderr,"FAIL: compilation error %d\n", rc);
+      exit(-2);
+      }
+
+   printf("Step 4: invoke compiled code\n");
+   JitDumpFunctionType *jitDumpMethod = (JitDumpFunctionType *)entry;
+   int32_t a = 5 * 3, b = 4 + 7;
+   check(jitDumpMethod(5, 4) == a * b + scale(a, b), "jitDumpMethod(5, 4) is wrong");
+
+   uint8_t entryBytes[16];
+   memcpy(entryBytes, entry, sizeof(entryBytes));
+
+   printf("Step 5: shutdown JIT, which closes the dump\n");
+   shutdownJit();
+
+   printf("Step 6: read back the dump\n");
+   char fileName[64];
+   snprintf(fileName, sizeof(fileName), "/tmp/jit-%d.dump", getpid());
+   FILE *file = fopen(fileName, "rb");
+   if (file == NULL)
+      {
+      fprintf(stderr, "FAIL: no %s\n", fileName);
+      exit(-3);
+      }
+   std::vector<uint8_t> dump;
+   uint8_t buffer[4096];
+   size_t bytesRead;
+   while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+      dump.insert(dump.end(), buffer, buffer + bytesRead);
+   fclose(file);
+   unlink(fileName);
+
+   if (dump.size() < 40)
+      {
+      fprintf(stderr, "FAIL: %s is too short\n", fileName);
+      exit(-3);
+      }
+   const uint8_t *data = &dump[0];
+   check(get32(data) == 0x4A695444, "bad magic");
+   check(get32(data + 4) == 1 && get32(data + 8) == 40, "bad version or header size");
+   check(get32(data + 20) == (uint32_t)getpid(), "header has the wrong pid");
+
+   const uint8_t *debugInfo = NULL, *unwindingInfo = NULL;
+   bool foundLoad = false, foundClose = false;
+   size_t offset = get32(data + 8);
+   while (offset + 16 <= dump.size())
+      {
+      const uint8_t *record = data + offset;
+      uint32_t id = get32(record);
+      uint32_t size = get32(record + 4);
+      if (size < 16 || offset + size > dump.size())
+         {
+         check(false, "record overruns the dump");
+         break;
+         }
+
+      if (id == JIT_CODE_DEBUG_INFO)
+         debugInfo = record;
+      else if (id == JIT_CODE_UNWINDING_INFO)
+         unwindingInfo = record;
+      else if (id == JIT_CODE_CLOSE)
+         foundClose = true;
+      else if (id == JIT_CODE_LOAD)
+         {
+         uint64_t codeAddress = get64(record + 32);
+         uint32_t codeSize = (uint32_t)get64(record + 40);
+         const char *name = (const char *)record + 56;
+         const uint8_t *code = record + 56 + strlen(name) + 1;
+         if (codeAddress == (uintptr_t)entry)
+            {
+            foundLoad = true;
+            check(get64(record + 24) == codeAddress, "code load vma differs from the code address");
+            check(strstr(name, "jitDumpMethod") != NULL, "code load does not name the method");
+            check(code + codeSize <= record + size, "code overruns the code load record");
+            check(memcmp(code, entryBytes, sizeof(entryBytes)) == 0, "code load does not hold the compiled code");
+
+            check(debugInfo != NULL, "no debug info before the code load");
+            if (debugInfo)
+               checkDebugInfo(debugInfo, get32(debugInfo + 4), entry, codeSize);
+            check(unwindingInfo != NULL, "no unwinding info before the code load");
+            if (unwindingInfo)
+               checkUnwindingInfo(unwindingInfo, get32(unwindingInfo + 4), code, codeSize);
+            }
+         debugInfo = unwindingInfo = NULL;
+         }
+      offset += size;
+      }
+   check(foundLoad, "no code load record for the method");
+   check(foundClose, "no close record");
+
+   if (failures > 0)
+      {
+      fprintf(stderr, "FAIL: %d checks failed\n", failures);
+      exit(-4);
+      }
+
+   printf("PASS\n");
+   }
@@ -0,0 +1,346 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "LoopVectorization.hpp"
+
+#define MAX_LENGTH 67
+
+MulDoubleMethod::MulDoubleMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("mulDouble");
+
+   pDouble = types->PointerTo(Double);
+
+   DefineParameter("result", pDouble);
+   DefineParameter("a", pDouble);
+   DefineParameter("b", pDouble);
+   DefineParameter("length", Int32);
+
+   DefineReturnType(NoType);
+   }
+
+bool
+MulDoubleMethod::buildIL()
+   {
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pDouble,
+   loop->      Load("result"),
+   loop->      Load("i")),
+   loop->   Mul(
+   loop->      LoadAt(pDouble,
+   loop->         IndexAt(pDouble,
+   loop->            Load("a"),
+   loop->            Load("i"))),
+   loop->      LoadAt(pDouble,
+   loop->         IndexAt(pDouble,
+   loop->            Load("b"),
+   loop->            Load("i")))));
+
+   Return();
+
+   return true;
+   }
+
+AddInt32Method::AddInt32Method(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("addInt32");
+
+   pInt32 = types->PointerTo(Int32);
+
+   DefineParameter("result", pInt32);
+   DefineParameter("a", pInt32);
+   DefineParameter("b", pInt32);
+   DefineParameter("length", Int32);
+
+   DefineReturnType(NoType);
+   }
+
+bool
+AddInt32Method::buildIL()
+   {
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pInt32,
+   loop->      Load("result"),
+   loop->      Load("i")),
+   loop->   Add(
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("a"),
+   loop->            Load("i"))),
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("b"),
+   loop->            Load("i")))));
+
+   Return();
+
+   return true;
+   }
+
+AddInt32DoWhileMethod::AddInt32DoWhileMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("addInt32DoWhile");
+
+   pInt32 = types->PointerTo(Int32);
+
+   DefineParameter("result", pInt32);
+   DefineParameter("a", pInt32);
+   DefineParameter("b", pInt32);
+   DefineParameter("length", Int32);
+
+   DefineReturnType(NoType);
+   }
+
+bool
+AddInt32DoWhileMethod::buildIL()
+   {
+   Store("i",
+      ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   DoWhileLoop("keepGoing", &loop);
+
+   loop->StoreAt(
+   loop->   IndexAt(pInt32,
+   loop->      Load("result"),
+   loop->      Load("i")),
+   loop->   Add(
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("a"),
+   loop->            Load("i"))),
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("b"),
+   loop->            Load("i")))));
+
+   loop->Store("i",
+   loop->   Add(
+   loop->      Load("i"),
+   loop->      ConstInt32(1)));
+
+   loop->Store("keepGoing",
+   loop->   LessThan(
+   loop->      Load("i"),
+   loop->      Load("length")));
+
+   Return();
+
+   return true;
+   }
+
+SumInt32Method::SumInt32Method(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("sumInt32");
+
+   pInt32 = types->PointerTo(Int32);
+
+   DefineParameter("a", pInt32);
+   DefineParameter("length", Int32);
+
+   DefineReturnType(Int32);
+   }
+
+bool
+SumInt32Method::buildIL()
+   {
+   Store("sum",
+      ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->Store("sum",
+   loop->   Add(
+   loop->      Load("sum"),
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("a"),
+   loop->            Load("i")))));
+
+   Return(
+      Load("sum"));
+
+   return true;
+   }
+
+static int32_t failures = 0;
+
+static void
+check(bool ok, const char *test, int32_t length)
+   {
+   if (!ok)
+      {
+      fprintf(stderr, "FAIL: %s is wrong for length %d\n", test, length);
+      failures++;
+      }
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   printf("Step 1: initialize JIT\n");
+   bool initialized = initializeJit();
+   if (!initialized)
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   printf("Step 2: define type dictionaries\n");
+   OMR::JitBuilder::TypeDictionary mulDoubleTypes;
+   OMR::JitBuilder::TypeDictionary addInt32Types;
+   OMR::JitBuilder::TypeDictionary addInt32DoWhileTypes;
+   OMR::JitBuilder::TypeDictionary sumInt32Types;
+
+   printf("Step 3: compile method builders\n");
+   MulDoubleMethod mulDoubleMethod(&mulDoubleTypes);
+   AddInt32Method addInt32Method(&addInt32Types);
+   AddInt32DoWhileMethod addInt32DoWhileMethod(&addInt32DoWhileTypes);
+   SumInt32Method sumInt32Method(&sumInt32Types);
+   void *mulDoubleEntry = 0;
+   void *addInt32Entry = 0;
+   void *addInt32DoWhileEntry = 0;
+   void *sumInt32Entry = 0;
+   int32_t rc = compileMethodBuilder(&mulDoubleMethod, &mulDoubleEntry);
+   if (rc == 0)
+      rc = compileMethodBuilder(&addInt32Method, &addInt32Entry);
+   if (rc == 0)
+      rc = compileMethodBuilder(&addInt32DoWhileMethod, &addInt32DoWhileEntry);
+   if (rc == 0)
+      rc = compileMethodBuilder(&sumInt32Method, &sumInt32Entry);
+   if (rc != 0)
+      {
+      fprintf(stderr,"FAIL: compilation error %d\n", rc);
+      exit(-2);
+      }
+
+   MulDoubleFunctionType *mulDouble = (MulDoubleFunctionType *)mulDoubleEntry;
+   AddInt32FunctionType *addInt32 = (AddInt32FunctionType *)addInt32Entry;
+   AddInt32FunctionType *addInt32DoWhile = (AddInt32FunctionType *)addInt32DoWhileEntry;
+   SumInt32FunctionType *sumInt32 = (SumInt32FunctionType *)sumInt32Entry;
+
+   printf("Step 4: invoke compiled code and verify results for lengths 0 to %d\n", MAX_LENGTH);
+   double da[MAX_LENGTH], db[MAX_LENGTH], dresult[MAX_LENGTH + 1];
+   int32_t ia[MAX_LENGTH + 1], ib[MAX_LENGTH], iresult[MAX_LENGTH + 1];
+   for (int32_t length = 0; length <= MAX_LENGTH; length++)
+      {
+      for (int32_t i = 0; i < MAX_LENGTH; i++)
+         {
+         da[i] = 0.5 * i;
+         db[i] = 3.0 - i;
+         ia[i] = i * 7;
+         ib[i] = 1000 - i;
+         }
+      for (int32_t i = 0; i <= MAX_LENGTH; i++)
+         {
+         dresult[i] = -1.0;
+         iresult[i] = -1;
+         }
+
+      mulDouble(dresult, da, db, length);
+      bool ok = dresult[length] == -1.0;
+      for (int32_t i = 0; i < length; i++)
+         ok = ok && dresult[i] == da[i] * db[i];
+      check(ok, "mulDouble", length);
+
+      addInt32(iresult, ia, ib, length);
+      ok = iresult[length] == -1;
+      for (int32_t i = 0; i < length; i++)
+         ok = ok && iresult[i] == ia[i] + ib[i];
+      check(ok, "addInt32", length);
+
+      // a do-while loop runs its body at least once, even for length 0
+      int32_t iterations = (length > 0) ? length : 1;
+      for (int32_t i = 0; i <= MAX_LENGTH; i++)
+         iresult[i] = -1;
+      addInt32DoWhile(iresult, ia, ib, length);
+      ok = iresult[iterations] == -1;
+      for (int32_t i = 0; i < iterations; i++)
+         ok = ok && iresult[i] == ia[i] + ib[i];
+      check(ok, "addInt32DoWhile", length);
+
+      int32_t sum = 0;
+      for (int32_t i = 0; i < length; i++)
+         sum += ia[i];
+      check(sumInt32(ia, length) == sum, "sumInt32", length);
+
+      // each element depends on the one stored by the previous iteration
+      int32_t expected[MAX_LENGTH + 1];
+      ia[0] = 1;
+      expected[0] = 1;
+      for (int32_t i = 0; i < length; i++)
+         expected[i + 1] = expected[i] + ib[i];
+      addInt32(ia + 1, ia, ib, length);
+      ok = true;
+      for (int32_t i = 0; i <= length; i++)
+         ok = ok && ia[i] == expected[i];
+      check(ok, "overlapping addInt32", length);
+      }
+
+   if (failures > 0)
+      {
+      fprintf(stderr, "FAIL: %d wrong results\n", failures);
+      exit(-3);
+      }
+
+   printf ("Step 5: shutdown JIT\n");
+   shutdownJit();
+
+   printf("PASS\n");
+   }
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef LOOPVECTORIZATION_INCL
+#define LOOPVECTORIZATION_INCL
+
+#include "JitBuilder.hpp"
+
+typedef void (MulDoubleFunctionType)(double *, double *, double *, int32_t);
+typedef void (AddInt32FunctionType)(int32_t *, int32_t *, int32_t *, int32_t);
+typedef int32_t (SumInt32FunctionType)(int32_t *, int32_t);
+
+// result[i] = a[i] * b[i]
+class MulDoubleMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   private:
+   OMR::JitBuilder::IlType *pDouble;
+
+   public:
+   MulDoubleMethod(OMR::JitBuilder::TypeDictionary *types);
+   virtual bool buildIL();
+   };
+
+// result[i] = a[i] + b[i]
+class AddInt32Method : public OMR::JitBuilder::MethodBuilder
+   {
+   private:
+   OMR::JitBuilder::IlType *pInt32;
+
+   public:
+   AddInt32Method(OMR::JitBuilder::TypeDictionary *types);
+   virtual bool buildIL();
+   };
+
+// i = 0; do { result[i] = a[i] + b[i]; i++; } while (i < length);
+class AddInt32DoWhileMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   private:
+   OMR::JitBuilder::IlType *pInt32;
+
+   public:
+   AddInt32DoWhileMethod(OMR::JitBuilder::TypeDictionary *types);
+   virtual bool buildIL();
+   };
+
+// returns a[0] + ... + a[length-1]
+class SumInt32Method : public OMR::JitBuilder::MethodBuilder
+   {
+   private:
+   OMR::JitBuilder::IlType *pInt32;
+
+   public:
+   SumInt32Method(OMR::JitBuilder::TypeDictionary *types);
+   virtual bool buildIL();
+   };
+
+#endif // !defined(LOOPVECTORIZATION_INCL)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2016, 2018 IBM Corp. and others
+ * Copyright (c) 2016, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -233,7 +233,8 @@ VectorMatMult::buildIL()
    OMR::JitBuilder::IlValue *N = Load("N");
    OMR::JitBuilder::IlValue *zero = ConstInt32(0);
    OMR::JitBuilder::IlValue *one = ConstInt32(1);
-   OMR::JitBuilder::IlValue *two = ConstInt32(2);
+   // a vector holds as many doubles as the widest vector registers of the processor
+   OMR::JitBuilder::IlValue *lanes = ConstInt32(VectorDouble->getSize() / sizeof(double));
 
    OMR::JitBuilder::IlBuilder *iloop=NULL, *jloop=NULL, *kloop=NULL;
    ForLoopUp("i", &iloop, zero, N, one);
@@ -241,7 +242,7 @@ VectorMatMult::buildIL()
       i = iloop->Load("i");
 
       // vectorizing loop j
-      iloop->ForLoopUp("j", &jloop, zero, N, two);
+      iloop->ForLoopUp("j", &jloop, zero, N, lanes);
          {
          j = jloop->Load("j");
 
@@ -296,7 +297,7 @@ main(int argc, char *argv[])
       }
 
    printf("Step 2: define matrices\n");
-   const int32_t N=4;
+   const int32_t N=8;
    double A[N*N];
    double B[N*N];
    double C[N*N];
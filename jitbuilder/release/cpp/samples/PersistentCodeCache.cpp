@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "PersistentCodeCache.hpp"
+
+#define MAX_ENTRIES 8
+
+static int32_t
+scale(int32_t x)
+   {
+   #define SCALE_LINE LINETOSTR(__LINE__)
+   return x * 10 + 1;
+   }
+
+static int32_t counter = 0;
+
+PolynomialMethod::PolynomialMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("polynomial");
+   DefineParameter("x", Int32);
+   DefineReturnType(Int32);
+   }
+
+bool
+PolynomialMethod::buildIL()
+   {
+   // x * x + 3 * x + 7
+   Return(
+      Add(
+         Add(
+            Mul(
+               Load("x"),
+               Load("x")),
+            Mul(
+               ConstInt32(3),
+               Load("x"))),
+         ConstInt32(7)));
+
+   return true;
+   }
+
+NativeCallMethod::NativeCallMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("nativeCall");
+   DefineParameter("x", Int32);
+   DefineReturnType(Int32);
+
+   DefineFunction((char *)"scale",
+                  (char *)__FILE__,
+                  (char *)SCALE_LINE,
+                  (void *)&scale,
+                  Int32,
+                  1,
+                  Int32);
+   }
+
+bool
+NativeCallMethod::buildIL()
+   {
+   Return(
+      Add(
+         Call("scale", 1,
+            Load("x")),
+         ConstInt32(5)));
+
+   return true;
+   }
+
+GlobalCounterMethod::GlobalCounterMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("globalCounter");
+   DefineParameter("x", Int32);
+   DefineReturnType(Int32);
+
+   DefineGlobal("counter", Int32, &counter);
+   }
+
+bool
+GlobalCounterMethod::buildIL()
+   {
+   Store("counter",
+      Add(
+         Load("counter"),
+         Load("x")));
+
+   Return(
+      Load("counter"));
+
+   return true;
+   }
+
+static int32_t failures = 0;
+
+static void
+check(bool ok, const char *what)
+   {
+   if (!ok)
+      {
+      fprintf(stderr, "FAIL: %s\n", what);
+      failures++;
+      }
+   }
+
+struct Entry
+   {
+   char name[256];
+   ino_t inode;
+   time_t modified;
+   };
+
+// Lists the bodies stored in directory
+static int32_t
+listEntries(const char *directory, Entry *entries)
+   {
+   int32_t numEntries = 0;
+   DIR *dir = opendir(directory);
+   if (dir == NULL)
+      return 0;
+   for (struct dirent *dirEntry = readdir(dir); dirEntry != NULL; dirEntry = readdir(dir))
+      {
+      size_t length = strlen(dirEntry->d_name);
+      if (length < 4 || strcmp(dirEntry->d_name + length - 4, ".jit") != 0 || numEntries == MAX_ENTRIES)
+         continue;
+
+      Entry *entry = &entries[numEntries++];
+      snprintf(entry->name, sizeof(entry->name), "%s/%s", directory, dirEntry->d_name);
+      struct stat status;
+      stat(entry->name, &status);
+      entry->inode = status.st_ino;
+      entry->modified = status.st_mtime;
+      }
+   closedir(dir);
+   return numEntries;
+   }
+
+// Compiles the three methods with the cache in directory and checks what they compute
+static void
+compileAndRun(const char *directory)
+   {
+   static char options[1024];
+   snprintf(options, sizeof(options), "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,persistentCodeCacheDir=%s", directory);
+   if (!initializeJitWithOptions(options))
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   OMR::JitBuilder::TypeDictionary types;
+
+   PolynomialMethod polynomialMethod(&types);
+   void *polynomialEntry = 0;
+   check(compileMethodBuilder(&polynomialMethod, &polynomialEntry) == 0, "polynomial does not compile");
+
+   NativeCallMethod nativeCallMethod(&types);
+   void *nativeCallEntry = 0;
+   check(compileMethodBuilder(&nativeCallMethod, &nativeCallEntry) == 0, "nativeCall does not compile");
+
+   GlobalCounterMethod globalCounterMethod(&types);
+   void *globalCounterEntry = 0;
+   check(compileMethodBuilder(&globalCounterMethod, &globalCounterEntry) == 0, "globalCounter does not compile");
+
+   if (failures > 0)
+      exit(-2);
+
+   PersistentCodeCacheFunctionType *polynomial = (PersistentCodeCacheFunctionType *)polynomialEntry;
+   PersistentCodeCacheFunctionType *nativeCall = (PersistentCodeCacheFunctionType *)nativeCallEntry;
+   PersistentCodeCacheFunctionType *globalCounter = (PersistentCodeCacheFunctionType *)globalCounterEntry;
+   for (int32_t x = -3; x <= 3; x++)
+      {
+      check(polynomial(x) == x * x + 3 * x + 7, "polynomial computes the wrong value");
+      check(nativeCall(x) == scale(x) + 5, "nativeCall computes the wrong value");
+      }
+
+   counter = 0;
+   check(globalCounter(4) == 4 && globalCounter(5) == 9 && counter == 9, "globalCounter does not update counter");
+
+   shutdownJit();
+   }
+
+static void
+removeDirectory(const char *directory)
+   {
+   Entry entries[MAX_ENTRIES];
+   int32_t numEntries = listEntries(directory, entries);
+   for (int32_t i = 0; i < numEntries; i++)
+      unlink(entries[i].name);
+   rmdir(directory);
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   char directory[] = "/tmp/persistentcodecache.XXXXXX";
+   if (mkdtemp(directory) == NULL)
+      {
+      fprintf(stderr, "FAIL: could not create a directory for the cache\n");
+      exit(-1);
+      }
+
+   printf("Step 1: compile with an empty cache\n");
+   compileAndRun(directory);
+
+   printf("Step 2: check only the bodies without a global were stored\n");
+   Entry stored[MAX_ENTRIES];
+   int32_t numStored = listEntries(directory, stored);
+   check(numStored == 2, "polynomial and nativeCall, and only those, should be stored");
+
+   // Loading a body marks it as used, storing one replaces the file
+   //
+   for (int32_t i = 0; i < numStored; i++)
+      {
+      struct timeval times[2] = { { 0, 0 }, { 0, 0 } };
+      utimes(stored[i].name, times);
+      }
+
+   printf("Step 3: restart the JIT and compile again, loading the stored bodies\n");
+   compileAndRun(directory);
+
+   Entry loaded[MAX_ENTRIES];
+   int32_t numLoaded = listEntries(directory, loaded);
+   check(numLoaded == numStored, "the second compilations stored new bodies");
+   for (int32_t i = 0; i < numLoaded && i < numStored; i++)
+      {
+      bool found = false;
+      for (int32_t j = 0; j < numStored; j++)
+         {
+         if (strcmp(loaded[i].name, stored[j].name) == 0)
+            {
+            found = true;
+            check(loaded[i].inode == stored[j].inode, "a stored body was compiled and stored again");
+            check(loaded[i].modified != 0, "a stored body was not loaded");
+            }
+         }
+      check(found, "a body was stored under a different name");
+      }
+   removeDirectory(directory);
+
+   printf("Step 4: check a directory other users can write to is not used\n");
+   char sharedDirectory[] = "/tmp/persistentcodecache.XXXXXX";
+   if (mkdtemp(sharedDirectory) == NULL || chmod(sharedDirectory, 0777) != 0)
+      {
+      fprintf(stderr, "FAIL: could not create a shared directory\n");
+      exit(-1);
+      }
+   compileAndRun(sharedDirectory);
+   Entry shared[MAX_ENTRIES];
+   check(listEntries(sharedDirectory, shared) == 0, "bodies were stored in a world writable directory");
+   removeDirectory(sharedDirectory);
+
+   if (failures > 0)
+      {
+      fprintf(stderr, "FAIL: %d checks failed\n", failures);
+      exit(-4);
+      }
+
+   printf("PASS\n");
+   }
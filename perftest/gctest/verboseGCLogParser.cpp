@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2016, 2016 IBM Corp. and others
+ * Copyright (c) 2016, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -32,6 +32,7 @@
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
+#include "VerboseBinaryLogConverter.hpp"
 
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
@@ -39,6 +40,7 @@ const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']"
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+const char* CONVERTED_FILE_PREFIX = "converted_";
 
 double getAvg(std::vector<double> v);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
@@ -132,9 +134,20 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double avgGCDuration = 0;
 
 	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+	pugi::xml_parse_result result;
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	/* logs written by the binary verbose writer are converted to XML first */
+	char convertedFileName[EsMaxPath];
+	omrstr_printf(convertedFileName, sizeof(convertedFileName), "%s%s", CONVERTED_FILE_PREFIX, fileName);
+	if (MM_VerboseBinaryLogConverter::convert(&portLibrary, fileName, convertedFileName)) {
+		result = doc.load_file(convertedFileName);
+		omrfile_unlink(convertedFileName);
+	} else {
+		result = doc.load_file(fileName);
+	}
+
 	if(!result) {
 		omrtty_printf("Error loading file : %s\n", fileName);
 		return;
@@ -1,5 +1,5 @@
 ###############################################################################
-# Copyright (c) 2016, 2016 IBM Corp. and others
+# Copyright (c) 2016, 2020 IBM Corp. and others
 # 
 # This program and the accompanying materials are made available under
 # the terms of the Eclipse Public License 2.0 which accompanies this
@@ -43,7 +43,7 @@ endif
 all: test
 	
 omr_perfgctest:
-	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
+	./omrgctest --gtest_filter="perfTest*:ScavengerCopyOrderBenchmark*" -keepVerboseLog -gcBenchmarkResults=gcbenchmark.csv
 	./omrperfgctest
 
 .PHONY: all test omr_perfgctest 
@@ -149,6 +149,16 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 	}
 
 
+	/* return 1 if reserved memory is interleaved across NUMA nodes, otherwise, return 0 */
+	if (0 == strcmp(OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_IN_USE, key)) {
+#if defined(OMR_PORT_NUMA_SUPPORT) && defined(PPG_numa_platform_interleave_memory) && defined(PPG_numa_platform_supports_numa)
+		if ((1 == PPG_numa_platform_interleave_memory) && (1 == PPG_numa_platform_supports_numa)) {
+			return 1;
+		}
+#endif /* defined(OMR_PORT_NUMA_SUPPORT) && defined(PPG_numa_platform_interleave_memory) && defined(PPG_numa_platform_supports_numa) */
+		return 0;
+	}
+
 	/* enable or disable NUMA memory interleave */
 	if (0 == strcmp(OMRPORT_CTLDATA_VMEM_NUMA_INTERLEAVE_MEM, key)) {
 #if defined(PPG_numa_platform_interleave_memory)
@@ -310,6 +320,15 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 		return 0;
 	}
 
+	/* return 1 if memory reserved with default pages is advised for Transparent HugePage, otherwise, return 0 */
+	if (0 == strcmp(OMRPORT_CTLDATA_VMEM_ADVISE_HUGEPAGE_IN_USE, key)) {
+#if defined(LINUX)
+		return (0 != portLibrary->portGlobals->vmemEnableMadvise) ? 1 : 0;
+#else /* defined(LINUX) */
+		return 0;
+#endif /* defined(LINUX) */
+	}
+
 	/* work around for case if smart address feature still be not reliable enough */
 	if (0 == strcmp(OMRPORT_CTLDATA_VMEM_PERFORM_FULL_MEMORY_SEARCH, key)) {
 #if defined(PPG_performFullMemorySearch)